@@ -0,0 +1,83 @@
+/*!
+ * \file   bindings/python/mtest/MTestEnsemble.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <boost/python.hpp>
+#include <boost/python/make_constructor.hpp>
+#include "MTest/MTestEnsemble.hxx"
+
+void declareMTestEnsemble();
+
+static std::vector<std::string> MTestEnsembleResults_getNames(
+    const mtest::MTestEnsemble::Results& r) {
+  return r.names;
+}
+
+static std::vector<std::vector<mtest::real>> MTestEnsembleResults_getColumns(
+    const mtest::MTestEnsemble::Results& r) {
+  return r.columns;
+}
+
+static std::vector<std::string> MTestEnsembleResults_getFailures(
+    const mtest::MTestEnsemble::Results& r) {
+  return r.failures;
+}
+
+static std::vector<mtest::real> MTestEnsembleResults_getColumn(
+    const mtest::MTestEnsemble::Results& r, const std::string& n) {
+  return r.getColumn(n);
+}
+
+static std::shared_ptr<mtest::MTestEnsemble> MTestEnsemble_make(
+    const std::string& f) {
+  return std::make_shared<mtest::MTestEnsemble>(f);
+}
+
+static std::shared_ptr<mtest::MTestEnsemble> MTestEnsemble_make2(
+    const std::string& f, const std::vector<std::string>& e) {
+  return std::make_shared<mtest::MTestEnsemble>(f, e);
+}
+
+static std::shared_ptr<mtest::MTestEnsemble> MTestEnsemble_make3(
+    const std::string& f,
+    const std::vector<std::string>& e,
+    const std::map<std::string, std::string>& s) {
+  return std::make_shared<mtest::MTestEnsemble>(f, e, s);
+}
+
+void declareMTestEnsemble() {
+  using namespace boost::python;
+  using namespace mtest;
+  class_<MTestEnsemble::Results>("MTestEnsembleResults")
+      .add_property("names", MTestEnsembleResults_getNames)
+      .add_property("columns", MTestEnsembleResults_getColumns)
+      .add_property("failures", MTestEnsembleResults_getFailures)
+      .def("succeeded", &MTestEnsemble::Results::succeeded)
+      .def("getColumn", MTestEnsembleResults_getColumn)
+      .def("__getitem__", MTestEnsembleResults_getColumn);
+  class_<MTestEnsemble, std::shared_ptr<MTestEnsemble>, boost::noncopyable>(
+      "MTestEnsemble", no_init)
+      .def("__init__", make_constructor(MTestEnsemble_make))
+      .def("__init__", make_constructor(MTestEnsemble_make2))
+      .def("__init__", make_constructor(MTestEnsemble_make3))
+      .def("setNumberOfThreads", &MTestEnsemble::setNumberOfThreads,
+           "set the number of threads used to run the variants")
+      .def("addVariant", &MTestEnsemble::addVariant,
+           "add a variant, described by the values of its parameters. Each "
+           "parameter 'n' replaces the pattern '@n@' in the input file")
+      .def("readVariants", &MTestEnsemble::readVariants,
+           "read the variants from a text file")
+      .def("getNumberOfVariants", &MTestEnsemble::getNumberOfVariants)
+      .def("execute", &MTestEnsemble::execute,
+           "run all the variants and return the results gathered by "
+           "columns");
+}  // end of declareMTestEnsemble
@@ -194,6 +194,9 @@ void declarePipeTest() {
       .def("setInnerRadius", &PipeTest::setInnerRadius)
       .def("setOuterRadius", &PipeTest::setOuterRadius)
       .def("setNumberOfElements", &PipeTest::setNumberOfElements)
+      .def("setNumberOfThreads", &PipeTest::setNumberOfThreads,
+           "set the number of threads used to integrate the behaviour "
+           "over the elements")
       .def("getNumberOfUnknowns", &PipeTest::getNumberOfUnknowns)
       .def("completeInitialisation", &PipeTest::completeInitialisation)
       .def("execute", pm)
@@ -88,6 +88,21 @@ static void setOutputFrequency(mtest::SchemeBase& s, const std::string& v) {
   }
 }
 
+static void setOutputFileFormat(mtest::SchemeBase& s, const std::string& v) {
+  if (v == "Text") {
+    s.setOutputFileFormat(mtest::SchemeBase::TEXTFILEFORMAT);
+  } else if (v == "Binary") {
+    s.setOutputFileFormat(mtest::SchemeBase::BINARYFILEFORMAT);
+  } else if (v == "BinaryFloat32") {
+    s.setOutputFileFormat(mtest::SchemeBase::SINGLEPRECISIONBINARYFILEFORMAT);
+  } else {
+    tfel::raise(
+        "SchemeBase::setOutputFileFormat: "
+        "invalid format '" +
+        v + "'");
+  }
+}
+
 static void SchemeBase_printOutput(mtest::SchemeBase& s,
                                    const mtest::real t,
                                    const mtest::StudyCurrentState& scs) {
@@ -248,8 +263,28 @@ void declareSchemeBase() {
            "This method specify the number of digits used to print "
            "the results in the output file.\n"
            "* The parameter (uint) is the number of digits wanted.")
+      .def("setOutputFileFormat", setOutputFileFormat,
+           "This method specify the format of the output files.\n"
+           "* The parameter (string) specify the format. The allowed "
+           "formats are:\n"
+           "- 'Text': results are written in a text file (default).\n"
+           "- 'Binary': results are written in a binary columnar "
+           "file, in double precision.\n"
+           "- 'BinaryFloat32': results are written in a binary "
+           "columnar file, in single precision.")
       .def("printOutput", &SchemeBase::printOutput)
       .def("printOutput", &SchemeBase_printOutput)
+      .def("setCheckpointFrequency", &SchemeBase::setCheckpointFrequency,
+           "This method specify the number of time steps between "
+           "two checkpoints.\n"
+           "* The parameter (uint) is the number of time steps.")
+      .def("setCheckpointFileName", &SchemeBase::setCheckpointFileName,
+           "This method specify the name of the checkpoint file.\n"
+           "* The parameter (string) is the name of the choosen file.")
+      .def("setRestartFileName", &SchemeBase::setRestartFileName,
+           "This method specify the name of a checkpoint file from "
+           "which the computation is restarted.\n"
+           "* The parameter (string) is the name of the checkpoint file.")
       .def("setResidualFileName", &SchemeBase::setResidualFileName,
            "This method specify the name of a file where the "
            "residuals at each iteration will be printed.\n"
@@ -22,6 +22,7 @@ void declareSingleStructureScheme();
 void declareConstraint();
 void declareMTest();
 void declareMTestParser();
+void declareMTestEnsemble();
 void declarePipeMesh();
 void declarePipeTest();
 void declareCurrentState();
@@ -69,6 +70,7 @@ BOOST_PYTHON_MODULE(_mtest) {
   declareSingleStructureScheme();
   declareConstraint();
   declareMTest();
+  declareMTestEnsemble();
   declarePipeMesh();
   declarePipeTest();
   declareMFrontLogStream();
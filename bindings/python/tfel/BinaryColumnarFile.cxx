@@ -0,0 +1,70 @@
+/*!
+ * \file   bindings/python/tfel/BinaryColumnarFile.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include <boost/python/numpy.hpp>
+#endif /* TFEL_NUMPY_SUPPORT */
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
+
+void declareBinaryColumnarFile();
+
+static std::vector<std::string> BinaryColumnarData_getNames(
+    const tfel::utilities::BinaryColumnarData& d) {
+  return d.names;
+}  // end of BinaryColumnarData_getNames
+
+static std::vector<double> BinaryColumnarData_getColumn(
+    const tfel::utilities::BinaryColumnarData& d, const std::string& n) {
+  return d.getColumn(n);
+}  // end of BinaryColumnarData_getColumn
+
+#ifdef TFEL_NUMPY_SUPPORT
+/*!
+ * \return a read-only numpy array sharing the values of the given
+ * column. The array keeps a reference to the data.
+ * \param[in] o: python object holding the data
+ * \param[in] n: name of the column
+ */
+static boost::python::numpy::ndarray BinaryColumnarData_getColumnView(
+    boost::python::object o, const std::string& n) {
+  namespace np = boost::python::numpy;
+  const auto& d =
+      boost::python::extract<const tfel::utilities::BinaryColumnarData&>(o)();
+  const auto& c = d.getColumn(n);
+  return np::from_data(c.data(), np::dtype::get_builtin<double>(),
+                       boost::python::make_tuple(c.size()),
+                       boost::python::make_tuple(sizeof(double)), o);
+}  // end of BinaryColumnarData_getColumnView
+#endif /* TFEL_NUMPY_SUPPORT */
+
+void declareBinaryColumnarFile() {
+  using namespace boost::python;
+  using namespace tfel::utilities;
+  class_<BinaryColumnarData>("BinaryColumnarData")
+      .add_property("names", BinaryColumnarData_getNames)
+      .def_readonly("value_size", &BinaryColumnarData::value_size)
+      .def("getColumn", BinaryColumnarData_getColumn,
+           "return a copy of the values of the given column")
+#ifdef TFEL_NUMPY_SUPPORT
+      .def("getColumnView", BinaryColumnarData_getColumnView,
+           "return a read-only numpy array sharing the values of the "
+           "given column")
+      .def("__getitem__", BinaryColumnarData_getColumnView)
+#else  /* TFEL_NUMPY_SUPPORT */
+      .def("__getitem__", BinaryColumnarData_getColumn)
+#endif /* TFEL_NUMPY_SUPPORT */
+      ;
+  def("isBinaryColumnarFile", isBinaryColumnarFile);
+  def("readBinaryColumnarFile", readBinaryColumnarFile);
+}  // end of declareBinaryColumnarFile
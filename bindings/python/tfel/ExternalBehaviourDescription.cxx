@@ -76,6 +76,8 @@ void declareExternalBehaviourDescription() {
                     &ExternalBehaviourDescription::computesInternalEnergy)
       .def_readonly("computesDissipatedEnergy",
                     &ExternalBehaviourDescription::computesDissipatedEnergy)
+      .def_readonly("hasBatchIntegrationFunction",
+                    &ExternalBehaviourDescription::hasBatchIntegrationFunction)
       .def_readonly("requiresStiffnessTensor",
                     &ExternalBehaviourDescription::requiresStiffnessTensor)
       .def_readonly("requiresThermalExpansionCoefficientTensor",
@@ -12,11 +12,19 @@
  */
 
 #include <boost/python.hpp>
+#ifdef TFEL_NUMPY_SUPPORT
+#include "TFEL/Numpy/InitNumpy.hxx"
+#endif /* TFEL_NUMPY_SUPPORT */
 
 void declareData();
 void declareTextData();
+void declareBinaryColumnarFile();
 
 BOOST_PYTHON_MODULE(utilities) {
+#ifdef TFEL_NUMPY_SUPPORT
+  tfel::numpy::initializeNumPy();
+#endif /* TFEL_NUMPY_SUPPORT */
   declareData();
   declareTextData();
+  declareBinaryColumnarFile();
 }
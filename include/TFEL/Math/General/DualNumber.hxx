@@ -0,0 +1,614 @@
+/*!
+ * \file   include/TFEL/Math/General/DualNumber.hxx
+ * \brief  This file declares the `DualNumber` class, which is used to
+ * compute exact derivatives by forward-mode automatic differentiation.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_MATH_DUALNUMBER_HXX
+#define LIB_TFEL_MATH_DUALNUMBER_HXX
+
+#include <cmath>
+#include <iosfwd>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include "TFEL/Config/TFELConfig.hxx"
+#include "TFEL/TypeTraits/IsReal.hxx"
+#include "TFEL/TypeTraits/IsScalar.hxx"
+#include "TFEL/TypeTraits/IsComplex.hxx"
+#include "TFEL/TypeTraits/IsAssignableTo.hxx"
+#include "TFEL/TypeTraits/IsFundamentalNumericType.hxx"
+#include "TFEL/TypeTraits/AbsType.hxx"
+#include "TFEL/TypeTraits/BaseType.hxx"
+#include "TFEL/TypeTraits/RealPartType.hxx"
+#include "TFEL/Math/General/IEEE754.hxx"
+#include "TFEL/Math/General/ResultType.hxx"
+#include "TFEL/Math/General/UnaryResultType.hxx"
+#include "TFEL/Math/General/BasicOperations.hxx"
+#include "TFEL/Math/power.hxx"
+
+namespace tfel::math {
+
+  /*!
+   * \brief a number holding a value and the derivatives of this value with
+   * respect to `N` independent variables.
+   *
+   * The derivatives are propagated through the arithmetic operations and the
+   * standard mathematical functions (forward-mode automatic
+   * differentiation). The derivatives of a function `f` of `N` variables `x`
+   * are thus obtained in one evaluation of `f`, by seeding the `i`th
+   * derivative of `x[i]` to one.
+   *
+   * \note the mathematical functions are found by argument dependent lookup:
+   * they must be called unqualified (e.g. `exp(x)` rather than
+   * `std::exp(x)`).
+   *
+   * \tparam N: number of derivatives
+   * \tparam ValueType: type of the value and of the derivatives
+   */
+  template <unsigned short N, typename ValueType = double>
+  struct DualNumber {
+    static_assert(std::is_floating_point_v<ValueType>,
+                  "invalid value type");
+    /*!
+     * \brief default constructor
+     *
+     * As for floating-point numbers, the value and the derivatives are left
+     * uninitialized, which avoids the cost of zeroing the large arrays of
+     * dual numbers (jacobian matrices, etc.) that are overwritten anyway.
+     * `DualNumber{}` value-initializes the dual number to zero.
+     */
+    DualNumber() noexcept = default;
+    /*!
+     * \brief constructor from a constant value
+     * \param[in] x: value
+     */
+    template <typename T>
+    constexpr DualNumber(const T x) noexcept  // NOLINT
+      requires(std::is_arithmetic_v<T>)
+        : v(static_cast<ValueType>(x)), d() {}
+    //! \brief copy constructor
+    constexpr DualNumber(const DualNumber&) noexcept = default;
+    //! \brief assignement
+    constexpr DualNumber& operator=(const DualNumber&) noexcept = default;
+    /*!
+     * \brief assignement from a constant value
+     * \param[in] x: value
+     */
+    template <typename T>
+    constexpr DualNumber& operator=(const T x) noexcept
+      requires(std::is_arithmetic_v<T>) {
+      this->v = static_cast<ValueType>(x);
+      for (unsigned short i = 0; i != N; ++i) {
+        this->d[i] = ValueType{0};
+      }
+      return *this;
+    }
+    /*!
+     * \return a variable, i.e. a dual number whose `i`th derivative is one
+     * \param[in] x: value
+     * \param[in] i: index of the variable
+     */
+    static constexpr DualNumber variable(const ValueType x,
+                                         const unsigned short i) noexcept {
+      auto r = DualNumber{x};
+      r.d[i] = ValueType{1};
+      return r;
+    }
+    //! \return the value
+    constexpr ValueType getValue() const noexcept { return this->v; }
+    //! \return the `i`th derivative
+    constexpr ValueType getDerivative(const unsigned short i) const noexcept {
+      return this->d[i];
+    }
+    //
+    constexpr DualNumber& operator+=(const DualNumber& b) noexcept {
+      this->v += b.v;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->d[i] += b.d[i];
+      }
+      return *this;
+    }
+    constexpr DualNumber& operator-=(const DualNumber& b) noexcept {
+      this->v -= b.v;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->d[i] -= b.d[i];
+      }
+      return *this;
+    }
+    constexpr DualNumber& operator*=(const DualNumber& b) noexcept {
+      for (unsigned short i = 0; i != N; ++i) {
+        this->d[i] = this->d[i] * b.v + this->v * b.d[i];
+      }
+      this->v *= b.v;
+      return *this;
+    }
+    constexpr DualNumber& operator/=(const DualNumber& b) noexcept {
+      const auto ib = 1 / b.v;
+      this->v *= ib;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->d[i] = (this->d[i] - this->v * b.d[i]) * ib;
+      }
+      return *this;
+    }
+    constexpr DualNumber& operator+=(const ValueType b) noexcept {
+      this->v += b;
+      return *this;
+    }
+    constexpr DualNumber& operator-=(const ValueType b) noexcept {
+      this->v -= b;
+      return *this;
+    }
+    constexpr DualNumber& operator*=(const ValueType b) noexcept {
+      this->v *= b;
+      for (unsigned short i = 0; i != N; ++i) {
+        this->d[i] *= b;
+      }
+      return *this;
+    }
+    constexpr DualNumber& operator/=(const ValueType b) noexcept {
+      return this->operator*=(1 / b);
+    }
+    //
+    // the results of the following operators are computed in place, without
+    // copying one of the arguments first
+    friend constexpr DualNumber operator-(const DualNumber& a) noexcept {
+      DualNumber r;
+      r.v = -a.v;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = -a.d[i];
+      }
+      return r;
+    }
+    friend constexpr DualNumber operator+(const DualNumber& a) noexcept {
+      return a;
+    }
+    friend constexpr DualNumber operator+(const DualNumber& a,
+                                          const DualNumber& b) noexcept {
+      DualNumber r;
+      r.v = a.v + b.v;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = a.d[i] + b.d[i];
+      }
+      return r;
+    }
+    friend constexpr DualNumber operator-(const DualNumber& a,
+                                          const DualNumber& b) noexcept {
+      DualNumber r;
+      r.v = a.v - b.v;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = a.d[i] - b.d[i];
+      }
+      return r;
+    }
+    friend constexpr DualNumber operator*(const DualNumber& a,
+                                          const DualNumber& b) noexcept {
+      DualNumber r;
+      r.v = a.v * b.v;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = a.d[i] * b.v + a.v * b.d[i];
+      }
+      return r;
+    }
+    friend constexpr DualNumber operator/(const DualNumber& a,
+                                          const DualNumber& b) noexcept {
+      const auto ib = 1 / b.v;
+      DualNumber r;
+      r.v = a.v * ib;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = (a.d[i] - r.v * b.d[i]) * ib;
+      }
+      return r;
+    }
+    friend constexpr DualNumber operator+(const DualNumber& a,
+                                          const ValueType b) noexcept {
+      auto r = a;
+      r.v += b;
+      return r;
+    }
+    friend constexpr DualNumber operator+(const ValueType a,
+                                          const DualNumber& b) noexcept {
+      return b + a;
+    }
+    friend constexpr DualNumber operator-(const DualNumber& a,
+                                          const ValueType b) noexcept {
+      auto r = a;
+      r.v -= b;
+      return r;
+    }
+    friend constexpr DualNumber operator-(const ValueType a,
+                                          const DualNumber& b) noexcept {
+      auto r = -b;
+      r.v += a;
+      return r;
+    }
+    friend constexpr DualNumber operator*(const DualNumber& a,
+                                          const ValueType b) noexcept {
+      DualNumber r;
+      r.v = a.v * b;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = a.d[i] * b;
+      }
+      return r;
+    }
+    friend constexpr DualNumber operator*(const ValueType a,
+                                          const DualNumber& b) noexcept {
+      return b * a;
+    }
+    friend constexpr DualNumber operator/(const DualNumber& a,
+                                          const ValueType b) noexcept {
+      return a * (1 / b);
+    }
+    friend constexpr DualNumber operator/(const ValueType a,
+                                          const DualNumber& b) noexcept {
+      const auto ib = 1 / b.v;
+      DualNumber r;
+      r.v = a * ib;
+      const auto c = -r.v * ib;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = c * b.d[i];
+      }
+      return r;
+    }
+    // comparison operators only compare the values
+    friend constexpr bool operator==(const DualNumber& a,
+                                     const DualNumber& b) noexcept {
+      return a.v == b.v;
+    }
+    friend constexpr bool operator==(const DualNumber& a,
+                                     const ValueType b) noexcept {
+      return a.v == b;
+    }
+    friend constexpr auto operator<=>(const DualNumber& a,
+                                      const DualNumber& b) noexcept {
+      return a.v <=> b.v;
+    }
+    friend constexpr auto operator<=>(const DualNumber& a,
+                                      const ValueType b) noexcept {
+      return a.v <=> b;
+    }
+    //! \brief output operator, only the value is printed
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(
+        std::basic_ostream<CharT, Traits>& os, const DualNumber& x) {
+      return os << x.v;
+    }
+    // mathematical functions are hidden friends, so that they are only
+    // found by argument dependent lookup and do not hide the standard ones
+    friend constexpr DualNumber abs(const DualNumber& x) noexcept {
+      return (x.v < 0) ? -x : x;
+    }
+    friend constexpr DualNumber fabs(const DualNumber& x) noexcept {
+      return (x.v < 0) ? -x : x;
+    }
+    friend DualNumber sqrt(const DualNumber& x) noexcept {
+      const auto s = std::sqrt(x.v);
+      return applyChainRule(x, s, 1 / (2 * s));
+    }
+    friend DualNumber cbrt(const DualNumber& x) noexcept {
+      const auto c = std::cbrt(x.v);
+      return applyChainRule(x, c, 1 / (3 * c * c));
+    }
+    friend DualNumber exp(const DualNumber& x) noexcept {
+      const auto e = std::exp(x.v);
+      return applyChainRule(x, e, e);
+    }
+    friend DualNumber log(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::log(x.v), 1 / x.v);
+    }
+    friend DualNumber log10(const DualNumber& x) noexcept {
+      constexpr auto ln10 = std::numbers::ln10_v<ValueType>;
+      return applyChainRule(x, std::log10(x.v), 1 / (ln10 * x.v));
+    }
+    friend DualNumber pow(
+        const DualNumber& x,
+        const ValueType y) noexcept {
+      return applyChainRule(x, std::pow(x.v, y),
+                                       y * std::pow(x.v, y - 1));
+    }
+    friend DualNumber pow(const ValueType x,
+                                 const DualNumber& y) noexcept {
+      const auto p = std::pow(x, y.v);
+      return applyChainRule(y, p, p * std::log(x));
+    }
+    friend DualNumber pow(const DualNumber& x,
+                                 const DualNumber& y) noexcept {
+      auto r = pow(x, y.v);
+      if (x.v > 0) {
+        const auto c = r.v * std::log(x.v);
+        for (unsigned short i = 0; i != N; ++i) {
+          r.d[i] += c * y.d[i];
+        }
+      }
+      return r;
+    }
+    friend DualNumber sin(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::sin(x.v), std::cos(x.v));
+    }
+    friend DualNumber cos(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::cos(x.v), -std::sin(x.v));
+    }
+    friend DualNumber tan(const DualNumber& x) noexcept {
+      const auto t = std::tan(x.v);
+      return applyChainRule(x, t, 1 + t * t);
+    }
+    friend DualNumber asin(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::asin(x.v),
+                                       1 / std::sqrt(1 - x.v * x.v));
+    }
+    friend DualNumber acos(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::acos(x.v),
+                                       -1 / std::sqrt(1 - x.v * x.v));
+    }
+    friend DualNumber atan(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::atan(x.v), 1 / (1 + x.v * x.v));
+    }
+    friend DualNumber sinh(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::sinh(x.v), std::cosh(x.v));
+    }
+    friend DualNumber cosh(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::cosh(x.v), std::sinh(x.v));
+    }
+    friend DualNumber tanh(const DualNumber& x) noexcept {
+      const auto t = std::tanh(x.v);
+      return applyChainRule(x, t, 1 - t * t);
+    }
+    friend DualNumber asinh(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::asinh(x.v),
+                                       1 / std::sqrt(x.v * x.v + 1));
+    }
+    friend DualNumber acosh(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::acosh(x.v),
+                                       1 / std::sqrt(x.v * x.v - 1));
+    }
+    friend DualNumber atanh(const DualNumber& x) noexcept {
+      return applyChainRule(x, std::atanh(x.v), 1 / (1 - x.v * x.v));
+    }
+    friend DualNumber erf(const DualNumber& x) noexcept {
+      constexpr auto c = 2 * std::numbers::inv_sqrtpi_v<ValueType>;
+      return applyChainRule(x, std::erf(x.v),
+                                       c * std::exp(-x.v * x.v));
+    }
+    friend constexpr DualNumber min(
+        const DualNumber& x,
+        const DualNumber& y) noexcept {
+      return (y.v < x.v) ? y : x;
+    }
+    friend constexpr DualNumber min(
+        const DualNumber& x,
+        const ValueType y) noexcept {
+      return (y < x.v) ? DualNumber{y} : x;
+    }
+    friend constexpr DualNumber min(
+        const ValueType x,
+        const DualNumber& y) noexcept {
+      return (y.v < x) ? y : DualNumber{x};
+    }
+    friend constexpr DualNumber max(
+        const DualNumber& x,
+        const DualNumber& y) noexcept {
+      return (x.v < y.v) ? y : x;
+    }
+    friend constexpr DualNumber max(
+        const DualNumber& x,
+        const ValueType y) noexcept {
+      return (x.v < y) ? DualNumber{y} : x;
+    }
+    friend constexpr DualNumber max(
+        const ValueType x,
+        const DualNumber& y) noexcept {
+      return (x < y.v) ? y : DualNumber{x};
+    }
+    /*!
+     * \return a dual number whose value is `f` and whose derivatives are the
+     * derivatives of `x` multiplied by `df` (chain rule).
+     * \param[in] x: argument of the function
+     * \param[in] f: value of the function
+     * \param[in] df: derivative of the function
+     */
+    static constexpr DualNumber applyChainRule(const DualNumber& x,
+                                               const ValueType f,
+                                               const ValueType df) noexcept {
+      DualNumber r;
+      r.v = f;
+      for (unsigned short i = 0; i != N; ++i) {
+        r.d[i] = df * x.d[i];
+      }
+      return r;
+    }  // end of applyChainRule
+    //! \brief value
+    ValueType v;
+    //! \brief derivatives
+    ValueType d[N];
+  };  // end of struct DualNumber
+
+  /*!
+   * \brief a simple metafunction stating if the given type is a dual number
+   * \tparam T: type tested
+   */
+  template <typename T>
+  struct IsDualNumber : std::false_type {};
+  //! \brief partial specialisation for dual numbers
+  template <unsigned short N, typename ValueType>
+  struct IsDualNumber<DualNumber<N, ValueType>> : std::true_type {};
+  //! \return if the given type is a dual number
+  template <typename T>
+  constexpr bool isDualNumber() noexcept {
+    return IsDualNumber<std::decay_t<T>>::value;
+  }  // end of isDualNumber
+
+  /*!
+   * \brief computes x to the power N/D
+   * \param[in] x: value
+   */
+  template <int N, unsigned int D = 1, unsigned short M, typename ValueType>
+  constexpr DualNumber<M, ValueType> power(
+      const DualNumber<M, ValueType>& x) noexcept requires(D != 0) {
+    if constexpr (D == 1) {
+      if constexpr (N == 0) {
+        return DualNumber<M, ValueType>{1};
+      } else {
+        const auto p = power<N - 1>(x.v);
+        return DualNumber<M, ValueType>::applyChainRule(x, p * x.v, N * p);
+      }
+    } else {
+      constexpr auto e = static_cast<ValueType>(N) / D;
+      return pow(x, e);
+    }
+  }  // end of power
+
+  /*!
+   * \brief partial specialisation of the `ComputeBinaryOperationResult` for
+   * operations between dual numbers.
+   */
+  template <unsigned short N, typename ValueType, typename Op>
+  requires(std::is_same_v<Op, OpPlus> || std::is_same_v<Op, OpMinus> ||
+           std::is_same_v<Op, OpMult> || std::is_same_v<Op, OpDiv>)  //
+      struct ComputeBinaryOperationResult<ScalarTag,
+                                          ScalarTag,
+                                          DualNumber<N, ValueType>,
+                                          DualNumber<N, ValueType>,
+                                          Op> {
+    using type = DualNumber<N, ValueType>;
+  };
+  /*!
+   * \brief partial specialisation of the `ComputeBinaryOperationResult` for
+   * operations between a dual number and a standard scalar.
+   */
+  template <unsigned short N, typename ValueType, typename T, typename Op>
+  requires((std::is_arithmetic_v<T>)&&(
+      std::is_same_v<Op, OpPlus> || std::is_same_v<Op, OpMinus> ||
+      std::is_same_v<Op, OpMult> || std::is_same_v<Op, OpDiv>))  //
+      struct ComputeBinaryOperationResult<ScalarTag,
+                                          ScalarTag,
+                                          DualNumber<N, ValueType>,
+                                          T,
+                                          Op> {
+    using type = DualNumber<N, ValueType>;
+  };
+  /*!
+   * \brief partial specialisation of the `ComputeBinaryOperationResult` for
+   * operations between a standard scalar and a dual number.
+   */
+  template <unsigned short N, typename ValueType, typename T, typename Op>
+  requires((std::is_arithmetic_v<T>)&&(
+      std::is_same_v<Op, OpPlus> || std::is_same_v<Op, OpMinus> ||
+      std::is_same_v<Op, OpMult> || std::is_same_v<Op, OpDiv>))  //
+      struct ComputeBinaryOperationResult<ScalarTag,
+                                          ScalarTag,
+                                          T,
+                                          DualNumber<N, ValueType>,
+                                          Op> {
+    using type = DualNumber<N, ValueType>;
+  };
+  //! \brief partial specialisation for the negation of a dual number
+  template <unsigned short N, typename ValueType>
+  struct ComputeUnaryOperationResult<ScalarTag,
+                                     UnaryOperatorTag,
+                                     DualNumber<N, ValueType>,
+                                     OpNeg> {
+    using type = DualNumber<N, ValueType>;
+  };
+  //! \brief partial specialisation for the power of a dual number
+  template <unsigned short N, typename ValueType, int M, unsigned int D>
+  struct UnaryResultType<DualNumber<N, ValueType>, Power<M, D>> {
+    using type = DualNumber<N, ValueType>;
+  };
+
+}  // end of namespace tfel::math
+
+namespace tfel::math::ieee754 {
+
+  template <unsigned short N, typename ValueType>
+  constexpr int fpclassify(const DualNumber<N, ValueType>& x) noexcept {
+    return fpclassify(x.v);
+  }
+  template <unsigned short N, typename ValueType>
+  constexpr bool isnan(const DualNumber<N, ValueType>& x) noexcept {
+    return isnan(x.v);
+  }
+  template <unsigned short N, typename ValueType>
+  constexpr bool isfinite(const DualNumber<N, ValueType>& x) noexcept {
+    return isfinite(x.v);
+  }
+
+}  // end of namespace tfel::math::ieee754
+
+namespace tfel::typetraits {
+
+  template <unsigned short N, typename ValueType>
+  struct Promote<tfel::math::DualNumber<N, ValueType>,
+                 tfel::math::DualNumber<N, ValueType>> {
+    using type = tfel::math::DualNumber<N, ValueType>;
+  };
+  template <unsigned short N, typename ValueType, typename T>
+  requires(std::is_arithmetic_v<T>)  //
+      struct Promote<tfel::math::DualNumber<N, ValueType>, T> {
+    using type = tfel::math::DualNumber<N, ValueType>;
+  };
+  template <unsigned short N, typename ValueType, typename T>
+  requires(std::is_arithmetic_v<T>)  //
+      struct Promote<T, tfel::math::DualNumber<N, ValueType>> {
+    using type = tfel::math::DualNumber<N, ValueType>;
+  };
+  template <unsigned short N, typename ValueType>
+  struct IsScalar<tfel::math::DualNumber<N, ValueType>> {
+    static constexpr bool cond = true;
+  };
+  template <unsigned short N, typename ValueType>
+  struct IsReal<tfel::math::DualNumber<N, ValueType>> {
+    static constexpr bool cond = true;
+  };
+  template <unsigned short N, typename ValueType>
+  struct IsComplex<tfel::math::DualNumber<N, ValueType>> {
+    static constexpr bool cond = false;
+  };
+  template <unsigned short N, typename ValueType>
+  struct IsAssignableTo<tfel::math::DualNumber<N, ValueType>,
+                        tfel::math::DualNumber<N, ValueType>> {
+    static constexpr bool value = true;
+    static constexpr bool cond = true;
+  };
+  template <unsigned short N, typename ValueType, typename T>
+  requires(std::is_arithmetic_v<T>)  //
+      struct IsAssignableTo<T, tfel::math::DualNumber<N, ValueType>> {
+    static constexpr bool value = true;
+    static constexpr bool cond = true;
+  };
+  template <unsigned short N, typename ValueType>
+  struct IsFundamentalNumericType<tfel::math::DualNumber<N, ValueType>> {
+    static constexpr bool cond = true;
+  };
+  template <unsigned short N, typename ValueType>
+  struct AbsType<tfel::math::DualNumber<N, ValueType>> {
+    using type = tfel::math::DualNumber<N, ValueType>;
+  };
+  template <unsigned short N, typename ValueType>
+  struct RealPartType<tfel::math::DualNumber<N, ValueType>> {
+    using type = tfel::math::DualNumber<N, ValueType>;
+  };
+  template <unsigned short N, typename ValueType>
+  struct BaseType<tfel::math::DualNumber<N, ValueType>> {
+    using type = tfel::math::DualNumber<N, ValueType>;
+  };
+
+}  // end of namespace tfel::typetraits
+
+namespace std {
+
+  //! \brief partial specialisation for dual numbers
+  template <unsigned short N, typename ValueType>
+  class numeric_limits<tfel::math::DualNumber<N, ValueType>>
+      : public numeric_limits<ValueType> {};
+
+}  // end of namespace std
+
+#endif /* LIB_TFEL_MATH_DUALNUMBER_HXX */
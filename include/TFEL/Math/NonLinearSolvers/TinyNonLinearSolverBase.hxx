@@ -14,6 +14,7 @@
 #ifndef LIB_TFEL_MATH_NONLINEARSOLVERS_TINYNONLINEARSOLVERBASE_HXX
 #define LIB_TFEL_MATH_NONLINEARSOLVERS_TINYNONLINEARSOLVERBASE_HXX
 
+#include "TFEL/TypeTraits/IsReal.hxx"
 #include "TFEL/Math/tvector.hxx"
 #include "TFEL/Math/tmatrix.hxx"
 
@@ -88,7 +89,7 @@ namespace tfel::math {
   struct TinyNonLinearSolverBase : public ExternalWorkSpace<N, NumericType> {
     //
     static_assert(N != 0, "invalid size");
-    static_assert(std::is_floating_point_v<NumericType>,
+    static_assert(tfel::typetraits::IsReal<NumericType>::cond,
                   "invalid numeric type");
     //! \brief a simple alias
     using iteration_number_type = unsigned short;
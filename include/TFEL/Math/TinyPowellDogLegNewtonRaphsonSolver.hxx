@@ -63,7 +63,7 @@ namespace tfel::math {
       : TinyNonLinearSolverBase<N, NumericType, Child, ExternalWorkSpace> {
     //
     static_assert(N != 0, "invalid size");
-    static_assert(std::is_floating_point_v<NumericType>,
+    static_assert(tfel::typetraits::IsReal<NumericType>::cond,
                   "invalid numeric type");
     //! \brief default constructor
     TinyPowellDogLegNewtonRaphsonSolver() = default;
@@ -248,6 +248,12 @@ namespace tfel::system {
     bool computesInternalEnergy = false;
     //! \brief if true, the behaviour may compute the dissipated energy
     bool computesDissipatedEnergy = false;
+    /*!
+     * \brief if true, the behaviour provides a function integrating a batch
+     * of integration points (only meaningful for behaviours generated
+     * through the `generic` interface).
+     */
+    bool hasBatchIntegrationFunction = false;
     /*!
      * \brief If isUPUIR is true, the behaviour is usable in purely implicit
      * resolution.
@@ -72,6 +72,8 @@ typedef mfront_gmp_MaterialPropertyPtr GenericMaterialPropertyPtr;
 
 // forward declaration
 typedef struct mfront_gb_BehaviourData mfront_gb_BehaviourData;
+// forward declaration
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
 
 #ifdef __cplusplus
 }
@@ -367,6 +369,34 @@ namespace tfel::system {
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourFctPtr)(
       ::mfront_gb_BehaviourData *const);
   //! \brief a simple alias.
+  typedef int(TFEL_ADDCALL_PTR GenericBehaviourBatchIntegrationFctPtr)(
+      ::mfront_gb_BatchBehaviourData *const);
+  //! \brief a simple alias.
+  typedef ::mfront_gb_ParametersSet *(
+      TFEL_ADDCALL_PTR GenericBehaviourCreateParametersSetFctPtr)();
+  //! \brief a simple alias.
+  typedef ::mfront_gb_ParametersSet *(
+      TFEL_ADDCALL_PTR GenericBehaviourCopyParametersSetFctPtr)(
+      const ::mfront_gb_ParametersSet *const);
+  //! \brief a simple alias.
+  typedef int(
+      TFEL_ADDCALL_PTR GenericBehaviourSetParameterInParametersSetFctPtr)(
+      ::mfront_gb_ParametersSet *const, const char *const, const double);
+  //! \brief a simple alias.
+  typedef int(TFEL_ADDCALL_PTR
+                  GenericBehaviourSetIntegerParameterInParametersSetFctPtr)(
+      ::mfront_gb_ParametersSet *const, const char *const, const int);
+  //! \brief a simple alias.
+  typedef int(
+      TFEL_ADDCALL_PTR
+          GenericBehaviourSetUnsignedShortParameterInParametersSetFctPtr)(
+      ::mfront_gb_ParametersSet *const,
+      const char *const,
+      const unsigned short);
+  //! \brief a simple alias.
+  typedef void(TFEL_ADDCALL_PTR GenericBehaviourDestroyParametersSetFctPtr)(
+      ::mfront_gb_ParametersSet *const);
+  //! \brief a simple alias.
   typedef int(TFEL_ADDCALL_PTR GenericBehaviourInitializeFunctionPtr)(
       ::mfront_gb_BehaviourData *const, const ::mfront_gb_real *const);
   //! \brief a simple alias.
@@ -572,6 +572,78 @@ namespace tfel::system {
      */
     GenericBehaviourFctPtr getGenericBehaviourFunction(const std::string&,
                                                        const std::string&);
+    /*!
+     * \return true if the behaviour provides a function integrating a batch
+     * of integration points.
+     * \param[in] l: name of the library
+     * \param[in] f: behaviour name
+     * \param[in] h: modelling hypothesis
+     */
+    bool hasGenericBehaviourBatchIntegrationFunction(const std::string&,
+                                                     const std::string&,
+                                                     const std::string&);
+    /*!
+     * \return the function integrating a batch of integration points.
+     * \param[in] l: name of the library
+     * \param[in] f: function name, i.e. the name of the function
+     * integrating one integration point.
+     */
+    GenericBehaviourBatchIntegrationFctPtr
+    getGenericBehaviourBatchIntegrationFunction(const std::string&,
+                                                const std::string&);
+    /*!
+     * \return the function creating a new set of parameters initialized
+     * with the current values of the parameters of a behaviour generated
+     * through the `generic` interface.
+     * \param[in] l: name of the library
+     * \param[in] b: behaviour name
+     */
+    GenericBehaviourCreateParametersSetFctPtr
+    getGenericBehaviourCreateParametersSetFunction(const std::string&,
+                                                   const std::string&);
+    /*!
+     * \return the function copying a set of parameters.
+     * \param[in] l: name of the library
+     * \param[in] b: behaviour name
+     */
+    GenericBehaviourCopyParametersSetFctPtr
+    getGenericBehaviourCopyParametersSetFunction(const std::string&,
+                                                 const std::string&);
+    /*!
+     * \return the function modifying a floating point parameter in a set of
+     * parameters.
+     * \param[in] l: name of the library
+     * \param[in] b: behaviour name
+     */
+    GenericBehaviourSetParameterInParametersSetFctPtr
+    getGenericBehaviourSetParameterInParametersSetFunction(const std::string&,
+                                                           const std::string&);
+    /*!
+     * \return the function modifying an integer parameter in a set of
+     * parameters.
+     * \param[in] l: name of the library
+     * \param[in] b: behaviour name
+     */
+    GenericBehaviourSetIntegerParameterInParametersSetFctPtr
+    getGenericBehaviourSetIntegerParameterInParametersSetFunction(
+        const std::string&, const std::string&);
+    /*!
+     * \return the function modifying an unsigned short parameter in a set of
+     * parameters.
+     * \param[in] l: name of the library
+     * \param[in] b: behaviour name
+     */
+    GenericBehaviourSetUnsignedShortParameterInParametersSetFctPtr
+    getGenericBehaviourSetUnsignedShortParameterInParametersSetFunction(
+        const std::string&, const std::string&);
+    /*!
+     * \return the function destroying a set of parameters.
+     * \param[in] l: name of the library
+     * \param[in] b: behaviour name
+     */
+    GenericBehaviourDestroyParametersSetFctPtr
+    getGenericBehaviourDestroyParametersSetFunction(const std::string&,
+                                                    const std::string&);
     /*!
      * \return the post-processings associated with a behaviour generated
      * through the `generic` interface.
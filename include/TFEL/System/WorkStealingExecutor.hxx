@@ -0,0 +1,169 @@
+/*!
+ * \file   include/TFEL/System/WorkStealingExecutor.hxx
+ * \brief  This file declares the `WorkStealingExecutor` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_SYSTEM_WORKSTEALINGEXECUTOR_HXX
+#define LIB_TFEL_SYSTEM_WORKSTEALINGEXECUTOR_HXX
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <condition_variable>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::system {
+
+  /*!
+   * \brief a fixed-size pool of threads dedicated to the parallel
+   * execution of loops over a range of indices.
+   *
+   * The range is split in as many contiguous sub-ranges as threads. Each
+   * thread processes its own sub-range by chunks of `grain_size`
+   * indices and then steals chunks from the sub-ranges of the other
+   * threads. Chunks are obtained by an atomic increment, so no lock is
+   * taken and no memory is allocated during the execution of a loop.
+   *
+   * The calling thread takes part in the execution of the loop. If the
+   * executor is already busy (nested calls or concurrent calls from
+   * different threads), the loop is executed sequentially by the calling
+   * thread.
+   */
+  struct TFELSYSTEM_VISIBILITY_EXPORT WorkStealingExecutor {
+    //! \brief a simple alias
+    using size_type = std::size_t;
+    //! \brief options of the executor
+    struct Options {
+      //! \brief number of threads, including the calling thread
+      size_type number_of_threads = 1;
+      /*!
+       * \brief number of indices treated at once by a thread. If null,
+       * the grain size is chosen so that each thread treats about 8
+       * chunks.
+       */
+      size_type grain_size = 0;
+      //! \brief if true, each worker thread is bound to a core
+      bool pin_threads = false;
+    };
+    /*!
+     * \return the options of an executor from the following
+     * environment variables:
+     *
+     * - `<prefix>_NTHREADS`: number of threads
+     * - `<prefix>_GRAIN_SIZE`: grain size
+     * - `<prefix>_PIN_THREADS`: pin the threads if equal to `true`
+     *
+     * \param[in] prefix: prefix of the environment variables
+     * \param[in] n: default number of threads
+     */
+    static Options getOptionsFromEnvironment(const std::string&,
+                                             const size_type);
+    /*!
+     * \brief constructor
+     * \param[in] n: number of threads, including the calling thread
+     */
+    explicit WorkStealingExecutor(const size_type);
+    /*!
+     * \brief constructor
+     * \param[in] o: options
+     */
+    explicit WorkStealingExecutor(const Options&);
+    //! \return the number of threads, including the calling thread
+    size_type getNumberOfThreads() const noexcept;
+    /*!
+     * \brief call `f(i)` for each index `i` in `[b, e[`
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     * \param[in] f: function
+     *
+     * \note the first exception thrown by `f`, if any, is rethrown once
+     * all threads are done.
+     */
+    template <typename F>
+    void parallel_for(const size_type, const size_type, F&&);
+    /*!
+     * \brief call `f(cb, ce)` for each chunk `[cb, ce[` of `[b, e[`
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     * \param[in] f: function
+     */
+    template <typename F>
+    void parallel_for_chunks(const size_type, const size_type, F&&);
+    //! \brief destructor
+    ~WorkStealingExecutor();
+
+   private:
+    //! \brief type erased function treating a chunk
+    using Kernel = void (*)(void* const, const size_type, const size_type);
+    //! \brief sub-range of indices associated with a thread
+    struct alignas(64) Range {
+      //! \brief next index to be treated
+      std::atomic<size_type> next{0};
+      //! \brief past-the-end index
+      size_type end = 0;
+    };
+    /*!
+     * \brief execute the given kernel on `[b, e[`
+     * \param[in] b: first index
+     * \param[in] e: past-the-end index
+     * \param[in] k: kernel
+     * \param[in] d: data passed to the kernel
+     */
+    void execute(const size_type, const size_type, Kernel, void* const);
+    /*!
+     * \brief treat the chunks of all ranges, starting with the range
+     * associated with the given thread.
+     * \param[in] i: thread index
+     */
+    void work(const size_type) noexcept;
+    //! \brief main loop of the worker threads
+    void loop(const size_type) noexcept;
+    //! \brief options
+    const Options options;
+    //! \brief sub-ranges
+    std::unique_ptr<Range[]> ranges;
+    //! \brief worker threads
+    std::vector<std::thread> workers;
+    //! \brief current kernel
+    Kernel kernel = nullptr;
+    //! \brief data passed to the current kernel
+    void* data = nullptr;
+    //! \brief grain size of the current execution
+    size_type grain = 1;
+    //! \brief mutex protecting the following members
+    std::mutex m;
+    //! \brief condition variable used to start the worker threads
+    std::condition_variable start;
+    //! \brief condition variable used to signal the end of the execution
+    std::condition_variable end;
+    //! \brief execution counter
+    std::uint64_t generation = 0;
+    //! \brief number of worker threads still working
+    size_type active = 0;
+    //! \brief first exception thrown by the kernel
+    std::exception_ptr exception;
+    //! \brief flag stating if the executor is in use
+    std::atomic<bool> busy{false};
+    //! \brief flag used to stop the worker threads
+    bool stop = false;
+  };  // end of struct WorkStealingExecutor
+
+}  // end of namespace tfel::system
+
+#include "TFEL/System/WorkStealingExecutor.ixx"
+
+#endif /* LIB_TFEL_SYSTEM_WORKSTEALINGEXECUTOR_HXX */
@@ -0,0 +1,53 @@
+/*!
+ * \file   include/TFEL/System/WorkStealingExecutor.ixx
+ * \brief  This file implements the template methods of the
+ * `WorkStealingExecutor` class.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_SYSTEM_WORKSTEALINGEXECUTOR_IXX
+#define LIB_TFEL_SYSTEM_WORKSTEALINGEXECUTOR_IXX
+
+#include <memory>
+#include <type_traits>
+
+namespace tfel::system {
+
+  template <typename F>
+  void WorkStealingExecutor::parallel_for(const size_type b,
+                                          const size_type e,
+                                          F&& f) {
+    using Function = std::remove_reference_t<F>;
+    auto k = [](void* const d, const size_type cb, const size_type ce) {
+      auto& fct = *(static_cast<Function*>(d));
+      for (auto i = cb; i != ce; ++i) {
+        fct(i);
+      }
+    };
+    this->execute(b, e, k,
+                  const_cast<void*>(static_cast<const void*>(&f)));
+  }  // end of parallel_for
+
+  template <typename F>
+  void WorkStealingExecutor::parallel_for_chunks(const size_type b,
+                                                 const size_type e,
+                                                 F&& f) {
+    using Function = std::remove_reference_t<F>;
+    auto k = [](void* const d, const size_type cb, const size_type ce) {
+      auto& fct = *(static_cast<Function*>(d));
+      fct(cb, ce);
+    };
+    this->execute(b, e, k,
+                  const_cast<void*>(static_cast<const void*>(&f)));
+  }  // end of parallel_for_chunks
+
+}  // end of namespace tfel::system
+
+#endif /* LIB_TFEL_SYSTEM_WORKSTEALINGEXECUTOR_IXX */
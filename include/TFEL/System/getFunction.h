@@ -110,6 +110,86 @@ double(TFEL_ADDCALL_PTR tfel_getGenericMaterialProperty(
 int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourFunction(LibraryHandlerPtr,
                                                       const char* const))(
     struct mfront_gb_BehaviourData* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * integrating a batch of integration points.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR tfel_getGenericBehaviourBatchIntegrationFunction(
+    LibraryHandlerPtr, const char* const))(
+    struct mfront_gb_BatchBehaviourData* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * creating a new set of parameters.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+mfront_gb_ParametersSet*(
+    TFEL_ADDCALL_PTR tfel_getGenericBehaviourCreateParametersSetFunction(
+        LibraryHandlerPtr, const char* const))(void);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * copying a set of parameters.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+mfront_gb_ParametersSet*(
+    TFEL_ADDCALL_PTR tfel_getGenericBehaviourCopyParametersSetFunction(
+        LibraryHandlerPtr,
+        const char* const))(const mfront_gb_ParametersSet* const);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * modifying a floating point parameter in a set of parameters.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR
+        tfel_getGenericBehaviourSetParameterInParametersSetFunction(
+            LibraryHandlerPtr, const char* const))(
+    mfront_gb_ParametersSet* const, const char* const, const double);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * modifying an integer parameter in a set of parameters.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR
+        tfel_getGenericBehaviourSetIntegerParameterInParametersSetFunction(
+            LibraryHandlerPtr, const char* const))(
+    mfront_gb_ParametersSet* const, const char* const, const int);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * modifying an unsigned short parameter in a set of parameters.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+int(TFEL_ADDCALL_PTR
+    tfel_getGenericBehaviourSetUnsignedShortParameterInParametersSetFunction(
+        LibraryHandlerPtr, const char* const))(
+    mfront_gb_ParametersSet* const, const char* const, const unsigned short);
+/*!
+ * \brief return a function generated by the generic behaviour interface
+ * destroying a set of parameters.
+ * \param l: library handler
+ * \param f: function name
+ * \return the searched function pointer if the call succeed, the NULL pointer
+ * if not.
+ */
+void(TFEL_ADDCALL_PTR tfel_getGenericBehaviourDestroyParametersSetFunction(
+    LibraryHandlerPtr, const char* const))(mfront_gb_ParametersSet* const);
 /*!
  * \brief return a function generated by the generic behaviour interface
  * associated with an initialize functions.
@@ -0,0 +1,133 @@
+/*!
+ * \file   include/TFEL/Utilities/BinaryColumnarFile.hxx
+ * \brief  This file declares classes and functions used to write and read
+ * binary columnar files.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_TFEL_UTILITIES_BINARYCOLUMNARFILE_HXX
+#define LIB_TFEL_UTILITIES_BINARYCOLUMNARFILE_HXX
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstddef>
+#include "TFEL/Config/TFELConfig.hxx"
+
+namespace tfel::utilities {
+
+  /*!
+   * \brief a class writing tabular data in a binary columnar file.
+   *
+   * A binary columnar file is made of:
+   *
+   * - a header giving the names of the columns and the size of the
+   *   floating point values (4 or 8 bytes).
+   * - a list of chunks. Each chunk begins with its number of rows, followed
+   *   by the values of each column.
+   *
+   * Chunks are only appended, so a file can be read while it is written:
+   * the last chunk is ignored if it is incomplete. Values are stored in
+   * the native byte order of the writer.
+   */
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryColumnarFileWriter {
+    //! \brief options used to write the file
+    struct Options {
+      //! \brief if true, values are converted to single precision
+      bool use_single_precision = false;
+      //! \brief number of rows stored in memory before writing a chunk
+      std::size_t chunk_size = 1024;
+    };
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] n: names of the columns
+     */
+    BinaryColumnarFileWriter(const std::string&,
+                             const std::vector<std::string>&);
+    /*!
+     * \brief constructor
+     * \param[in] f: file name
+     * \param[in] n: names of the columns
+     * \param[in] o: options
+     */
+    BinaryColumnarFileWriter(const std::string&,
+                             const std::vector<std::string>&,
+                             const Options&);
+    //! \return the number of columns
+    std::size_t getNumberOfColumns() const;
+    /*!
+     * \brief add a value to the current row
+     * \param[in] v: value
+     */
+    void write(const double);
+    /*!
+     * \brief end the current row
+     * \note an exception is thrown if the number of values given does
+     * not match the number of columns
+     */
+    void endRow();
+    //! \brief write the rows stored in memory as a new chunk
+    void flush();
+    //! \brief destructor
+    ~BinaryColumnarFileWriter();
+
+   private:
+    BinaryColumnarFileWriter(BinaryColumnarFileWriter&&) = delete;
+    BinaryColumnarFileWriter(const BinaryColumnarFileWriter&) = delete;
+    BinaryColumnarFileWriter& operator=(BinaryColumnarFileWriter&&) = delete;
+    BinaryColumnarFileWriter& operator=(const BinaryColumnarFileWriter&) =
+        delete;
+    //! \brief output file
+    std::ofstream out;
+    //! \brief values of the current chunk, stored by columns
+    std::vector<double> buffer;
+    //! \brief options
+    Options options;
+    //! \brief number of columns
+    std::size_t ncolumns;
+    //! \brief number of rows in the current chunk
+    std::size_t nrows = 0;
+    //! \brief index of the next value in the current row
+    std::size_t position = 0;
+  };  // end of struct BinaryColumnarFileWriter
+
+  //! \brief data read in a binary columnar file
+  struct TFELUTILITIES_VISIBILITY_EXPORT BinaryColumnarData {
+    //! \brief names of the columns
+    std::vector<std::string> names;
+    //! \brief values of the columns
+    std::vector<std::vector<double>> columns;
+    //! \brief size of the floating point values stored in the file
+    std::size_t value_size = sizeof(double);
+    /*!
+     * \return the column with the given name
+     * \param[in] n: name of the column
+     */
+    const std::vector<double>& getColumn(const std::string&) const;
+  };  // end of struct BinaryColumnarData
+
+  /*!
+   * \return true if the given file is a binary columnar file
+   * \param[in] f: file name
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT bool isBinaryColumnarFile(
+      const std::string&);
+  /*!
+   * \return the data stored in a binary columnar file. Values stored in
+   * single precision are converted to double precision.
+   * \param[in] f: file name
+   */
+  TFELUTILITIES_VISIBILITY_EXPORT BinaryColumnarData
+  readBinaryColumnarFile(const std::string&);
+
+}  // end of namespace tfel::utilities
+
+#endif /* LIB_TFEL_UTILITIES_BINARYCOLUMNARFILE_HXX */
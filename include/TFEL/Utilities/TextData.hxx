@@ -51,6 +51,11 @@ namespace tfel::utilities {
      *   the behaviour of gnuplot when the following command is
      *   used:
      *   set key autotitle columnhead
+     *
+     * Binary columnar files (see `BinaryColumnarFileWriter`) are
+     * detected automatically, whatever the format specified. In this
+     * case, the legends are the names of the columns and the values
+     * are not stored as lines: `begin` and `end` return an empty range.
      */
     TextData(const std::string&, const std::string& = "");
     /*!
@@ -114,6 +119,8 @@ namespace tfel::utilities {
     TextData& operator=(const TextData&) = delete;
     //! list of all tokens of the file, sorted by line
     std::vector<Line> lines;
+    //! values of the columns, if the file is a binary columnar file
+    std::vector<std::vector<double>> columns;
     //! list of column titles
     std::vector<std::string> legends;
     //! first commented lines
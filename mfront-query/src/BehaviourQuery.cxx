@@ -259,6 +259,13 @@ namespace mfront {
         {"--integration-variables",
          "show the list of integration variables for the selected modelling "
          "hypothesis"},
+        {"--written-jacobian-blocks",
+         "show the list of the jacobian blocks which may be written during "
+         "the evaluation of the implicit system for the selected modelling "
+         "hypothesis"},
+        {"--jacobian-linear-solver",
+         "show how the linear systems arising at each iteration of the "
+         "implicit scheme are solved for the selected modelling hypothesis"},
         {"--persistent-variables",
          "show the list of persistent variables for the selected modelling "
          "hypothesis"},
@@ -842,6 +849,36 @@ namespace mfront {
           "integration-state-variables",
           this->generateVariablesListQuery<
               &BehaviourData::getIntegrationVariables>());
+    } else if (qn == "--written-jacobian-blocks") {
+      this->queries.push_back(
+          {"written-jacobian-blocks",
+           [](const FileDescription&, const BehaviourDescription& d,
+              const Hypothesis h) {
+             const auto blocks = d.getAttribute<std::vector<std::string>>(
+                 h, BehaviourData::writtenJacobianBlocks, {});
+             for (const auto& b : blocks) {
+               cout << b << " ";
+             }
+             cout << '\n';
+           }});
+    } else if (qn == "--jacobian-linear-solver") {
+      this->queries.push_back(
+          {"jacobian-linear-solver",
+           [](const FileDescription&, const BehaviourDescription& d,
+              const Hypothesis h) {
+             const auto a = BehaviourData::jacobianBlockEliminationVariable;
+             if (!d.hasAttribute(h, a)) {
+               cout << "none\n";
+               return;
+             }
+             const auto& v = d.getAttribute<std::string>(h, a);
+             if (v.empty()) {
+               cout << "dense LU decomposition\n";
+             } else {
+               cout << "block elimination (Schur complement on the block "
+                    << "associated with '" << v << "')\n";
+             }
+           }});
     } else if (qn == "--persistent-variables") {
       this->queries.emplace_back("persistent-state-variables",
                                  this->generateVariablesListQuery<
@@ -141,6 +141,16 @@ namespace mfront {
     virtual void writeBehaviourConstructorBody(std::ostream &,
                                                const BehaviourDescription &,
                                                const Hypothesis) const = 0;
+    /*!
+     * \return an expression giving the parameters initializer used by the
+     * behaviour constructor associated with the interface to initialize the
+     * parameters. An empty string means that the global parameters
+     * initializer is used.
+     * \param[in] mb: behaviour description
+     * \param[in] h:  modelling hypothesis
+     */
+    virtual std::string getBehaviourConstructorParametersInitializer(
+        const BehaviourDescription &, const Hypothesis) const;
 
     virtual void writeBehaviourDataConstructor(
         std::ostream &,
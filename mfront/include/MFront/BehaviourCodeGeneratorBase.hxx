@@ -77,6 +77,19 @@ namespace mfront {
      * state variables
      */
     virtual bool usesStateVariableTimeDerivative() const;
+    /*!
+     * \brief return if the data structures and the behaviour class must
+     * provide constructors from the same classes instantiated with another
+     * numeric type.
+     *
+     * Those constructors are used, for example, to instantiate a copy of the
+     * behaviour based on dual numbers in order to compute the jacobian of
+     * the implicit system by automatic differentiation.
+     *
+     * \param[in] h: modelling hypothesis
+     */
+    virtual bool requiresNumericTypeConversionConstructors(
+        const Hypothesis) const;
     /*!
      * write the given variable declaration
      * \param[out] f                 : output file
@@ -517,8 +530,17 @@ namespace mfront {
     virtual void writeBehaviourLocalVariablesInitialisation(
         std::ostream&, const Hypothesis) const;
 
-    virtual void writeBehaviourParameterInitialisation(std::ostream&,
-                                                       const Hypothesis) const;
+    /*!
+     * \brief write the initialisation of the parameters in the constructors
+     * of the behaviour
+     * \param[out] os: output stream
+     * \param[in] h: modelling hypothesis
+     * \param[in] pi: expression giving the parameters initializer associated
+     * with the default hypothesis. If empty, the values of the parameters are
+     * read from the global parameters initializer.
+     */
+    virtual void writeBehaviourParameterInitialisation(
+        std::ostream&, const Hypothesis, const std::string&) const;
 
     virtual void writeBehaviourParametersInitializers(std::ostream&) const;
 
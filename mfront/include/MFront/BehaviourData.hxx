@@ -50,6 +50,12 @@ namespace mfront {
     static const char* const UserDefinedInitializeCodeBlock;
     //! \brief standard code name
     static const char* const FlowRule;
+    /*!
+     * \brief standard code name. This code block contains the flow rule
+     * written so that it can be evaluated on each integration point of a
+     * batch of integration points.
+     */
+    static const char* const VectorizedFlowRule;
     //! \brief standard code name
     static const char* const BeforeInitializeLocalVariables;
     //! \brief standard code name
@@ -143,6 +149,23 @@ namespace mfront {
     static const char* const compareToNumericalJacobian;
     //! list of jacobian blocks that must be computed numerically
     static const char* const numericallyComputedJacobianBlocks;
+    //! if this attribute is true, the jacobian blocks that are not given
+    //! by the user are computed by automatic differentiation rather than
+    //! by finite differences
+    static const char* const automaticDifferentiationOfTheJacobian;
+    //! list of the jacobian blocks that may be written during the
+    //! evaluation of the implicit system
+    static const char* const writtenJacobianBlocks;
+    //! name of the integration variable on which the Schur complement is
+    //! built when the linear systems arising at each Newton iteration are
+    //! solved by block elimination. An empty string denotes a dense LU
+    //! decomposition.
+    static const char* const jacobianBlockEliminationVariable;
+    //! if this attribute is true, the increments of the integration
+    //! variables converged at the previous time step, scaled by the ratio
+    //! of the time increments, are used as the initial guess of the
+    //! implicit scheme
+    static const char* const warmStart;
     /*!
      * a boolean attribute telling if the additionnal variables can be
      * declared. This attribute is set by DSL's when the first code
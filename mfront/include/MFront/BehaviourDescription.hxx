@@ -66,6 +66,15 @@ namespace mfront {
     static const char* const modellingHypothesis;
     //! \brief standard option
     static const char* const modellingHypotheses;
+    /*!
+     * \brief option and attribute stating that the Newton algorithm
+     * used to integrate the behaviour shall be vectorized over a batch of
+     * integration points.
+     *
+     * \note this option is only supported by a few domain specific languages
+     * and is silently ignored if the behaviour can't be integrated that way.
+     */
+    static const char* const vectorizedBatchIntegration;
     //! \brief a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! \brief a simple alias
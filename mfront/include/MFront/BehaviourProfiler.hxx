@@ -19,24 +19,81 @@
 #define MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER const
 #else
 #define MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER constexpr const
-#include <time.h>
 #endif
 
 #include "MFront/MFrontConfig.hxx"
 
 #include <array>
-#include <atomic>
+#include <mutex>
+#include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <iosfwd>
 
 namespace mfront {
 
   /*!
    * structure in charge of performance measurements in mechanical
    * behaviour
+   *
+   * Measurements are stored in per-thread statistics, which are merged
+   * when the profiler is destroyed. For each code block, the number of
+   * calls, the total time and a log-scale histogram of the time spent
+   * per call are recorded.
+   *
+   * The following environment variables are taken into account:
+   *
+   * - `MFRONT_PROFILING_CLOCK`: if set to `tsc`, the time stamp counter
+   *   of the processor is used rather than the CPU time of the calling
+   *   thread (this option is ignored on processors which do not provide
+   *   such a counter). The time stamp counter is cheaper to read but
+   *   measures the elapsed time.
+   * - `MFRONT_PROFILING_OUTPUT_FILE`: name of a file in which the
+   *   results of all the profilers are exported at exit. The `CSV`
+   *   format is used if the file name ends with `.csv`, the `JSON`
+   *   format otherwise.
    */
   struct MFRONTPROFILING_VISIBILITY_EXPORT BehaviourProfiler {
     //! a simple alias
     using index_type = unsigned short;
+    //! \brief number of code blocks
+    static MFRONTBEHAVIOURPROFILER_CONST_QUALIFIER index_type
+        numberOfCodeBlocks = 23;
+    /*!
+     * \brief statistics of a measured quantity.
+     *
+     * The `i`th bin of the histogram counts the values `v` such that
+     * \f$2^{i-1}\leq v<2^{i}\f$ (the first bin counts null values).
+     */
+    struct MFRONTPROFILING_VISIBILITY_EXPORT Statistics {
+      //! \brief add a new value
+      void add(const std::uint64_t) noexcept;
+      //! \brief merge the given statistics
+      void merge(const Statistics&) noexcept;
+      //! \return the index of the bin associated with the given value
+      static index_type getBinIndex(const std::uint64_t) noexcept;
+      //! \brief number of values
+      std::uint64_t count = 0;
+      //! \brief sum of the values
+      std::uint64_t total = 0;
+      //! \brief histogram
+      std::array<std::uint64_t, 65> histogram = {};
+    };  // end of struct Statistics
+    //! \brief statistics gathered by a thread
+    struct alignas(64) ThreadStatistics {
+      //! \brief time spent in each code block (nanoseconds)
+      std::array<Statistics, numberOfCodeBlocks> code_blocks;
+      //! \brief number of iterations of the non linear solver per call
+      Statistics iterations;
+      /*!
+       * \brief number of iterations of the non linear solver per call, for
+       * the calls whose initial guess was given by the increments of the
+       * previous time step (see the `@WarmStart` keyword). Those calls are
+       * also taken into account in `iterations`.
+       */
+      Statistics warm_started_iterations;
+    };  // end of struct ThreadStatistics
     /*!
      * a timer for a specicied code block.
      * This descructor will increase the time count for the code block.
@@ -55,22 +112,62 @@ namespace mfront {
       Timer(Timer&&) = default;
       Timer& operator=(const Timer&) = delete;
       Timer& operator=(Timer&&) = delete;
-      //! timer to which the results are reported
-      BehaviourProfiler& gtimer;
+      //! statistics to which the results are reported
+      ThreadStatistics& statistics;
       //! code block associated with the timer
       const index_type c;
-#if !(defined _WIN32 || defined _WIN64)
       //! start
-      timespec start;
-      //! end
-      timespec end;
-#endif
+      std::uint64_t start;
     };  // end of struct Timer
     /*!
      * constructor
      * \param[in] n : behaviour name
      */
     explicit BehaviourProfiler(const std::string&);
+    /*!
+     * \brief report the number of iterations of the non linear solver
+     * performed during a call to the behaviour integration
+     * \param[in] n: number of iterations
+     */
+    void addNumberOfIterations(const std::uint64_t);
+    /*!
+     * \brief report the number of iterations of the non linear solver
+     * performed during a call to the behaviour integration whose initial
+     * guess was given by the increments of the previous time step
+     * \param[in] n: number of iterations
+     */
+    void addNumberOfWarmStartedIterations(const std::uint64_t);
+    /*!
+     * \return an estimate of the number of iterations saved by the warm
+     * start of the non linear solver, i.e. the difference between the
+     * number of iterations that the warm started calls would have required
+     * using the mean number of iterations of the other calls and the
+     * number of iterations that they actually required. This estimate is
+     * null if all calls were warm started.
+     * \param[in] s: statistics
+     */
+    static double getEstimatedNumberOfSavedIterations(
+        const ThreadStatistics&) noexcept;
+    //! \return the statistics of all the threads, merged
+    ThreadStatistics getStatistics() const;
+    /*!
+     * \brief export the given results in the `JSON` format
+     * \param[out] os: output stream
+     * \param[in] r: name of the behaviours and associated statistics
+     */
+    static void exportToJSON(
+        std::ostream&,
+        const std::vector<std::pair<std::string, ThreadStatistics>>&);
+    /*!
+     * \brief export the given results in the `CSV` format
+     * \param[out] os: output stream
+     * \param[in] r: name of the behaviours and associated statistics
+     */
+    static void exportToCSV(
+        std::ostream&,
+        const std::vector<std::pair<std::string, ThreadStatistics>>&);
+    //! \return the name of the given code block
+    static std::string getCodeBlockName(const index_type);
     /*
      * \see MechanialBehaviourData for a description
      */
@@ -141,10 +238,16 @@ namespace mfront {
     ~BehaviourProfiler();
 
    protected:
+    //! \return the statistics associated with the calling thread
+    ThreadStatistics& getThreadStatistics();
     //! name of the behaviour
     const std::string name;
-    //! time spend in each code block (nanoseconds)
-    std::array<std::atomic<intmax_t>, 23> measures;
+    //! \brief unique identifier of the profiler
+    const std::size_t identifier;
+    //! \brief mutex used to register the statistics of a new thread
+    mutable std::mutex m;
+    //! \brief statistics of each thread
+    std::vector<std::unique_ptr<ThreadStatistics>> statistics;
   };  // end of BehaviourProfiler
 
 }  // end of namespace mfront
@@ -94,6 +94,8 @@ namespace mfront {
      * \return true if a check bounds function is required
      */
     virtual bool requiresCheckBoundsFunction() const override;
+    //! \return true
+    bool shallGenerateArrayFunction() const override;
   };  // end of CMaterialPropertyInterface
 
 }  // end of namespace mfront
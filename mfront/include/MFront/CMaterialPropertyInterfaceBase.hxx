@@ -113,6 +113,14 @@ namespace mfront {
      * The default implementation of this method returns `false`.
      */
     virtual bool shallGenerateOverloadedFunctionForQuantities() const;
+    /*!
+     * \brief return if a function evaluating the material property on a set
+     * of points, named `<name>_array`, shall be generated. This function is
+     * only generated for material properties having at least one input.
+     *
+     * The default implementation of this method returns `false`.
+     */
+    virtual bool shallGenerateArrayFunction() const;
     /*!
      * \brief write the list of arguments
      * \param[out] os: output stream
@@ -147,6 +155,16 @@ namespace mfront {
         std::ostream&,
         const MaterialPropertyDescription&,
         const std::string_view) const;
+    /*!
+     * \brief write the function evaluating the material property on a set of
+     * points.
+     * \param[out] os: output stream
+     * \param[in] mpd: material property description
+     * \param[in] fd: file description
+     */
+    virtual void writeArrayFunction(std::ostream&,
+                                    const MaterialPropertyDescription&,
+                                    const FileDescription&) const;
     /*!
      * \param[out] os:  output file stream
      * \param[in] mpd : material property description
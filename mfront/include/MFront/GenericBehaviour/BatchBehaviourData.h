@@ -0,0 +1,192 @@
+/*!
+ * \file   include/MFront/GenericBehaviour/BatchBehaviourData.h
+ * \brief  This file declares the data structure used to integrate a
+ * behaviour on a batch of integration points in one call.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with linking exception
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+#define LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H
+
+#include "MFront/GenericBehaviour/Types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief state of a batch of integration points at the end of the time step.
+ *
+ * Each pointer refers to the values associated with the first integration
+ * point of the batch. The values associated with the `i`-th integration
+ * point are obtained by offsetting this pointer by `i` times the associated
+ * stride. A stride equal to zero means that all the integration points share
+ * the same values, which is convenient for uniform material properties or
+ * external state variables.
+ */
+typedef struct {
+  //! \brief values of the gradients
+  const mfront_gb_real* gradients;
+  //! \brief stride of the gradients
+  mfront_gb_size_type gradients_stride;
+  //! \brief values of the thermodynamic_forces
+  mfront_gb_real* thermodynamic_forces;
+  //! \brief stride of the thermodynamic forces
+  mfront_gb_size_type thermodynamic_forces_stride;
+  //! \brief volumetric mass density in the reference configuration
+  const mfront_gb_real* mass_density;
+  //! \brief stride of the volumetric mass density
+  mfront_gb_size_type mass_density_stride;
+  //! \brief values of the material properties
+  const mfront_gb_real* material_properties;
+  //! \brief stride of the material properties
+  mfront_gb_size_type material_properties_stride;
+  //! \brief values of the internal state variables
+  mfront_gb_real* internal_state_variables;
+  //! \brief stride of the internal state variables
+  mfront_gb_size_type internal_state_variables_stride;
+  //! \brief stored energy (optional)
+  mfront_gb_real* stored_energy;
+  //! \brief stride of the stored energy
+  mfront_gb_size_type stored_energy_stride;
+  //! \brief dissipated energy (optional)
+  mfront_gb_real* dissipated_energy;
+  //! \brief stride of the dissipated energy
+  mfront_gb_size_type dissipated_energy_stride;
+  //! \brief values of the external state variables
+  const mfront_gb_real* external_state_variables;
+  //! \brief stride of the external state variables
+  mfront_gb_size_type external_state_variables_stride;
+} mfront_gb_BatchState;
+
+/*!
+ * \brief state of a batch of integration points at the beginning of the time
+ * step. See `mfront_gb_BatchState` for the meaning of the strides.
+ */
+typedef struct {
+  //! \brief value of the gradients
+  const mfront_gb_real* gradients;
+  //! \brief stride of the gradients
+  mfront_gb_size_type gradients_stride;
+  //! \brief values of the thermodynamic_forces
+  const mfront_gb_real* thermodynamic_forces;
+  //! \brief stride of the thermodynamic forces
+  mfront_gb_size_type thermodynamic_forces_stride;
+  //! \brief volumetric mass density in the reference configuration
+  const mfront_gb_real* mass_density;
+  //! \brief stride of the volumetric mass density
+  mfront_gb_size_type mass_density_stride;
+  //! \brief values of the material properties
+  const mfront_gb_real* material_properties;
+  //! \brief stride of the material properties
+  mfront_gb_size_type material_properties_stride;
+  //! \brief values of the internal state variables
+  const mfront_gb_real* internal_state_variables;
+  //! \brief stride of the internal state variables
+  mfront_gb_size_type internal_state_variables_stride;
+  //! \brief stored energy (optional)
+  const mfront_gb_real* stored_energy;
+  //! \brief stride of the stored energy
+  mfront_gb_size_type stored_energy_stride;
+  //! \brief dissipated energy (optional)
+  const mfront_gb_real* dissipated_energy;
+  //! \brief stride of the dissipated energy
+  mfront_gb_size_type dissipated_energy_stride;
+  //! \brief values of the external state variables
+  const mfront_gb_real* external_state_variables;
+  //! \brief stride of the external state variables
+  mfront_gb_size_type external_state_variables_stride;
+} mfront_gb_BatchInitialState;
+
+/*!
+ * \brief structure passed to the integration of a batch of integration
+ * points
+ */
+#ifndef MFRONT_GB_BATCHBEHAVIOURDATA_FORWARD_DECLARATION
+typedef struct mfront_gb_BatchBehaviourData mfront_gb_BatchBehaviourData;
+#endif
+
+/*!
+ * \brief structure passed to the integration of a batch of integration
+ * points
+ */
+struct mfront_gb_BatchBehaviourData {
+  /*!
+   * \brief pointer to a buffer used to store error message
+   *
+   * \note This pointer can be nullptr. If not null, the pointer must
+   * point to a buffer which is at least 512 characters wide. Only the
+   * error message associated with the first integration point that failed
+   * is reported.
+   */
+  char* error_message;
+  //! \brief number of integration points
+  mfront_gb_size_type n;
+  //! \brief time increment
+  mfront_gb_real dt;
+  /*!
+   * \brief the tangent operator blocks.
+   *
+   * On input, the first values of K (i.e. the values associated with
+   * the first integration point) contains the type of computation to be
+   * performed and the behaviour options, as described in the documentation
+   * of `mfront_gb_BehaviourData`. Those options are shared by all the
+   * integration points of the batch and are only decoded once.
+   *
+   * On output, K contains the tangent operator blocks of each integration
+   * point.
+   */
+  mfront_gb_real* K;
+  //! \brief stride of the tangent operator blocks
+  mfront_gb_size_type K_stride;
+  /*!
+   * \brief proposed time step increment increase factor.
+   *
+   * On output, this value is the minimum of the values proposed by each
+   * integration point.
+   */
+  mfront_gb_real* rdt;
+  //! \brief speed of sound (only computed if requested)
+  mfront_gb_real* speed_of_sound;
+  //! \brief stride of the speed of sound
+  mfront_gb_size_type speed_of_sound_stride;
+  /*!
+   * \brief status of each integration point. This array must be at least of
+   * size `n`. The meaning of each value is the same as the value returned by
+   * the function integrating the behaviour on one integration point.
+   */
+  int* status;
+  //! \brief state of the batch at the beginning of the time step
+  mfront_gb_BatchInitialState s0;
+  //! \brief state of the batch at the end of the time step
+  mfront_gb_BatchState s1;
+  /*!
+   * \brief values of the parameters used by all the integration points of
+   * the batch, as described in the documentation of `mfront_gb_BehaviourData`.
+   */
+  const mfront_gb_ParametersSet* parameters;
+};
+
+#ifdef __cplusplus
+
+namespace mfront::gb {
+
+  //! \brief a simple alias
+  using BatchBehaviourData = ::mfront_gb_BatchBehaviourData;
+
+}  // end of namespace mfront::gb
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_BATCHBEHAVIOURDATA_H */
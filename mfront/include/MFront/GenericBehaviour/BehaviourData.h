@@ -108,6 +108,19 @@ struct mfront_gb_BehaviourData {
   mfront_gb_InitialState s0;
   //! \brief state at the end of the time step
   mfront_gb_State s1;
+  /*!
+   * \brief values of the parameters.
+   *
+   * If this pointer is null, the values of the parameters shared by all the
+   * integration points are used, i.e. the values modified by the
+   * `<behaviour>_setParameter` functions. Otherwise, the values of the
+   * parameters are read from the given set, which allows to integrate the
+   * behaviour with different parameters concurrently.
+   *
+   * \note parameters specific to a modelling hypothesis are always read from
+   * the shared values.
+   */
+  const mfront_gb_ParametersSet* parameters;
 };
 
 #ifdef __cplusplus
@@ -292,17 +292,61 @@ namespace mfront::gb {
     }
   }  // end of reportFailureByException
 
+  //! \brief type of computation requested by the caller of the behaviour
+  struct IntegrationOptions {
+    //! \brief if true, the speed of sound must be computed
+    bool speed_of_sound;
+    /*!
+     * \brief type of stiffness matrix requested, as described in the
+     * documentation of `mfront_gb_BehaviourData`.
+     */
+    real Ke;
+  };  // end of struct IntegrationOptions
+
   /*!
-   * \brief integrate the behaviour over a time step
+   * \return the type of computation requested by the caller of the
+   * behaviour.
+   * \param[in] K: initial values of the consistent tangent operator.
+   */
+  inline IntegrationOptions getIntegrationOptions(const real* const K) {
+    const auto bs = K[0] > 50;
+    return {bs, bs ? K[0] - 100 : K[0]};
+  }  // end of getIntegrationOptions
+
+  /*!
+   * \return the type of stiffness matrix requested by the caller of the
+   * behaviour.
+   * \tparam Behaviour: class implementing the behaviour
+   * \param[in] Ke: type of stiffness matrix requested, as decoded by
+   * `getIntegrationOptions`
+   */
+  template <typename Behaviour>
+  typename Behaviour::SMType getStiffnessMatrixType(const real Ke) {
+    if (Ke < 0.5) {
+      return Behaviour::NOSTIFFNESSREQUESTED;
+    } else if ((0.5 < Ke) && (Ke < 1.5)) {
+      return Behaviour::ELASTIC;
+    } else if ((1.5 < Ke) && (Ke < 2.5)) {
+      return Behaviour::SECANTOPERATOR;
+    } else if ((2.5 < Ke) && (Ke < 3.5)) {
+      return Behaviour::TANGENTOPERATOR;
+    }
+    return Behaviour::CONSISTENTTANGENTOPERATOR;
+  }  // end of getStiffnessMatrixType
+
+  /*!
+   * \brief export the results of a successful integration of the behaviour
    * \tparam Behaviour: class implementing the behaviour
    * \param[in,out] d: behaviour data
-   * \param[in] f: choice of consistent tangent operator
-   * \param[in] p: out of bounds policy
+   * \param[in] b: behaviour
+   * \param[in] o: integration options, as decoded by `getIntegrationOptions`
+   * \return 0 if a smaller time step is requested, 1 on success and -1 if
+   * the a posteriori time step scaling factor rejects the time step.
    */
   template <typename Behaviour>
-  int integrate(mfront_gb_BehaviourData& d,
-                const typename Behaviour::SMFlag f,
-                const tfel::material::OutOfBoundsPolicy p) {
+  int exportIntegrationResults(mfront_gb_BehaviourData& d,
+                               Behaviour& b,
+                               const IntegrationOptions& o) {
     using MTraits = tfel::material::MechanicalBehaviourTraits<Behaviour>;
     using IEnergyComputer =
         typename std::conditional<MTraits::hasComputeInternalEnergy,
@@ -315,6 +359,46 @@ namespace mfront::gb {
     using speed = typename Behaviour::speed;
     using massdensity = typename Behaviour::massdensity;
     using behaviour_real_type = typename Behaviour::real;
+    auto&& rdt = tfel::math::map<behaviour_real_type>(d.rdt);
+    const auto atsf = b.computeAPosterioriTimeStepScalingFactor(rdt);
+    if (rdt > atsf.second) {
+      rdt = atsf.second;
+    }
+    if (!atsf.first) {
+      return -1;
+    }
+    b.exportStateData(d.s1);
+    if constexpr (MTraits::hasConsistentTangentOperator) {
+      if (o.Ke > 0.5) {
+        exportTangentOperator(d.K, b.getTangentOperator());
+      }
+    }
+    IEnergyComputer::exe(d, b);
+    DEnergyComputer::exe(d, b);
+    if (o.speed_of_sound) {
+      tfel::math::map<speed>(d.speed_of_sound) =
+          b.computeSpeedOfSound(massdensity(*(d.s1.mass_density)));
+    }
+    return rdt < behaviour_real_type{0.99} ? 0 : 1;
+  }  // end of exportIntegrationResults
+
+  /*!
+   * \brief integrate the behaviour over a time step
+   * \tparam Behaviour: class implementing the behaviour
+   * \param[in,out] d: behaviour data
+   * \param[in] f: choice of consistent tangent operator
+   * \param[in] p: out of bounds policy
+   * \param[in] o: integration options, as decoded by `getIntegrationOptions`
+   */
+  template <typename Behaviour>
+  int integrate(mfront_gb_BehaviourData& d,
+                const typename Behaviour::SMFlag f,
+                const tfel::material::OutOfBoundsPolicy p,
+                const IntegrationOptions& o) {
+    using MTraits = tfel::material::MechanicalBehaviourTraits<Behaviour>;
+    using speed = typename Behaviour::speed;
+    using massdensity = typename Behaviour::massdensity;
+    using behaviour_real_type = typename Behaviour::real;
     Behaviour b(d);
     b.setOutOfBoundsPolicy(p);
     auto&& rdt = tfel::math::map<behaviour_real_type>(d.rdt);
@@ -324,8 +408,8 @@ namespace mfront::gb {
         return -1;
       }
       b.checkBounds();
-      const auto bs = d.K[0] > 50;
-      const auto Ke = bs ? d.K[0] - 100 : d.K[0];
+      const auto bs = o.speed_of_sound;
+      const auto Ke = o.Ke;
       if (Ke < -0.25) {
         if (bs) {
           tfel::math::map<speed>(d.speed_of_sound) =
@@ -338,18 +422,7 @@ namespace mfront::gb {
           return computePredictionOperator(b, d, f);
         }
       }
-      const auto smt = [&Ke] {
-        if (Ke < 0.5) {
-          return Behaviour::NOSTIFFNESSREQUESTED;
-        } else if ((0.5 < Ke) && (Ke < 1.5)) {
-          return Behaviour::ELASTIC;
-        } else if ((1.5 < Ke) && (Ke < 2.5)) {
-          return Behaviour::SECANTOPERATOR;
-        } else if ((2.5 < Ke) && (Ke < 3.5)) {
-          return Behaviour::TANGENTOPERATOR;
-        }
-        return Behaviour::CONSISTENTTANGENTOPERATOR;
-      }();
+      const auto smt = getStiffnessMatrixType<Behaviour>(Ke);
       if constexpr (!MTraits::hasConsistentTangentOperator) {
         if (smt != Behaviour::NOSTIFFNESSREQUESTED) {
           reportError(d, "tangent operator is not implemented");
@@ -366,31 +439,26 @@ namespace mfront::gb {
         rdt = b.getMinimalTimeStepScalingFactor();
         return -1;
       }
-      const auto atsf = b.computeAPosterioriTimeStepScalingFactor(rdt);
-      if (rdt > atsf.second) {
-        rdt = atsf.second;
-      }
-      if (!atsf.first) {
-        return -1;
-      }
-      b.exportStateData(d.s1);
-      if constexpr (MTraits::hasConsistentTangentOperator) {
-        if (Ke > 0.5) {
-          exportTangentOperator(d.K, b.getTangentOperator());
-        }
-      }
-      IEnergyComputer::exe(d, b);
-      DEnergyComputer::exe(d, b);
-      if (bs) {
-        tfel::math::map<speed>(d.speed_of_sound) =
-            b.computeSpeedOfSound(massdensity(*(d.s1.mass_density)));
-      }
+      return exportIntegrationResults(d, b, o);
     } catch (...) {
       reportFailureByException(d);
       rdt = b.getMinimalTimeStepScalingFactor();
       return -1;
     }
-    return rdt < behaviour_real_type{0.99} ? 0 : 1;
+  }  // end of integrate
+
+  /*!
+   * \brief integrate the behaviour over a time step
+   * \tparam Behaviour: class implementing the behaviour
+   * \param[in,out] d: behaviour data
+   * \param[in] f: choice of consistent tangent operator
+   * \param[in] p: out of bounds policy
+   */
+  template <typename Behaviour>
+  int integrate(mfront_gb_BehaviourData& d,
+                const typename Behaviour::SMFlag f,
+                const tfel::material::OutOfBoundsPolicy p) {
+    return integrate<Behaviour>(d, f, p, getIntegrationOptions(d.K));
   }  // end of integrate
 
   /*!
@@ -0,0 +1,323 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/IntegrateBatch.hxx
+ * \brief  This file implements the integration of a behaviour on a batch of
+ * integration points.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEBATCH_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEBATCH_HXX
+
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <algorithm>
+#include "MFront/GenericBehaviour/Types.hxx"
+#include "MFront/GenericBehaviour/Integrate.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+namespace mfront::gb {
+
+  /*!
+   * \return a pointer to the values associated with the `i`-th integration
+   * point of a batch.
+   * \param[in] p: pointer to the values associated with the first
+   * integration point
+   * \param[in] s: stride
+   * \param[in] i: index of the integration point
+   */
+  template <typename ValueType>
+  ValueType* getBatchEntry(ValueType* const p,
+                           const mfront_gb_size_type s,
+                           const mfront_gb_size_type i) {
+    if (p == nullptr) {
+      return nullptr;
+    }
+    return p + s * i;
+  }  // end of getBatchEntry
+
+  /*!
+   * \brief set the pointers of the behaviour data associated with the
+   * `i`-th integration point of a batch.
+   * \param[out] d: behaviour data of the integration point
+   * \param[in] bd: batch data
+   * \param[in] i: index of the integration point
+   */
+  inline void setBatchEntry(mfront_gb_BehaviourData& d,
+                            mfront_gb_BatchBehaviourData& bd,
+                            const mfront_gb_size_type i) {
+    d.K = bd.K + bd.K_stride * i;
+    d.parameters = bd.parameters;
+    d.speed_of_sound =
+        getBatchEntry(bd.speed_of_sound, bd.speed_of_sound_stride, i);
+    // state at the beginning of the time step
+    d.s0.gradients = getBatchEntry(bd.s0.gradients, bd.s0.gradients_stride, i);
+    d.s0.thermodynamic_forces = getBatchEntry(
+        bd.s0.thermodynamic_forces, bd.s0.thermodynamic_forces_stride, i);
+    d.s0.mass_density =
+        getBatchEntry(bd.s0.mass_density, bd.s0.mass_density_stride, i);
+    d.s0.material_properties = getBatchEntry(
+        bd.s0.material_properties, bd.s0.material_properties_stride, i);
+    d.s0.internal_state_variables =
+        getBatchEntry(bd.s0.internal_state_variables,
+                      bd.s0.internal_state_variables_stride, i);
+    d.s0.stored_energy =
+        getBatchEntry(bd.s0.stored_energy, bd.s0.stored_energy_stride, i);
+    d.s0.dissipated_energy = getBatchEntry(
+        bd.s0.dissipated_energy, bd.s0.dissipated_energy_stride, i);
+    d.s0.external_state_variables =
+        getBatchEntry(bd.s0.external_state_variables,
+                      bd.s0.external_state_variables_stride, i);
+    // state at the end of the time step
+    d.s1.gradients = getBatchEntry(bd.s1.gradients, bd.s1.gradients_stride, i);
+    d.s1.thermodynamic_forces = getBatchEntry(
+        bd.s1.thermodynamic_forces, bd.s1.thermodynamic_forces_stride, i);
+    d.s1.mass_density =
+        getBatchEntry(bd.s1.mass_density, bd.s1.mass_density_stride, i);
+    d.s1.material_properties = getBatchEntry(
+        bd.s1.material_properties, bd.s1.material_properties_stride, i);
+    d.s1.internal_state_variables =
+        getBatchEntry(bd.s1.internal_state_variables,
+                      bd.s1.internal_state_variables_stride, i);
+    d.s1.stored_energy =
+        getBatchEntry(bd.s1.stored_energy, bd.s1.stored_energy_stride, i);
+    d.s1.dissipated_energy = getBatchEntry(
+        bd.s1.dissipated_energy, bd.s1.dissipated_energy_stride, i);
+    d.s1.external_state_variables =
+        getBatchEntry(bd.s1.external_state_variables,
+                      bd.s1.external_state_variables_stride, i);
+  }  // end of setBatchEntry
+
+  /*!
+   * \brief integrate a behaviour on a batch of integration points.
+   *
+   * The integration options stored at the beginning of the tangent operator
+   * blocks of the first integration point are read once and copied into the
+   * tangent operator blocks of the other integration points before their
+   * integration.
+   *
+   * \tparam NumberOfOptions: number of values used to store the
+   * integration options at the beginning of the tangent operator blocks.
+   * \tparam PointIntegrator: type of the callable in charge of the
+   * integration of one integration point.
+   * \param[in,out] bd: batch data
+   * \param[in] integrate: callable in charge of the integration of one
+   * integration point.
+   * \return the smallest value returned by the integration of each
+   * integration point, i.e. -1 if at least one integration failed, 0 if at
+   * least one integration point requested a smaller time step, 1 otherwise.
+   */
+  template <std::size_t NumberOfOptions, typename PointIntegrator>
+  int integrateBatch(mfront_gb_BatchBehaviourData& bd,
+                     const PointIntegrator& integrate) {
+    static_assert(NumberOfOptions > 0, "invalid number of options");
+    if (bd.n == 0) {
+      return 1;
+    }
+    real options[NumberOfOptions];
+    std::copy(bd.K, bd.K + NumberOfOptions, options);
+    const auto rdt0 = *(bd.rdt);
+    auto rdt = rdt0;
+    auto status = 1;
+    auto d = mfront_gb_BehaviourData{};
+    d.error_message = bd.error_message;
+    d.dt = bd.dt;
+    for (mfront_gb_size_type i = 0; i != bd.n; ++i) {
+      auto rdt_i = rdt0;
+      setBatchEntry(d, bd, i);
+      if (i != 0) {
+        std::copy(options, options + NumberOfOptions, d.K);
+      }
+      d.rdt = &rdt_i;
+      //
+      const auto r = integrate(&d);
+      bd.status[i] = r;
+      rdt = std::min(rdt, rdt_i);
+      if (r < status) {
+        if (r == -1) {
+          // only the first error message is reported
+          d.error_message = nullptr;
+        }
+        status = r;
+      }
+    }
+    *(bd.rdt) = rdt;
+    return status;
+  }  // end of integrateBatch
+
+  /*!
+   * \brief integrate a behaviour on a batch of integration points using the
+   * `batchNewtonIntegration` method generated by the `IsotropicMisesCreep`,
+   * `IsotropicMisesPlasticFlow` and `IsotropicStrainHardeningMisesCreep`
+   * DSLs when the `vectorized_batch_integration` option is set.
+   *
+   * The integration points are treated by chunks of `BatchSize` points. For
+   * each chunk, the behaviours are initialized point by point, the Newton
+   * algorithm is solved on all the points of the chunk simultaneously and
+   * the integration is completed point by point.
+   *
+   * The per-point algorithm is used if a prediction is requested or if an
+   * exception is thrown by the vectorized Newton algorithm.
+   *
+   * \tparam Behaviour: class implementing the behaviour
+   * \tparam BatchSize: number of integration points treated simultaneously
+   * \param[in,out] bd: batch data
+   * \param[in] f: choice of consistent tangent operator
+   * \param[in] p: out of bounds policy
+   * \param[in] o: integration options, as decoded by `getIntegrationOptions`
+   * \return the same value as `integrateBatch`
+   */
+  template <typename Behaviour, std::size_t BatchSize = 8>
+  int integrateVectorizedBatch(mfront_gb_BatchBehaviourData& bd,
+                               const typename Behaviour::SMFlag f,
+                               const tfel::material::OutOfBoundsPolicy p,
+                               const IntegrationOptions& o) {
+    static_assert(BatchSize > 0, "invalid batch size");
+    using MTraits = tfel::material::MechanicalBehaviourTraits<Behaviour>;
+    using behaviour_real_type = typename Behaviour::real;
+    if (bd.n == 0) {
+      return 1;
+    }
+    const auto smt = getStiffnessMatrixType<Behaviour>(o.Ke);
+    const auto use_per_point_integration = [&o, smt] {
+      if (o.Ke < -0.25) {
+        return true;
+      }
+      if constexpr (!MTraits::hasConsistentTangentOperator) {
+        return smt != Behaviour::NOSTIFFNESSREQUESTED;
+      }
+      return false;
+    }();
+    if (use_per_point_integration) {
+      const auto integrate_point = [f, p,
+                                    &o](mfront_gb_BehaviourData* const d) {
+        return integrate<Behaviour>(*d, f, p, o);
+      };
+      return integrateBatch<1u>(bd, integrate_point);
+    }
+    const auto rdt0 = *(bd.rdt);
+    auto rdt = rdt0;
+    auto status = 1;
+    // only the first error message is reported
+    auto error_reported = false;
+    for (mfront_gb_size_type i0 = 0; i0 < bd.n; i0 += BatchSize) {
+      const auto nl = std::min(static_cast<mfront_gb_size_type>(BatchSize),
+                               bd.n - i0);
+      mfront_gb_BehaviourData data[BatchSize];
+      mfront_gb_real rdts[BatchSize];
+      int statuses[BatchSize];
+      char error_messages[BatchSize][512];
+      std::optional<Behaviour> behaviours[BatchSize];
+      Behaviour* active_behaviour = nullptr;
+      // initialisation of the behaviours
+      for (std::size_t l = 0; l != nl; ++l) {
+        auto& d = data[l];
+        rdts[l] = rdt0;
+        error_messages[l][0] = '\0';
+        d.error_message =
+            (bd.error_message != nullptr) ? error_messages[l] : nullptr;
+        d.dt = bd.dt;
+        setBatchEntry(d, bd, i0 + l);
+        d.rdt = rdts + l;
+        statuses[l] = -1;
+        try {
+          auto& b = behaviours[l].emplace(d);
+          b.setOutOfBoundsPolicy(p);
+          if (!b.initialize()) {
+            reportError(d, "behaviour initialisation failed");
+            continue;
+          }
+          b.checkBounds();
+          auto&& rdt_l = tfel::math::map<behaviour_real_type>(d.rdt);
+          auto tsf = b.computeAPrioriTimeStepScalingFactor(rdt_l);
+          rdt_l = tsf.second;
+          if (!tsf.first) {
+            continue;
+          }
+          statuses[l] = 1;
+          active_behaviour = &b;
+        } catch (...) {
+          reportFailureByException(d);
+          if (behaviours[l].has_value()) {
+            rdts[l] = behaviours[l]->getMinimalTimeStepScalingFactor();
+          }
+        }
+      }
+      // Newton algorithm. Missing or failed integration points are
+      // replaced by an active one.
+      auto vectorized = false;
+      bool converged[BatchSize];
+      if (active_behaviour != nullptr) {
+        Behaviour* ptrs[BatchSize];
+        for (std::size_t l = 0; l != BatchSize; ++l) {
+          ptrs[l] = ((l < nl) && (statuses[l] == 1)) ? &(*(behaviours[l]))
+                                                     : active_behaviour;
+        }
+        try {
+          Behaviour::template batchNewtonIntegration<BatchSize>(ptrs,
+                                                               converged);
+          vectorized = true;
+        } catch (...) {
+          // the behaviours are only modified if the Newton algorithm
+          // succeeds, the per-point algorithm is used as a fallback
+        }
+      }
+      // completion of the integration
+      for (std::size_t l = 0; l != nl; ++l) {
+        if (statuses[l] != 1) {
+          continue;
+        }
+        auto& d = data[l];
+        auto& b = *(behaviours[l]);
+        try {
+          const auto r = [&]() -> typename Behaviour::IntegrationResult {
+            if (!vectorized) {
+              return b.integrate(f, smt);
+            }
+            if (!converged[l]) {
+              return Behaviour::FAILURE;
+            }
+            return b.completeBatchIntegration(f, smt);
+          }();
+          if (r == Behaviour::FAILURE) {
+            rdts[l] = b.getMinimalTimeStepScalingFactor();
+            statuses[l] = -1;
+          } else {
+            statuses[l] = exportIntegrationResults(d, b, o);
+          }
+        } catch (...) {
+          reportFailureByException(d);
+          rdts[l] = b.getMinimalTimeStepScalingFactor();
+          statuses[l] = -1;
+        }
+      }
+      // results
+      for (std::size_t l = 0; l != nl; ++l) {
+        bd.status[i0 + l] = statuses[l];
+        rdt = std::min(rdt, rdts[l]);
+        status = std::min(status, statuses[l]);
+        if ((statuses[l] == -1) && (!error_reported)) {
+          if ((bd.error_message != nullptr) && (error_messages[l][0] != '\0')) {
+            // both buffers have the same size and error_messages[l] is
+            // null-terminated
+            std::memcpy(bd.error_message, error_messages[l], 512);
+          }
+          error_reported = true;
+        }
+      }
+    }
+    *(bd.rdt) = rdt;
+    return status;
+  }  // end of integrateVectorizedBatch
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_INTEGRATEBATCH_HXX */
@@ -0,0 +1,139 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/RotationKernels.hxx
+ * \brief  This file declares the kernels used by the `generic` interface to
+ * rotate arrays of gradients, thermodynamic forces and tangent operator
+ * blocks.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_ROTATIONKERNELS_HXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_ROTATIONKERNELS_HXX
+
+#include <array>
+#include <cstddef>
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/tensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/t2tost2.hxx"
+#include "TFEL/Math/st2tot2.hxx"
+#include "TFEL/Math/t2tot2.hxx"
+#include "MFront/GenericBehaviour/Types.hxx"
+
+namespace mfront::gb {
+
+  //! \brief a simple alias
+  using size_type = ::mfront_gb_size_type;
+
+  //! \brief type of the objects handled by the rotation kernels
+  enum struct RotatedObjectType {
+    SCALAR,
+    STENSOR,
+    TENSOR,
+    ST2TOST2,
+    T2TOST2,
+    ST2TOT2,
+    T2TOT2
+  };  // end of RotatedObjectType
+
+  //! \brief description of an object stored in the values of a point
+  struct RotatedObject {
+    //! \brief type of the object
+    RotatedObjectType type;
+    //! \brief offset of the object in the values of a point
+    size_type offset;
+  };  // end of RotatedObject
+
+  /*!
+   * \brief number of points treated at once by the rotation kernels.
+   *
+   * Inside a tile, the objects are treated one after the other, so that
+   * the change of basis operators associated with a given type of object
+   * are reused for all the points of the tile.
+   */
+  inline constexpr size_type rotationKernelsTileSize = 64;
+
+  /*!
+   * \brief change of basis operators associated with a rotation matrix.
+   *
+   * Those operators are built once per rotation matrix rather than once
+   * per point and per object.
+   */
+  template <unsigned short N>
+  struct ChangeOfBasisOperators {
+    /*!
+     * \brief build the operators associated with the given rotation matrix
+     * \param[in] rv: rotation matrix (9 components)
+     * \param[in] b: if true, the transpose of the rotation matrix is used
+     */
+    void update(const real* const, const bool) noexcept;
+    //! \brief operator rotating symmetric tensors
+    tfel::math::st2tost2<N, real> sr;
+    //! \brief operator applying the inverse rotation to symmetric tensors
+    tfel::math::st2tost2<N, real> sir;
+    //! \brief operator rotating unsymmetric tensors
+    tfel::math::t2tot2<N, real> tr;
+    //! \brief operator applying the inverse rotation to unsymmetric tensors
+    tfel::math::t2tot2<N, real> tir;
+  };  // end of ChangeOfBasisOperators
+
+  /*!
+   * \brief rotate an array of values using the same rotation matrix for all
+   * points
+   * \tparam N: space dimension
+   * \tparam M: number of objects per point
+   * \param[out] dest: rotated values
+   * \param[in] src: values to be rotated. `src` may be equal to `dest`
+   * \param[in] rv: rotation matrix (9 components)
+   * \param[in] b: if true, the transpose of the rotation matrix is used
+   * \param[in] stride: number of values per point
+   * \param[in] n: number of points
+   * \param[in] objects: objects stored in the values of a point
+   */
+  template <unsigned short N, std::size_t M>
+  void rotateArray(real* const,
+                   const real* const,
+                   const real* const,
+                   const bool,
+                   const size_type,
+                   const size_type,
+                   const std::array<RotatedObject, M>&) noexcept;
+  /*!
+   * \brief rotate an array of values using one rotation matrix per element
+   * \tparam N: space dimension
+   * \tparam M: number of objects per point
+   * \param[out] dest: rotated values
+   * \param[in] src: values to be rotated. `src` may be equal to `dest`
+   * \param[in] rvs: rotation matrices of the elements (9 components each)
+   * \param[in] elements: index of the element of each point
+   * \param[in] b: if true, the transpose of the rotation matrices are used
+   * \param[in] stride: number of values per point
+   * \param[in] n: number of points
+   * \param[in] objects: objects stored in the values of a point
+   *
+   * \note the change of basis operators are only updated when the element
+   * changes from one point to the next one, so this function is the most
+   * efficient when the points of an element are contiguous.
+   */
+  template <unsigned short N, std::size_t M>
+  void rotateArrayByElements(real* const,
+                             const real* const,
+                             const real* const,
+                             const size_type* const,
+                             const bool,
+                             const size_type,
+                             const size_type,
+                             const std::array<RotatedObject, M>&) noexcept;
+
+}  // end of namespace mfront::gb
+
+#include "MFront/GenericBehaviour/RotationKernels.ixx"
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_ROTATIONKERNELS_HXX */
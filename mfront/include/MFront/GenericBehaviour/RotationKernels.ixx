@@ -0,0 +1,267 @@
+/*!
+ * \file   mfront/include/MFront/GenericBehaviour/RotationKernels.ixx
+ * \brief  This file implements the kernels declared in
+ * `RotationKernels.hxx`.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MFRONT_GENERICBEHAVIOUR_ROTATIONKERNELS_IXX
+#define LIB_MFRONT_GENERICBEHAVIOUR_ROTATIONKERNELS_IXX
+
+#include <algorithm>
+#include "TFEL/FSAlgorithm/copy.hxx"
+
+namespace mfront::gb::internals {
+
+  /*!
+   * \return the number of values of an object
+   * \tparam N: space dimension
+   * \param[in] t: type of the object
+   */
+  template <unsigned short N>
+  constexpr size_type getRotatedObjectSize(
+      const RotatedObjectType t) noexcept {
+    constexpr auto ss = tfel::math::StensorDimeToSize<N>::value;
+    constexpr auto ts = tfel::math::TensorDimeToSize<N>::value;
+    switch (t) {
+      case RotatedObjectType::STENSOR:
+        return ss;
+      case RotatedObjectType::TENSOR:
+        return ts;
+      case RotatedObjectType::ST2TOST2:
+        return ss * ss;
+      case RotatedObjectType::T2TOST2:
+      case RotatedObjectType::ST2TOT2:
+        return ss * ts;
+      case RotatedObjectType::T2TOT2:
+        return ts * ts;
+      default:
+        break;
+    }
+    return 1;
+  }  // end of getRotatedObjectSize
+
+  /*!
+   * \brief rotate an object for the points of a tile
+   * \tparam N: space dimension
+   * \tparam T: type of the object
+   * \param[out] dest: rotated values
+   * \param[in] src: values to be rotated
+   * \param[in] o: change of basis operators
+   * \param[in] stride: number of values per point
+   * \param[in] b: index of the first point of the tile
+   * \param[in] e: index past the last point of the tile
+   */
+  template <unsigned short N, RotatedObjectType T>
+  void rotateObjects(real* const dest,
+                     const real* const src,
+                     const ChangeOfBasisOperators<N>& o,
+                     const size_type stride,
+                     const size_type b,
+                     const size_type e) noexcept {
+    using namespace tfel::math;
+    constexpr auto s = getRotatedObjectSize<N>(T);
+    // the values are copied in local objects before the results are
+    // written, so that src may be equal to dest
+    for (size_type i = b; i != e; ++i) {
+      const auto* const p = src + i * stride;
+      auto* const q = dest + i * stride;
+      if constexpr (T == RotatedObjectType::STENSOR) {
+        auto v = stensor<N, real>{};
+        tfel::fsalgo::copy<s>::exe(p, v.begin());
+        const auto r = stensor<N, real>{o.sr * v};
+        tfel::fsalgo::copy<s>::exe(r.begin(), q);
+      } else if constexpr (T == RotatedObjectType::TENSOR) {
+        auto v = tensor<N, real>{};
+        tfel::fsalgo::copy<s>::exe(p, v.begin());
+        const auto r = tensor<N, real>{o.tr * v};
+        tfel::fsalgo::copy<s>::exe(r.begin(), q);
+      } else if constexpr (T == RotatedObjectType::ST2TOST2) {
+        auto v = st2tost2<N, real>{};
+        tfel::fsalgo::copy<s>::exe(p, v.begin());
+        const auto r = st2tost2<N, real>{o.sr * v * o.sir};
+        tfel::fsalgo::copy<s>::exe(r.begin(), q);
+      } else if constexpr (T == RotatedObjectType::T2TOST2) {
+        auto v = t2tost2<N, real>{};
+        tfel::fsalgo::copy<s>::exe(p, v.begin());
+        const auto r = t2tost2<N, real>{o.sr * v * o.tir};
+        tfel::fsalgo::copy<s>::exe(r.begin(), q);
+      } else if constexpr (T == RotatedObjectType::ST2TOT2) {
+        auto v = st2tot2<N, real>{};
+        tfel::fsalgo::copy<s>::exe(p, v.begin());
+        const auto r = st2tot2<N, real>{o.tr * v * o.sir};
+        tfel::fsalgo::copy<s>::exe(r.begin(), q);
+      } else if constexpr (T == RotatedObjectType::T2TOT2) {
+        auto v = t2tot2<N, real>{};
+        tfel::fsalgo::copy<s>::exe(p, v.begin());
+        const auto r = t2tot2<N, real>{o.tr * v * o.tir};
+        tfel::fsalgo::copy<s>::exe(r.begin(), q);
+      } else {
+        *q = *p;
+      }
+    }
+  }  // end of rotateObjects
+
+  /*!
+   * \brief copy an object for the points of a tile
+   * \param[out] dest: copied values
+   * \param[in] src: values to be copied
+   * \param[in] s: size of the object
+   * \param[in] stride: number of values per point
+   * \param[in] b: index of the first point of the tile
+   * \param[in] e: index past the last point of the tile
+   */
+  inline void copyObjects(real* const dest,
+                          const real* const src,
+                          const size_type s,
+                          const size_type stride,
+                          const size_type b,
+                          const size_type e) noexcept {
+    for (size_type i = b; i != e; ++i) {
+      std::copy(src + i * stride, src + i * stride + s, dest + i * stride);
+    }
+  }  // end of copyObjects
+
+  /*!
+   * \brief rotate all the objects of the points of a tile
+   * \tparam N: space dimension
+   * \tparam M: number of objects per point
+   * \param[out] dest: rotated values
+   * \param[in] src: values to be rotated
+   * \param[in] o: change of basis operators
+   * \param[in] stride: number of values per point
+   * \param[in] b: index of the first point of the tile
+   * \param[in] e: index past the last point of the tile
+   * \param[in] objects: objects stored in the values of a point
+   */
+  template <unsigned short N, std::size_t M>
+  void rotateTile(real* const dest,
+                  const real* const src,
+                  const ChangeOfBasisOperators<N>& o,
+                  const size_type stride,
+                  const size_type b,
+                  const size_type e,
+                  const std::array<RotatedObject, M>& objects) noexcept {
+    for (const auto& object : objects) {
+      auto* const d = dest + object.offset;
+      const auto* const s = src + object.offset;
+      if constexpr (N == 1) {
+        // in 1D, the change of basis operators are the identity
+        if (d != s) {
+          copyObjects(d, s, getRotatedObjectSize<N>(object.type), stride, b,
+                      e);
+        }
+        static_cast<void>(o);
+      } else {
+        switch (object.type) {
+          case RotatedObjectType::STENSOR:
+            rotateObjects<N, RotatedObjectType::STENSOR>(d, s, o, stride, b,
+                                                         e);
+            break;
+          case RotatedObjectType::TENSOR:
+            rotateObjects<N, RotatedObjectType::TENSOR>(d, s, o, stride, b,
+                                                        e);
+            break;
+          case RotatedObjectType::ST2TOST2:
+            rotateObjects<N, RotatedObjectType::ST2TOST2>(d, s, o, stride, b,
+                                                          e);
+            break;
+          case RotatedObjectType::T2TOST2:
+            rotateObjects<N, RotatedObjectType::T2TOST2>(d, s, o, stride, b,
+                                                         e);
+            break;
+          case RotatedObjectType::ST2TOT2:
+            rotateObjects<N, RotatedObjectType::ST2TOT2>(d, s, o, stride, b,
+                                                         e);
+            break;
+          case RotatedObjectType::T2TOT2:
+            rotateObjects<N, RotatedObjectType::T2TOT2>(d, s, o, stride, b,
+                                                        e);
+            break;
+          default:
+            if (d != s) {
+              copyObjects(d, s, 1, stride, b, e);
+            }
+        }
+      }
+    }
+  }  // end of rotateTile
+
+}  // end of namespace mfront::gb::internals
+
+namespace mfront::gb {
+
+  template <unsigned short N>
+  void ChangeOfBasisOperators<N>::update(const real* const rv,
+                                         const bool b) noexcept {
+    if constexpr (N != 1) {
+      using namespace tfel::math;
+      auto m = tmatrix<3u, 3u, real>{};
+      tfel::fsalgo::copy<9u>::exe(rv, m.begin());
+      const auto r = b ? tmatrix<3u, 3u, real>{transpose(m)} : m;
+      const auto ri = tmatrix<3u, 3u, real>{transpose(r)};
+      this->sr = st2tost2<N, real>::fromRotationMatrix(r);
+      this->sir = st2tost2<N, real>::fromRotationMatrix(ri);
+      this->tr = t2tot2<N, real>::fromRotationMatrix(r);
+      this->tir = t2tot2<N, real>::fromRotationMatrix(ri);
+    } else {
+      static_cast<void>(rv);
+      static_cast<void>(b);
+    }
+  }  // end of update
+
+  template <unsigned short N, std::size_t M>
+  void rotateArray(real* const dest,
+                   const real* const src,
+                   const real* const rv,
+                   const bool b,
+                   const size_type stride,
+                   const size_type n,
+                   const std::array<RotatedObject, M>& objects) noexcept {
+    auto o = ChangeOfBasisOperators<N>{};
+    o.update(rv, b);
+    for (size_type tb = 0; tb < n; tb += rotationKernelsTileSize) {
+      const auto te = std::min(tb + rotationKernelsTileSize, n);
+      internals::rotateTile<N, M>(dest, src, o, stride, tb, te, objects);
+    }
+  }  // end of rotateArray
+
+  template <unsigned short N, std::size_t M>
+  void rotateArrayByElements(
+      real* const dest,
+      const real* const src,
+      const real* const rvs,
+      const size_type* const elements,
+      const bool b,
+      const size_type stride,
+      const size_type n,
+      const std::array<RotatedObject, M>& objects) noexcept {
+    auto o = ChangeOfBasisOperators<N>{};
+    auto tb = size_type{};
+    while (tb < n) {
+      // points of the same element are treated together, up to the size of
+      // a tile
+      const auto ce = elements[tb];
+      const auto tmax = std::min(tb + rotationKernelsTileSize, n);
+      auto te = tb + 1;
+      while ((te != tmax) && (elements[te] == ce)) {
+        ++te;
+      }
+      if ((tb == 0) || (elements[tb - 1] != ce)) {
+        o.update(rvs + 9 * ce, b);
+      }
+      internals::rotateTile<N, M>(dest, src, o, stride, tb, te, objects);
+      tb = te;
+    }
+  }  // end of rotateArrayByElements
+
+}  // end of namespace mfront::gb
+
+#endif /* LIB_MFRONT_GENERICBEHAVIOUR_ROTATIONKERNELS_IXX */
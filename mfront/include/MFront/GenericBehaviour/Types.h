@@ -29,4 +29,18 @@ typedef double mfront_gb_real;
  */
 typedef size_t mfront_gb_size_type;
 
+/*!
+ * \brief opaque structure holding a set of values of the parameters of a
+ * behaviour.
+ *
+ * Such a set is created, copied, modified and destroyed by the functions
+ * generated by the `generic` interface, i.e. the
+ * `<behaviour>_createParametersSet`, `<behaviour>_copyParametersSet`,
+ * `<behaviour>_setParameterInParametersSet` and
+ * `<behaviour>_destroyParametersSet` functions.
+ */
+#ifndef MFRONT_GB_PARAMETERSSET_FORWARD_DECLARATION
+typedef struct mfront_gb_ParametersSet mfront_gb_ParametersSet;
+#endif
+
 #endif /* LIB_MFRONT_GENERICBEHAVIOUR_TYPES_H */
@@ -58,6 +58,8 @@ namespace mfront {
     void writeBehaviourConstructorBody(std::ostream&,
                                        const BehaviourDescription&,
                                        const Hypothesis) const override;
+    std::string getBehaviourConstructorParametersInitializer(
+        const BehaviourDescription&, const Hypothesis) const override;
     void writeBehaviourDataConstructor(
         std::ostream&,
         const Hypothesis,
@@ -102,6 +104,24 @@ namespace mfront {
     virtual void generateMTestFile(std::ostream&,
                                    const BehaviourDescription&,
                                    const Hypothesis) const;
+    /*!
+     * \brief write the declarations of the functions allowing to create,
+     * copy, modify and destroy a set of parameters.
+     * \param[out] out: output stream
+     * \param[in]  bd: behaviour description
+     * \param[in]  name: name of the behaviour
+     */
+    virtual void writeParametersSetFunctionsDeclarations(
+        std::ostream&, const BehaviourDescription&, const std::string&) const;
+    /*!
+     * \brief write the implementations of the functions allowing to create,
+     * copy, modify and destroy a set of parameters.
+     * \param[out] out: output stream
+     * \param[in]  bd: behaviour description
+     * \param[in]  name: name of the behaviour
+     */
+    virtual void writeParametersSetFunctionsImplementations(
+        std::ostream&, const BehaviourDescription&, const std::string&) const;
     //! \brief list of selected hypotheses
     std::optional<std::set<GenericBehaviourInterface::Hypothesis>>
         selectedHypotheses;
@@ -14,6 +14,7 @@
 #ifndef LIB_MFRONT_GENERICMATERIALPROPERTYINTERFACEBASE_HXX
 #define LIB_MFRONT_GENERICMATERIALPROPERTYINTERFACEBASE_HXX
 
+#include <iosfwd>
 #include <string>
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "MFront/MFrontConfig.hxx"
@@ -98,6 +99,16 @@ namespace mfront {
      */
     virtual void writeSrcFile(const MaterialPropertyDescription&,
                               const FileDescription&) const;
+    /*!
+     * \brief write the `<name>_array` function which evaluates the material
+     * property on a set of points.
+     * \param[in, out] os: output stream
+     * \param[in] mpd: material property description
+     * \param[in] fd: file description
+     */
+    virtual void writeArrayFunction(std::ostream&,
+                                    const MaterialPropertyDescription&,
+                                    const FileDescription&) const;
   };  // end of MfrontGenericMaterialPropertyInterfaceBase
 
 }  // end of namespace mfront
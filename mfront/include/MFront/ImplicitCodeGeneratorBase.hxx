@@ -71,6 +71,12 @@ namespace mfront {
 
     void writeBehaviourFriends(std::ostream&, const Hypothesis) const override;
 
+    bool requiresNumericTypeConversionConstructors(
+        const Hypothesis) const override;
+
+    void writeBehaviourConstructors(std::ostream&,
+                                    const Hypothesis) const override;
+
     void writeBehaviourLocalVariablesInitialisation(
         std::ostream&, const Hypothesis) const override;
 
@@ -78,6 +84,23 @@ namespace mfront {
                                   const Hypothesis) const override;
 
     virtual void writeComputeFdF(std::ostream&, const Hypothesis) const;
+    /*!
+     * \brief write the `solveLinearSystem` method used to solve the linear
+     * systems arising at each iteration of the non linear solver.
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void writeSolveLinearSystem(std::ostream&, const Hypothesis) const;
+    /*!
+     * \brief write the `solveLinearSystemByBlockElimination` method which
+     * exploits the sparsity pattern of the jacobian, as described by the
+     * `jacobianBlockEliminationVariable` and `writtenJacobianBlocks`
+     * attributes.
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void writeSolveLinearSystemByBlockElimination(
+        std::ostream&, const Hypothesis) const;
 
     void writeBehaviourParserSpecificInheritanceRelationship(
         std::ostream&, const Hypothesis) const override;
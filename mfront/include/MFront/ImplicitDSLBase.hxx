@@ -122,8 +122,12 @@ namespace mfront {
     virtual void treatComputeThermodynamicForces();
     //! \brief treat the `@CompareToNumericalJacobian` keyword
     virtual void treatCompareToNumericalJacobian();
+    //! \brief treat the `@Jacobian` keyword
+    virtual void treatJacobian();
     //! \brief treat the `@JacobianComparisonCriterion` keyword
     virtual void treatJacobianComparisonCriterion();
+    //! \brief treat the `@WarmStart` keyword
+    virtual void treatWarmStart();
     //! \brief treat the `@InitJacobian` keyword
     virtual void treatInitJacobian();
     //! \brief treat the `@InitJacobianInvert` keyword
@@ -132,6 +136,27 @@ namespace mfront {
     virtual void treatMaximumIncrementValuePerIteration();
     //! \brief treat the `@NumericallyComputedJacobianBlocks` keyword
     virtual void treatNumericallyComputedJacobianBlocks();
+    /*!
+     * \brief record the jacobian blocks that may be written during the
+     * evaluation of the implicit system and, if the sparsity pattern of
+     * the jacobian allows it, select the variable on which the Schur
+     * complement is built to solve the linear systems arising at each
+     * Newton iteration by block elimination.
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void analyseJacobianStructure(const Hypothesis);
+    /*!
+     * \brief add the auxiliary state variables storing the increments of
+     * the integration variables converged at the previous time step and
+     * the code using them as the initial guess of the implicit scheme.
+     * \param[in] h: modelling hypothesis
+     * \param[in] vars: integration variables to be treated
+     * \param[in] b: if true, the auxiliary state variable storing the
+     * previous time increment is also declared
+     */
+    virtual void addWarmStart(const Hypothesis,
+                              const VariableDescriptionContainer&,
+                              const bool);
     /*!
      * \brief set the non linear solver
      * \param[in] s: non linear solver
@@ -14,10 +14,34 @@
 #ifndef LIB_MFRONT_ISOTROPICBEHAVIOURCODEGENERATORBASE_HXX
 #define LIB_MFRONT_ISOTROPICBEHAVIOURCODEGENERATORBASE_HXX
 
+#include <map>
+#include <string>
+#include <vector>
+#include <optional>
 #include "MFront/BehaviourCodeGeneratorBase.hxx"
 
 namespace mfront {
 
+  /*!
+   * \brief return the variables used by the flow rule when evaluated on a
+   * batch of integration points.
+   *
+   * The keys of the returned map are the names of the variables in the
+   * vectorized flow rule (state variables and external state variables are
+   * replaced by their values at \(t+\theta\,\Delta\,t\)) and the values
+   * are their types.
+   *
+   * \return the variables used by the flow rule or an empty optional if the
+   * flow rule can't be evaluated on a batch of integration points, i.e. if
+   * the flow rule uses a non scalar variable.
+   * \param[in] bd: behaviour description
+   * \param[in] h: modelling hypothesis
+   */
+  std::optional<std::map<std::string, std::string>>
+  getVectorizedFlowRuleVariables(
+      const BehaviourDescription&,
+      const tfel::material::ModellingHypothesis::Hypothesis);
+
   struct IsotropicBehaviourCodeGeneratorBase : BehaviourCodeGeneratorBase {
     /*!
      * \brief constructor
@@ -40,6 +64,61 @@ namespace mfront {
         std::ostream&, const Hypothesis) const override;
     void writeBehaviourComputeTangentOperator(std::ostream&,
                                               const Hypothesis) const override;
+    void writeBehaviourIntegrator(std::ostream&,
+                                  const Hypothesis) const override;
+    /*!
+     * \return if the Newton algorithm shall be vectorized over a batch of
+     * integration points.
+     */
+    virtual bool isBatchNewtonIntegrationVectorized() const;
+    /*!
+     * \brief write the `batchNewtonIntegration` method, i.e. the
+     * vectorized version of the `NewtonIntegration` method.
+     *
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void writeBatchNewtonIntegration(std::ostream&,
+                                             const Hypothesis) const;
+    /*!
+     * \brief write the beginning of the `batchNewtonIntegration` method.
+     *
+     * An array is declared for each variable used by the flow rule and for
+     * each additional variable given in argument. Those arrays are
+     * initialized by the values of each integration point of the batch.
+     *
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     * \param[in] variables: additional variables used by the Newton
+     * algorithm
+     */
+    virtual void writeBatchNewtonIntegrationBegin(
+        std::ostream&, const Hypothesis, const std::vector<std::string>&) const;
+    /*!
+     * \brief write the evaluation of the flow rule on each integration
+     * point of the batch.
+     *
+     * The flow rule is only evaluated on the integration points which have
+     * not converged yet. The result of the evaluation for each integration
+     * point is stored in the `mfront_batch_compute_flow_r` array.
+     *
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     */
+    virtual void writeBatchFlowRuleEvaluation(std::ostream&,
+                                              const Hypothesis) const;
+    /*!
+     * \brief write the end of the `batchNewtonIntegration` method: the
+     * values of the given variables and of the local variables used by the
+     * flow rule are copied back in each behaviour and the convergence status
+     * of each integration point, stored in the `mfront_batch_converged`
+     * array, is reported.
+     * \param[in] os: output stream
+     * \param[in] h: modelling hypothesis
+     * \param[in] variables: variables updated by the Newton algorithm
+     */
+    virtual void writeBatchNewtonIntegrationEnd(
+        std::ostream&, const Hypothesis, const std::vector<std::string>&) const;
   };  // end of IsotropicBehaviourCodeGeneratorBase
 
 }  // end of namespace mfront
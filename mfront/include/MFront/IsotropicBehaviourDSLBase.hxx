@@ -24,6 +24,8 @@ namespace mfront {
 
   struct MFRONT_VISIBILITY_EXPORT IsotropicBehaviourDSLBase
       : public BehaviourDSLBase<IsotropicBehaviourDSLBase> {
+    //! \return a validator for the options passed to the DSL
+    static tfel::utilities::DataMapValidator getDSLOptionsValidator();
     /*!
      * \brief constructor
      *\param[in] opts: options passed to the DSL
@@ -31,6 +33,8 @@ namespace mfront {
     IsotropicBehaviourDSLBase(const DSLOptions&);
     //
     BehaviourDSLDescription getBehaviourDSLDescription() const override;
+    std::vector<DSLOptionDescription> getDSLOptions() const override;
+    DSLOptions buildDSLOptions() const override;
     void getSymbols(std::map<std::string, std::string>&,
                     const Hypothesis,
                     const std::string&) override;
@@ -57,6 +61,22 @@ namespace mfront {
     virtual std::string flowRuleVariableModifier(const Hypothesis,
                                                  const std::string&,
                                                  const bool);
+    /*!
+     * \brief modifier used to write the flow rule evaluated on each
+     * integration point of a batch of integration points.
+     * \param[in] h: modelling hypothesis
+     * \param[in] v: variable name
+     * \param[in] b: add the `this` pointer (unused)
+     */
+    virtual std::string vectorizedFlowRuleVariableModifier(const Hypothesis,
+                                                           const std::string&,
+                                                           const bool);
+    /*!
+     * \brief check that the flow rule can be evaluated on a batch of
+     * integration points. If not, the vectorized integration is disabled and
+     * the standard integration is used for each integration point.
+     */
+    virtual void checkVectorizedBatchIntegration();
 
    private:
     friend struct BehaviourDSLBase<IsotropicBehaviourDSLBase>;
@@ -37,10 +37,10 @@ namespace mfront {
         std::ostream&, const Hypothesis) const override;
     void writeBehaviourParserSpecificMembers(std::ostream&,
                                              const Hypothesis) const override;
-    void writeBehaviourIntegrator(std::ostream&,
-                                  const Hypothesis) const override;
     void writeBehaviourComputeTangentOperator(std::ostream&,
                                               const Hypothesis) const override;
+    void writeBatchNewtonIntegration(std::ostream&,
+                                     const Hypothesis) const override;
   };  // end of IsotropicMisesCreepCodeGenerator
 
 }  // end of namespace mfront
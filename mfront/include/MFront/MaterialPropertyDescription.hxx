@@ -227,6 +227,30 @@ namespace mfront {
       const MaterialPropertyDescription&,
       const std::string_view,
       const bool);
+  /*!
+   * \brief an helper function which writes a loop evaluating the material
+   * property on a set of points.
+   *
+   * The body of the material property is written in the loop, so that it can
+   * be vectorized by the compiler. The inputs of the `i`th point are stored
+   * contiguously, starting at `args + i * stride`. Checks (bounds, `errno`,
+   * exceptions) must be handled outside of the loop.
+   *
+   * \param[in, out] os: output stream
+   * \param[in] mpd: material property description
+   * \param[in] args: name of the pointer to the arguments of the first point
+   * \param[in] stride: name of the variable giving the distance between the
+   * arguments of two consecutive points
+   * \param[in] n: name of the variable giving the number of points
+   * \param[in] out: name of the pointer to the results
+   */
+  MFRONT_VISIBILITY_EXPORT void writeMaterialPropertyArrayLoop(
+      std::ostream&,
+      const MaterialPropertyDescription&,
+      const std::string_view,
+      const std::string_view,
+      const std::string_view,
+      const std::string_view);
   /*!
    * \return the name of a text file allowing the change the name of the
    * parameters of the given material property
@@ -100,6 +100,13 @@ namespace mfront {
      */
     virtual bool requiresJacobianToBeReinitialisedToIdentityAtEachIterations()
         const = 0;
+    /*!
+     * \return true if the linear systems solved at each iteration have the
+     * jacobian of the non linear system as matrix. In this case, the
+     * structure of the jacobian may be exploited to solve those systems.
+     * \note the default implementation returns false.
+     */
+    virtual bool solvesLinearSystemsBasedOnTheJacobian() const;
     /*!
      * \brief write the algorithm specific members
      * \param[in,out] md  : mechanical description
@@ -372,7 +372,7 @@ namespace mfront {
     this->getExtraSrcIncludes(out, mb);
 
     if (ppolicy == "ThreadPool") {
-      out << "#include\"TFEL/System/ThreadPool.hxx\"\n";
+      out << "#include\"TFEL/System/WorkStealingExecutor.hxx\"\n";
     }
     out << "#include\"TFEL/Material/OutOfBoundsPolicy.hxx\"\n"
         << "#include\"TFEL/Material/" << mb.getClassName() << ".hxx\"\n";
@@ -389,12 +389,14 @@ namespace mfront {
     this->writeGetOutOfBoundsPolicyFunctionImplementation(out, mb, name);
 
     if (ppolicy == "ThreadPool") {
-      out << "static size_t getAbaqusExplicitNumberOfThreads(){\n"
-          << "const auto nthreads = ::getenv(\"ABAQUSEXPLICIT_NTHREADS\");\n"
-          << "if(nthreads==nullptr){\n"
-          << "return 4;\n"
-          << "}\n"
-          << "return std::stoi(nthreads);\n"
+      // executor shared by all the entry points of the behaviour
+      out << "static tfel::system::WorkStealingExecutor& "
+             "getAbaqusExplicitExecutor(){\n"
+          << "using tfel::system::WorkStealingExecutor;\n"
+          << "static WorkStealingExecutor executor(\n"
+          << "WorkStealingExecutor::getOptionsFromEnvironment("
+             "\"ABAQUSEXPLICIT\", 4));\n"
+          << "return executor;\n"
           << "}\n\n";
     }
 
@@ -453,10 +455,6 @@ namespace mfront {
               << "Profiler::getProfiler(),\n"
               << "BehaviourProfiler::TOTALTIME);\n";
         }
-        if (ppolicy == "ThreadPool") {
-          out << "static tfel::system::ThreadPool "
-                 "pool(getAbaqusExplicitNumberOfThreads());\n";
-        }
         this->writeChecks(out, mb, t, h);
         if (mb.getBehaviourType() ==
             BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
@@ -1022,21 +1020,13 @@ namespace mfront {
           << "integrate(i);\n"
           << "}\n";
     } else if (ppolicy == "ThreadPool") {
-      out << "auto integrate2 = [&integrate,nblock](const int b, const int "
-             "e){\n"
-          << "for(int i=b;i!=e;++i){\n"
-          << "integrate(i);\n"
-          << "}\n"
-          << "};\n"
-          << "const auto nthreads = pool.getNumberOfThreads();\n"
-          << "const auto ntasks   = nthreads/(*nblock);\n"
-          << "for(tfel::system::ThreadPool::size_type i=0;i!=nthreads;++i){\n"
-          << "pool.addTask(integrate2,i*ntasks,(i+1)*ntasks);\n"
-          << "}\n"
-          << "if(*nblock-ntasks*nthreads!=0){\n"
-          << "pool.addTask(integrate2,nthreads*ntasks,*nblock);\n"
-          << "}\n"
-          << "pool.wait();\n";
+      out << "using size_type = "
+             "tfel::system::WorkStealingExecutor::size_type;\n"
+          << "getAbaqusExplicitExecutor().parallel_for(0, "
+             "static_cast<size_type>(*nblock),\n"
+          << "[&integrate](const size_type i){\n"
+          << "integrate(static_cast<int>(i));\n"
+          << "});\n";
     } else {
       tfel::raise(
           "AbaqusExplicitInterface::writeIntegrateLoop: "
@@ -16,6 +16,12 @@
 
 namespace mfront {
 
+  std::string
+  AbstractBehaviourInterface::getBehaviourConstructorParametersInitializer(
+      const BehaviourDescription&, const Hypothesis) const {
+    return {};
+  }  // end of getBehaviourConstructorParametersInitializer
+
   AbstractBehaviourInterface::~AbstractBehaviourInterface() = default;
 
 }  // end of namespace mfront
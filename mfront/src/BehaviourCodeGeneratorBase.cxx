@@ -12,6 +12,7 @@
  */
 
 #include <ostream>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include "TFEL/Raise.hxx"
@@ -985,6 +986,11 @@ namespace mfront {
     return false;
   }  // end of usesStateVariableTimeDerivative
 
+  bool BehaviourCodeGeneratorBase::requiresNumericTypeConversionConstructors(
+      const Hypothesis) const {
+    return false;
+  }  // end of requiresNumericTypeConversionConstructors
+
   std::string
   BehaviourCodeGeneratorBase::getIntegrationVariablesIncrementsInitializers(
       const Hypothesis h) const {
@@ -1255,6 +1261,63 @@ namespace mfront {
   void BehaviourCodeGeneratorBase::writeBehaviourDataConstructors(
       std::ostream& os, const Hypothesis h) const {
     const auto& md = this->bd.getBehaviourData(h);
+    auto write_initializers = [this, &os, &md] {
+      auto first = true;
+      if (this->bd.getAttribute(BehaviourDescription::requiresStiffnessTensor,
+                                false)) {
+        os << "D(src.D)";
+        first = false;
+      }
+      if (this->bd.getAttribute(
+              BehaviourDescription::requiresThermalExpansionCoefficientTensor,
+              false)) {
+        if (!first) {
+          os << ",\n";
+        }
+        os << "A(src.A)";
+        first = false;
+      }
+      for (const auto& mv : this->bd.getMainVariables()) {
+        if (!first) {
+          os << ",\n";
+        }
+        if (Gradient::isIncrementKnown(mv.first)) {
+          os << mv.first.name << "(src." << mv.first.name << "),\n";
+        } else {
+          os << mv.first.name << "0(src." << mv.first.name << "0),\n";
+        }
+        os << mv.second.name << "(src." << mv.second.name << ")";
+        first = false;
+      }
+      for (const auto& v : md.getMaterialProperties()) {
+        if (!first) {
+          os << ",\n";
+        }
+        os << v.name << "(src." << v.name << ")";
+        first = false;
+      }
+      for (const auto& v : md.getStateVariables()) {
+        if (!first) {
+          os << ",\n";
+        }
+        os << v.name << "(src." << v.name << ")";
+        first = false;
+      }
+      for (const auto& v : md.getAuxiliaryStateVariables()) {
+        if (!first) {
+          os << ",\n";
+        }
+        os << v.name << "(src." << v.name << ")";
+        first = false;
+      }
+      for (const auto& v : md.getExternalStateVariables()) {
+        if (!first) {
+          os << ",\n";
+        }
+        os << v.name << "(src." << v.name << ")";
+        first = false;
+      }
+    };
     this->checkBehaviourDataFile(os);
     os << "/*!\n"
        << "* \\brief Default constructor\n"
@@ -1267,62 +1330,23 @@ namespace mfront {
        << this->bd.getClassName() << "BehaviourData(const "
        << this->bd.getClassName() << "BehaviourData& src)\n"
        << ": ";
-    auto first = true;
-    if (this->bd.getAttribute(BehaviourDescription::requiresStiffnessTensor,
-                              false)) {
-      os << "D(src.D)";
-      first = false;
-    }
-    if (this->bd.getAttribute(
-            BehaviourDescription::requiresThermalExpansionCoefficientTensor,
-            false)) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << "A(src.A)";
-      first = false;
-    }
-    for (const auto& mv : this->bd.getMainVariables()) {
-      if (!first) {
-        os << ",\n";
-      }
-      if (Gradient::isIncrementKnown(mv.first)) {
-        os << mv.first.name << "(src." << mv.first.name << "),\n";
-      } else {
-        os << mv.first.name << "0(src." << mv.first.name << "0),\n";
-      }
-      os << mv.second.name << "(src." << mv.second.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getMaterialProperties()) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getStateVariables()) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getAuxiliaryStateVariables()) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
-    }
-    for (const auto& v : md.getExternalStateVariables()) {
-      if (!first) {
-        os << ",\n";
-      }
-      os << v.name << "(src." << v.name << ")";
-      first = false;
-    }
+    write_initializers();
     os << "\n{}\n\n";
+    if (this->requiresNumericTypeConversionConstructors(h)) {
+      os << "template <ModellingHypothesis::Hypothesis, typename, bool>\n"
+         << "friend class " << this->bd.getClassName() << "BehaviourData;\n"
+         << "/*!\n"
+         << "* \\brief constructor from the behaviour data of a behaviour\n"
+         << "* using another numeric type\n"
+         << "*/\n"
+         << "template <typename NumericType2>\n"
+         << "explicit " << this->bd.getClassName() << "BehaviourData(const "
+         << this->bd.getClassName()
+         << "BehaviourData<hypothesis, NumericType2, false>& src)\n"
+         << ": ";
+      write_initializers();
+      os << "\n{}\n\n";
+    }
     // Creating constructor for external interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
@@ -2275,12 +2299,12 @@ namespace mfront {
   void BehaviourCodeGeneratorBase::writeBehaviourConstructors(
       std::ostream& os, const Hypothesis h) const {
     auto tmpnames = std::vector<std::string>{};
-    auto write_body = [this, &os, &tmpnames, h] {
+    auto write_body = [this, &os, &tmpnames, h](const std::string& pi) {
       os << "using namespace std;\n"
          << "using namespace tfel::math;\n"
          << "using std::vector;\n";
       writeMaterialLaws(os, this->bd.getMaterialLaws());
-      this->writeBehaviourParameterInitialisation(os, h);
+      this->writeBehaviourParameterInitialisation(os, h, pi);
       // calling models
       for (const auto& m : this->bd.getModelsDescriptions()) {
         auto inputs = std::vector<std::string>{};
@@ -2329,14 +2353,15 @@ namespace mfront {
       os << ",\n" << init;
     }
     os << "\n{\n";
-    write_body();
+    write_body("");
     os << "}\n\n";
     // constructor specific to interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
         i.second->writeBehaviourConstructorHeader(os, this->bd, h, init);
         os << "\n{\n";
-        write_body();
+        write_body(i.second->getBehaviourConstructorParametersInitializer(
+            this->bd, h));
         i.second->writeBehaviourConstructorBody(os, this->bd, h);
         os << "}\n\n";
       }
@@ -3220,13 +3245,23 @@ namespace mfront {
   }
 
   void BehaviourCodeGeneratorBase::writeBehaviourParameterInitialisation(
-      std::ostream& os, const Hypothesis h) const {
+      std::ostream& os, const Hypothesis h, const std::string& pi) const {
     constexpr auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     const auto use_static_variables =
         areParametersTreatedAsStaticVariables(this->bd);
     this->checkBehaviourFile(os);
     const auto& d = this->bd.getBehaviourData(h);
-    for (const auto& p : d.getParameters()) {
+    const auto& parameters = d.getParameters();
+    const auto use_default_parameters_initializer =
+        std::any_of(parameters.begin(), parameters.end(),
+                    [this, h](const VariableDescription& p) {
+                      return (h == uh) || (this->bd.hasParameter(uh, p.name));
+                    });
+    if ((!use_static_variables) && (use_default_parameters_initializer) &&
+        (!pi.empty())) {
+      os << "const auto& mfront_parameters_initializer = " << pi << ";\n";
+    }
+    for (const auto& p : parameters) {
       if (use_static_variables) {
         if (!p.getAttribute<bool>(
                 VariableDescription::variableDeclaredInBaseClass, false)) {
@@ -3264,8 +3299,11 @@ namespace mfront {
           }
         }
       } else {
-        const auto getter = [this, h, &p] {
+        const auto getter = [this, h, &p, &pi]() -> std::string {
           if ((h == uh) || (this->bd.hasParameter(uh, p.name))) {
+            if (!pi.empty()) {
+              return "mfront_parameters_initializer";
+            }
             return this->bd.getClassName() + "ParametersInitializer::get()";
           }
           return this->bd.getClassName() + ModellingHypothesis::toString(h) +
@@ -4087,11 +4125,12 @@ namespace mfront {
          << "static unsigned short getUnsignedShort(const std::string&,const "
             "std::string&);\n";
     }
-    os << "private :\n\n"
-       << cname << "();\n\n"
-       << cname << "(const " << cname << "&);\n\n"
-       << cname << "&\n"
-       << "operator=(const " << cname << "&);\n";
+    os << "//! \\brief copy constructor\n"
+       << cname << "(const " << cname << "&) = default;\n"
+       << "//! \\brief assignement operator\n"
+       << cname << "& operator=(const " << cname << "&) = default;\n\n"
+       << "private :\n\n"
+       << cname << "();\n\n";
     if (allowsParametersInitializationFromFile(this->bd)) {
       os << "/*!\n"
          << " * \\brief read the parameters from the given file\n"
@@ -4877,6 +4916,19 @@ namespace mfront {
   void BehaviourCodeGeneratorBase::writeIntegrationDataConstructors(
       std::ostream& os, const Hypothesis h) const {
     const auto& md = this->bd.getBehaviourData(h);
+    auto write_initializers = [this, &os, &md] {
+      for (const auto& v : this->bd.getMainVariables()) {
+        if (Gradient::isIncrementKnown(v.first)) {
+          os << "d" << v.first.name << "(src.d" << v.first.name << "),\n";
+        } else {
+          os << v.first.name << "1(src." << v.first.name << "1),\n";
+        }
+      }
+      os << "dt(src.dt)";
+      for (const auto& v : md.getExternalStateVariables()) {
+        os << ",\nd" << v.name << "(src.d" << v.name << ")";
+      }
+    };
     this->checkIntegrationDataFile(os);
     os << "/*!\n"
        << "* \\brief Default constructor\n"
@@ -4889,18 +4941,23 @@ namespace mfront {
        << this->bd.getClassName() << "IntegrationData(const "
        << this->bd.getClassName() << "IntegrationData& src)\n"
        << ": ";
-    for (const auto& v : this->bd.getMainVariables()) {
-      if (Gradient::isIncrementKnown(v.first)) {
-        os << "d" << v.first.name << "(src.d" << v.first.name << "),\n";
-      } else {
-        os << v.first.name << "1(src." << v.first.name << "1),\n";
-      }
-    }
-    os << "dt(src.dt)";
-    for (const auto& v : md.getExternalStateVariables()) {
-      os << ",\nd" << v.name << "(src.d" << v.name << ")";
-    }
+    write_initializers();
     os << "\n{}\n\n";
+    if (this->requiresNumericTypeConversionConstructors(h)) {
+      os << "template <ModellingHypothesis::Hypothesis, typename, bool>\n"
+         << "friend class " << this->bd.getClassName() << "IntegrationData;\n"
+         << "/*!\n"
+         << "* \\brief constructor from the integration data of a behaviour\n"
+         << "* using another numeric type\n"
+         << "*/\n"
+         << "template <typename NumericType2>\n"
+         << "explicit " << this->bd.getClassName() << "IntegrationData(const "
+         << this->bd.getClassName()
+         << "IntegrationData<hypothesis, NumericType2, false>& src)\n"
+         << ": ";
+      write_initializers();
+      os << "\n{}\n\n";
+    }
     // Creating constructor for external interfaces
     for (const auto& i : this->interfaces) {
       if (i.second->isBehaviourConstructorRequired(h, this->bd)) {
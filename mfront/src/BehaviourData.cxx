@@ -35,6 +35,7 @@ namespace mfront {
   const char* const BehaviourData::UserDefinedInitializeCodeBlock =
       "UserDefinedInitializeCodeBlock";
   const char* const BehaviourData::FlowRule = "FlowRule";
+  const char* const BehaviourData::VectorizedFlowRule = "VectorizedFlowRule";
   const char* const BehaviourData::BeforeInitializeLocalVariables =
       "BeforeInitializeLocalVariables";
   const char* const BehaviourData::InitializeLocalVariables =
@@ -93,6 +94,13 @@ namespace mfront {
       "compareToNumericalJacobian";
   const char* const BehaviourData::numericallyComputedJacobianBlocks =
       "numericallyComputedJacobianBlocks";
+  const char* const BehaviourData::automaticDifferentiationOfTheJacobian =
+      "automaticDifferentiationOfTheJacobian";
+  const char* const BehaviourData::writtenJacobianBlocks =
+      "writtenJacobianBlocks";
+  const char* const BehaviourData::jacobianBlockEliminationVariable =
+      "jacobianBlockEliminationVariable";
+  const char* const BehaviourData::warmStart = "warmStart";
   const char* const BehaviourData::allowsNewUserDefinedVariables =
       "allowsNewUserDefinedVariables";
   const char* const BehaviourData::algorithm = "algorithm";
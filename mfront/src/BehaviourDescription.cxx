@@ -38,6 +38,8 @@ namespace mfront {
       "modelling_hypothesis";
   const char* const BehaviourDescription::modellingHypotheses =
       "modelling_hypotheses";
+  const char* const BehaviourDescription::vectorizedBatchIntegration =
+      "vectorized_batch_integration";
 
   static MaterialPropertyDescription buildMaterialPropertyDescription(
       const BehaviourDescription::ConstantMaterialProperty& mp,
@@ -12,41 +12,157 @@
  */
 
 #include <ctime>
+#include <bit>
 #include <string>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
+#include <string_view>
+#if (defined __x86_64__) || (defined __i386__) || (defined _M_X64)
+#define MFRONT_PROFILING_HAS_TIME_STAMP_COUNTER
+#if defined _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
 #include "TFEL/Raise.hxx"
 #include "MFront/BehaviourProfiler.hxx"
 
 namespace mfront {
 
+  /*!
+   * \brief structure describing the clock used by the profilers. This
+   * structure is initialized once, when the library is loaded.
+   */
+  struct ProfilingClock {
+    ProfilingClock() {
+#ifdef MFRONT_PROFILING_HAS_TIME_STAMP_COUNTER
+      const auto* const e = std::getenv("MFRONT_PROFILING_CLOCK");
+      if ((e == nullptr) || (std::string_view{e} != "tsc")) {
+        return;
+      }
+      // calibration of the time stamp counter
+      using clock = std::chrono::steady_clock;
+      const auto t0 = clock::now();
+      const auto c0 = __rdtsc();
+      while (clock::now() - t0 < std::chrono::milliseconds(10)) {
+      }
+      const auto c1 = __rdtsc();
+      const auto dt = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          clock::now() - t0)
+                          .count();
+      if (c1 > c0) {
+        this->nanoseconds_per_tick =
+            static_cast<double>(dt) / static_cast<double>(c1 - c0);
+        this->use_time_stamp_counter = true;
+      }
+#endif
+    }  // end of ProfilingClock
+    //! \return the current time, in an unspecified unit
+    std::uint64_t now() const noexcept {
+#ifdef MFRONT_PROFILING_HAS_TIME_STAMP_COUNTER
+      if (this->use_time_stamp_counter) {
+        return __rdtsc();
+      }
+#endif
 #if !(defined _WIN32 || defined _WIN64)
+      timespec t;
+      ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+      return static_cast<std::uint64_t>(t.tv_sec) * 1000000000u +
+             static_cast<std::uint64_t>(t.tv_nsec);
+#else
+      return static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now().time_since_epoch())
+              .count());
+#endif
+    }  // end of now
+    //! \return the time elapsed between two calls to `now`, in nanoseconds
+    std::uint64_t getElapsedTime(const std::uint64_t start,
+                                 const std::uint64_t end) const noexcept {
+      if (end <= start) {
+        return 0;
+      }
+      if (this->use_time_stamp_counter) {
+        return static_cast<std::uint64_t>(
+            static_cast<double>(end - start) * this->nanoseconds_per_tick);
+      }
+      return end - start;
+    }  // end of getElapsedTime
+    //! \return a short description of the clock
+    const char* getName() const noexcept {
+      return this->use_time_stamp_counter ? "time_stamp_counter"
+                                          : "thread_cpu_time";
+    }  // end of getName
+    //! \brief if true, the time stamp counter is used
+    bool use_time_stamp_counter = false;
+    //! \brief conversion factor from time stamp counter ticks to nanoseconds
+    double nanoseconds_per_tick = 1;
+  };  // end of struct ProfilingClock
+
+  //! \brief clock used by all profilers
+  static const ProfilingClock profiling_clock;
+
   /*!
-   * add a new measure
-   * t     : measure to which the new measure is added
-   * start : start of the measure
-   * end   : end of the measure
+   * \brief structure gathering the results of all the profilers and
+   * exporting them at exit in the file given by the
+   * `MFRONT_PROFILING_OUTPUT_FILE` environment variable.
    */
-  static inline void add_measure(std::atomic<intmax_t>& t,
-                                 const timespec& start,
-                                 const timespec& end) {
-    /* http://www.guyrutenberg.com/2007/09/22/profiling-code-using-clock_gettime
+  struct ProfilingResultsExporter {
+    //! \return the unique instance of this class
+    static ProfilingResultsExporter& get() {
+      static ProfilingResultsExporter e;
+      return e;
+    }  // end of get
+    /*!
+     * \brief add the results of a profiler
+     * \param[in] n: name of the behaviour
+     * \param[in] s: statistics
      */
-    timespec temp;
-    if ((end.tv_nsec - start.tv_nsec) < 0) {
-      temp.tv_sec = end.tv_sec - start.tv_sec - 1;
-      temp.tv_nsec = 1000000000 + end.tv_nsec - start.tv_nsec;
-    } else {
-      temp.tv_sec = end.tv_sec - start.tv_sec;
-      temp.tv_nsec = end.tv_nsec - start.tv_nsec;
-    }
-    t += 1000000000 * temp.tv_sec + temp.tv_nsec;
-  }  // end of add_measure
-#endif
+    void add(const std::string& n,
+             const BehaviourProfiler::ThreadStatistics& s) {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->results.emplace_back(n, s);
+    }  // end of add
+    //! \brief destructor
+    ~ProfilingResultsExporter() {
+      const auto* const f = std::getenv("MFRONT_PROFILING_OUTPUT_FILE");
+      if ((f == nullptr) || (this->results.empty())) {
+        return;
+      }
+      const auto file = std::string{f};
+      std::ofstream out(file);
+      if (!out) {
+        std::cerr << "ProfilingResultsExporter: can't open file '" << file
+                  << "'\n";
+        return;
+      }
+      const auto is_csv =
+          (file.size() >= 4) && (file.substr(file.size() - 4) == ".csv");
+      if (is_csv) {
+        BehaviourProfiler::exportToCSV(out, this->results);
+      } else {
+        BehaviourProfiler::exportToJSON(out, this->results);
+      }
+    }  // end of ~ProfilingResultsExporter
+
+   private:
+    ProfilingResultsExporter() = default;
+    //! \brief mutex used to protect the results
+    std::mutex m;
+    //! \brief results of the profilers already destroyed
+    std::vector<std::pair<std::string, BehaviourProfiler::ThreadStatistics>>
+        results;
+  };  // end of struct ProfilingResultsExporter
 
   /*!
    * print a time to the specified stream
@@ -92,7 +208,7 @@ namespace mfront {
     os << t << "nsecs";
   }  // end pf print
 
-  static std::string getCodeBlockName(const unsigned int c) {
+  std::string BehaviourProfiler::getCodeBlockName(const index_type c) {
     auto n = std::string{};
     switch (c) {
       case BehaviourProfiler::FLOWRULE:
@@ -170,46 +286,242 @@ namespace mfront {
             "with the given code block");
     }
     return n;
-  }
+  }  // end of getCodeBlockName
 
-  BehaviourProfiler::Timer::Timer(BehaviourProfiler& t, const unsigned short cn)
-      : gtimer(t), c(cn) {
-#if !(defined _WIN32 || defined _WIN64)
-    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->start));
-#endif
-  }  // end of BehaviourProfiler::Timer
+  BehaviourProfiler::index_type BehaviourProfiler::Statistics::getBinIndex(
+      const std::uint64_t v) noexcept {
+    return static_cast<index_type>(std::bit_width(v));
+  }  // end of getBinIndex
+
+  void BehaviourProfiler::Statistics::add(const std::uint64_t v) noexcept {
+    ++(this->count);
+    this->total += v;
+    ++(this->histogram[getBinIndex(v)]);
+  }  // end of add
+
+  void BehaviourProfiler::Statistics::merge(const Statistics& src) noexcept {
+    this->count += src.count;
+    this->total += src.total;
+    for (std::size_t i = 0; i != this->histogram.size(); ++i) {
+      this->histogram[i] += src.histogram[i];
+    }
+  }  // end of merge
+
+  BehaviourProfiler::Timer::Timer(BehaviourProfiler& t, const index_type cn)
+      : statistics(t.getThreadStatistics()),
+        c(cn),
+        start(profiling_clock.now()) {}  // end of BehaviourProfiler::Timer
 
   BehaviourProfiler::Timer::~Timer() {
-#if !(defined _WIN32 || defined _WIN64)
-    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(this->end));
-    add_measure(this->gtimer.measures[this->c], this->start, this->end);
-#endif
+    const auto end = profiling_clock.now();
+    this->statistics.code_blocks[this->c].add(
+        profiling_clock.getElapsedTime(this->start, end));
   }  // end of BehaviourProfiler::~Timer
 
-  BehaviourProfiler::BehaviourProfiler(const std::string& n) : name(n) {
-    std::fill(begin(measures), end(measures), 0);
+  static std::size_t getNewProfilerIdentifier() {
+    static std::atomic<std::size_t> i{0};
+    return i++;
+  }  // end of getNewProfilerIdentifier
+
+  BehaviourProfiler::BehaviourProfiler(const std::string& n)
+      : name(n), identifier(getNewProfilerIdentifier()) {
+    // the exporter must be created before the profiler, so that it is
+    // destroyed after it
+    ProfilingResultsExporter::get();
   }  // end of BehaviourProfiler::BehaviourProfiler
 
+  BehaviourProfiler::ThreadStatistics&
+  BehaviourProfiler::getThreadStatistics() {
+    // statistics of the calling thread for each profiler
+    thread_local std::vector<std::pair<std::size_t, ThreadStatistics*>> cache;
+    for (const auto& c : cache) {
+      if (c.first == this->identifier) {
+        return *(c.second);
+      }
+    }
+    auto* s = [this] {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->statistics.push_back(std::make_unique<ThreadStatistics>());
+      return this->statistics.back().get();
+    }();
+    cache.emplace_back(this->identifier, s);
+    return *s;
+  }  // end of getThreadStatistics
+
+  void BehaviourProfiler::addNumberOfIterations(const std::uint64_t n) {
+    this->getThreadStatistics().iterations.add(n);
+  }  // end of addNumberOfIterations
+
+  void BehaviourProfiler::addNumberOfWarmStartedIterations(
+      const std::uint64_t n) {
+    auto& s = this->getThreadStatistics();
+    s.iterations.add(n);
+    s.warm_started_iterations.add(n);
+  }  // end of addNumberOfWarmStartedIterations
+
+  double BehaviourProfiler::getEstimatedNumberOfSavedIterations(
+      const ThreadStatistics& s) noexcept {
+    const auto& w = s.warm_started_iterations;
+    const auto nc = s.iterations.count - w.count;
+    if ((w.count == 0) || (nc == 0)) {
+      return 0;
+    }
+    const auto mean = static_cast<double>(s.iterations.total - w.total) /
+                      static_cast<double>(nc);
+    return mean * static_cast<double>(w.count) - static_cast<double>(w.total);
+  }  // end of getEstimatedNumberOfSavedIterations
+
+  BehaviourProfiler::ThreadStatistics BehaviourProfiler::getStatistics()
+      const {
+    auto r = ThreadStatistics{};
+    std::lock_guard<std::mutex> lock(this->m);
+    for (const auto& s : this->statistics) {
+      for (index_type i = 0; i != numberOfCodeBlocks; ++i) {
+        r.code_blocks[i].merge(s->code_blocks[i]);
+      }
+      r.iterations.merge(s->iterations);
+      r.warm_started_iterations.merge(s->warm_started_iterations);
+    }
+    return r;
+  }  // end of getStatistics
+
+  /*!
+   * \brief call the given function for each non empty bin of an histogram
+   * \param[in] s: statistics
+   * \param[in] f: function taking the lower bound, the upper bound and the
+   * number of values of the bin
+   */
+  template <typename Function>
+  static void for_each_bin(const BehaviourProfiler::Statistics& s,
+                           const Function& f) {
+    for (std::size_t i = 0; i != s.histogram.size(); ++i) {
+      if (s.histogram[i] == 0) {
+        continue;
+      }
+      const auto lb = (i == 0) ? std::uint64_t{0} : std::uint64_t{1} << (i - 1);
+      const auto ub = (i == 64) ? std::numeric_limits<std::uint64_t>::max()
+                                : std::uint64_t{1} << i;
+      f(lb, ub, s.histogram[i]);
+    }
+  }  // end of for_each_bin
+
+  static void exportStatisticsToJSON(std::ostream& os,
+                                     const BehaviourProfiler::Statistics& s,
+                                     const char* const total) {
+    os << "\"calls\": " << s.count << ", \"" << total << "\": " << s.total
+       << ", \"histogram\": [";
+    auto first = true;
+    for_each_bin(s, [&os, &first](const std::uint64_t lb,
+                                  const std::uint64_t ub,
+                                  const std::uint64_t n) {
+      if (!first) {
+        os << ", ";
+      }
+      os << "{\"lower_bound\": " << lb << ", \"upper_bound\": " << ub
+         << ", \"count\": " << n << "}";
+      first = false;
+    });
+    os << "]";
+  }  // end of exportStatisticsToJSON
+
+  void BehaviourProfiler::exportToJSON(
+      std::ostream& os,
+      const std::vector<std::pair<std::string, ThreadStatistics>>& r) {
+    os << "{\n"
+       << "  \"clock\": \"" << profiling_clock.getName() << "\",\n"
+       << "  \"time_unit\": \"ns\",\n"
+       << "  \"behaviours\": [";
+    for (std::size_t i = 0; i != r.size(); ++i) {
+      const auto& s = r[i].second;
+      os << ((i == 0) ? "\n" : ",\n") << "    {\n"
+         << "      \"name\": \"" << r[i].first << "\",\n"
+         << "      \"code_blocks\": [";
+      auto first = true;
+      for (index_type c = 0; c != numberOfCodeBlocks; ++c) {
+        if (s.code_blocks[c].count == 0) {
+          continue;
+        }
+        os << (first ? "\n" : ",\n") << "        {\"name\": \""
+           << getCodeBlockName(c) << "\", ";
+        exportStatisticsToJSON(os, s.code_blocks[c], "total_time");
+        os << "}";
+        first = false;
+      }
+      os << "\n      ],\n"
+         << "      \"iterations\": {";
+      exportStatisticsToJSON(os, s.iterations, "total");
+      os << "}";
+      if (s.warm_started_iterations.count != 0) {
+        os << ",\n"
+           << "      \"warm_started_iterations\": {";
+        exportStatisticsToJSON(os, s.warm_started_iterations, "total");
+        os << "},\n"
+           << "      \"estimated_saved_iterations\": "
+           << getEstimatedNumberOfSavedIterations(s);
+      }
+      os << "\n"
+         << "    }";
+    }
+    os << "\n  ]\n"
+       << "}\n";
+  }  // end of exportToJSON
+
+  void BehaviourProfiler::exportToCSV(
+      std::ostream& os,
+      const std::vector<std::pair<std::string, ThreadStatistics>>& r) {
+    auto write = [&os](const std::string& b, const std::string& n,
+                       const Statistics& s) {
+      for_each_bin(s, [&os, &b, &n, &s](const std::uint64_t lb,
+                                        const std::uint64_t ub,
+                                        const std::uint64_t c) {
+        os << b << ',' << n << ',' << s.count << ',' << s.total << ',' << lb
+           << ',' << ub << ',' << c << '\n';
+      });
+    };
+    os << "behaviour,code_block,calls,total,lower_bound,upper_bound,count\n";
+    for (const auto& [b, s] : r) {
+      for (index_type c = 0; c != numberOfCodeBlocks; ++c) {
+        write(b, getCodeBlockName(c), s.code_blocks[c]);
+      }
+      write(b, "Iterations", s.iterations);
+      write(b, "WarmStartedIterations", s.warm_started_iterations);
+    }
+  }  // end of exportToCSV
+
   BehaviourProfiler::~BehaviourProfiler() {
-    using size_type = std::array<std::atomic<std::intmax_t>, 23>::size_type;
+    const auto r = this->getStatistics();
+    const auto& measures = r.code_blocks;
     std::cout << "\nResults of " << this->name << " profiling : ";
-    print_time(std::cout, measures.back());
+    print_time(std::cout, measures[TOTALTIME].total);
     std::cout << '\n';
     std::string::size_type w{0};
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+    for (index_type i = 0; i + 1 != numberOfCodeBlocks; ++i) {
+      if (measures[i].count != 0) {
         w = std::max(w, getCodeBlockName(i).size());
       }
     }
-    for (size_type i = 0; i + 1 != measures.size(); ++i) {
-      if (measures[i] != 0) {
+    for (index_type i = 0; i + 1 != numberOfCodeBlocks; ++i) {
+      if (measures[i].count != 0) {
         std::cout << "- " << std::setw(w) << std::left << getCodeBlockName(i)
                   << " : ";
-        print_time(std::cout, measures[i]);
-        std::cout << " (" << measures[i] << " ns)\n";
+        print_time(std::cout, measures[i].total);
+        std::cout << " (" << measures[i].total << " ns, " << measures[i].count
+                  << " calls)\n";
       }
     }
+    if (r.iterations.count != 0) {
+      std::cout << "- number of iterations: " << r.iterations.total << " ("
+                << r.iterations.count << " calls)\n";
+    }
+    if (r.warm_started_iterations.count != 0) {
+      std::cout << "- number of iterations of warm started calls: "
+                << r.warm_started_iterations.total << " ("
+                << r.warm_started_iterations.count << " calls)\n"
+                << "- estimated number of saved iterations: "
+                << getEstimatedNumberOfSavedIterations(r) << '\n';
+    }
     std::cout << std::endl;
+    ProfilingResultsExporter::get().add(this->name, r);
   }  // end of BehaviourProfiler::~BehaviourProfiler
 
 }  // end of namespace mfront
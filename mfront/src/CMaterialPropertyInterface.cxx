@@ -124,6 +124,10 @@ namespace mfront {
     return false;
   }
 
+  bool CMaterialPropertyInterface::shallGenerateArrayFunction() const {
+    return true;
+  }  // end of shallGenerateArrayFunction
+
   std::string CMaterialPropertyInterface::getCheckBoundsFunctionName(
       const MaterialPropertyDescription& mpd) const {
     const auto material = mpd.material;
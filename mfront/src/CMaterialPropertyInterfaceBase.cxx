@@ -69,6 +69,10 @@ namespace mfront {
     return false;
   }  // end of shallGenerateOverloadedFunctionForQuantities
 
+  bool CMaterialPropertyInterfaceBase::shallGenerateArrayFunction() const {
+    return false;
+  }  // end of shallGenerateArrayFunction
+
   void CMaterialPropertyInterfaceBase::writeHeaderPreprocessorDirectives(
       std::ostream& os, const MaterialPropertyDescription&) const {
     writeExportDirectives(os);
@@ -127,6 +131,9 @@ namespace mfront {
         (this->shallGenerateOverloadedFunctionForQuantities())) {
       os << "#include \"TFEL/Config/TFELTypes.hxx\"\n\n";
     }
+    if ((!mpd.inputs.empty()) && (this->shallGenerateArrayFunction())) {
+      os << "#include <stddef.h>\n\n";
+    }
     writeExportDirectives(os);
     this->writeHeaderPreprocessorDirectives(os, mpd);
     this->writeBeginHeaderNamespace(os);
@@ -214,6 +221,12 @@ namespace mfront {
           }
         }
       }
+      if (this->shallGenerateArrayFunction()) {
+        os << "MFRONT_SHAREDOBJ int " << this->getCallingConvention() << '\n'
+           << this->getFunctionName(mpd) << "_array("
+           << "const double* const, const size_t, const size_t, "
+           << "double* const);\n\n";
+      }
     }
     this->writeEndHeaderNamespace(os);
     os << "#endif /* " << headerGard << " */\n";
@@ -533,6 +546,9 @@ namespace mfront {
           os << "} /* end of " << mpd.className << "_checkBounds */\n\n";
         }
       }
+      if (this->shallGenerateArrayFunction()) {
+        this->writeArrayFunction(os, mpd, fd);
+      }
     }
     this->writeEndSrcNamespace(os);
     os.close();
@@ -644,6 +660,81 @@ namespace mfront {
     os << "return 0;\n";
   }  // end of writeMaterialPropertyCheckBoundsBody
 
+  void CMaterialPropertyInterfaceBase::writeArrayFunction(
+      std::ostream& os,
+      const MaterialPropertyDescription& mpd,
+      const FileDescription& fd) const {
+    const auto checks = !areRuntimeChecksDisabled(mpd);
+    os << "int " << this->getFunctionName(mpd) << "_array("
+       << "const double* const mfront_args, const size_t mfront_stride, "
+       << "const size_t mfront_n, double* const mfront_outputs)\n{\n";
+    writeBeginningOfMaterialPropertyBody(os, mpd, fd, "double", true);
+    for (const auto& p : mpd.parameters) {
+      os << "static constexpr auto " << p.name << " = " << p.type << "("
+         << p.getAttribute<double>(VariableDescription::defaultValue)
+         << ");\n";
+    }
+    os << "auto mfront_invalidate = [mfront_outputs, mfront_n]{\n"
+       << "std::fill(mfront_outputs, mfront_outputs + mfront_n, "
+       << "std::nan(\"\"));\n"
+       << "return -1;\n"
+       << "};\n";
+    if (checks) {
+      os << "if(mfront_stride < " << mpd.inputs.size() << "){\n"
+         << "return mfront_invalidate();\n"
+         << "}\n"
+         << "#ifndef MFRONT_NOERRNO_HANDLING\n"
+         << "const auto mfront_errno_old = errno;\n"
+         << "errno=0;\n"
+         << "#endif /* MFRONT_NOERRNO_HANDLING */\n";
+    }
+    os << "try{\n";
+    writeMaterialPropertyArrayLoop(os, mpd, "mfront_args", "mfront_stride",
+                                   "mfront_n", "mfront_outputs");
+    os << "} catch(...){\n";
+    if (checks) {
+      os << "#ifndef MFRONT_NOERRNO_HANDLING\n"
+         << "errno = mfront_errno_old;\n"
+         << "#endif /* MFRONT_NOERRNO_HANDLING */\n";
+    }
+    os << "return mfront_invalidate();\n"
+       << "}\n";
+    if (!checks) {
+      os << "return 0;\n"
+         << "} /* end of " << mpd.className << "_array */\n\n";
+      return;
+    }
+    os << "#ifndef MFRONT_NOERRNO_HANDLING\n"
+       << "const auto mfront_errno = errno;\n"
+       << "errno = mfront_errno_old;\n"
+       << "if(mfront_errno != 0){\n"
+       << "return mfront_invalidate();\n"
+       << "}\n"
+       << "#endif /* MFRONT_NOERRNO_HANDLING */\n"
+       << "auto mfront_status = 0;\n"
+       << "for(size_t mfront_i = 0; mfront_i != mfront_n; ++mfront_i){\n"
+       << "auto& mfront_value = mfront_outputs[mfront_i];\n";
+    if (mpd.output.hasPhysicalBounds()) {
+      const auto& b = mpd.output.getPhysicalBounds();
+      if (b.boundsType == VariableBoundsDescription::LOWER) {
+        os << "if(mfront_value < " << b.lowerBound << "){\n";
+      } else if (b.boundsType == VariableBoundsDescription::UPPER) {
+        os << "if(mfront_value > " << b.upperBound << "){\n";
+      } else {
+        os << "if((mfront_value < " << b.lowerBound << ")||"
+           << "(mfront_value > " << b.upperBound << ")){\n";
+      }
+      os << "mfront_value = std::nan(\"\");\n"
+         << "}\n";
+    }
+    os << "if(!tfel::math::ieee754::isfinite(mfront_value)){\n"
+       << "mfront_status = -1;\n"
+       << "}\n"
+       << "}\n"
+       << "return mfront_status;\n"
+       << "} /* end of " << mpd.className << "_array */\n\n";
+  }  // end of writeArrayFunction
+
   void CMaterialPropertyInterfaceBase::writeCxxTryBlock(
       std::ostream& os) const {
     os << "try{\n";
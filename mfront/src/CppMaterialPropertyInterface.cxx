@@ -176,6 +176,111 @@ namespace mfront {
     }
   }
 
+  /*!
+   * \brief write the declarations shared by the `operator()` and the
+   * `computeArray` methods
+   * \param[out] src: output stream
+   * \param[in] mpd: material property description
+   * \param[in] fd: file description
+   */
+  static void writeBodyPrologue(std::ostream& src,
+                                const MaterialPropertyDescription& mpd,
+                                const FileDescription& fd) {
+    src << "using namespace std;\n"
+        << "using tfel::math::invert_type;\n"
+        << "using tfel::math::result_type;\n"
+        << "using tfel::math::derivative_type;\n";
+    if (useQuantities(mpd)) {
+      src << "using PhysicalConstants [[maybe_unused]] = "
+          << "tfel::PhysicalConstants<double, true>;\n";
+    } else {
+      src << "using PhysicalConstants [[maybe_unused]] = "
+          << "tfel::PhysicalConstants<double, false>;\n";
+    }
+    src << "[[maybe_unused]] auto min = [](const auto a, const auto b) "
+        << "{ return a < b ? a : b; };\n"
+        << "[[maybe_unused]] auto max = [](const auto a, const auto b) "
+        << "{ return a > b ? a : b; };\n";
+    writeMaterialLaws(src, mpd.materialLaws);
+    writeStaticVariables(src, mpd.staticVars, fd.fileName);
+  }  // end of writeBodyPrologue
+
+  /*!
+   * \brief write the `computeArray` method
+   * \param[out] src: output stream
+   * \param[in] mpd: material property description
+   * \param[in] fd: file description
+   * \param[in] name: name of the class
+   */
+  static void writeComputeArray(std::ostream& src,
+                                const MaterialPropertyDescription& mpd,
+                                const FileDescription& fd,
+                                const std::string& name) {
+    const auto checks = !areRuntimeChecksDisabled(mpd);
+    src << "void " << name << "::computeArray("
+        << "const double* const mfront_args, "
+        << "const std::size_t mfront_stride, "
+        << "const std::size_t mfront_n, "
+        << "double* const mfront_outputs) const\n{\n";
+    writeBodyPrologue(src, mpd, fd);
+    src << "tfel::raise_if(mfront_stride < " << mpd.inputs.size() << ", \""
+        << name << "::computeArray: invalid stride\");\n";
+    if ((checks) &&
+        ((hasBounds(mpd.inputs)) || (hasPhysicalBounds(mpd.inputs)))) {
+      // inputs are checked before any evaluation
+      src << "#ifndef MFRONT_NO_BOUNDS_CHECK\n"
+          << "for (std::size_t mfront_i = 0; mfront_i != mfront_n; "
+          << "++mfront_i) {\n"
+          << "const auto* const mfront_point = "
+          << "mfront_args + mfront_i * mfront_stride;\n"
+          << name << "::checkBounds(";
+      for (std::size_t i = 0; i != mpd.inputs.size(); ++i) {
+        src << (i != 0 ? ", " : "") << "mfront_point[" << i << "]";
+      }
+      src << ");\n"
+          << "}\n"
+          << "#endif /* MFRONT_NO_BOUNDS_CHECK */\n";
+    }
+    if (checks) {
+      src << "#ifndef MFRONT_NOERRNO_HANDLING\n"
+          << "const auto mfront_errno_old = errno;\n"
+          << "errno=0;\n"
+          << "#endif /* MFRONT_NOERRNO_HANDLING */\n";
+    }
+    writeMaterialPropertyArrayLoop(src, mpd, "mfront_args", "mfront_stride",
+                                   "mfront_n", "mfront_outputs");
+    if (!checks) {
+      src << "} // end of " << name << "::computeArray\n\n";
+      return;
+    }
+    src << "#ifndef MFRONT_NOERRNO_HANDLING\n"
+        << "const auto mfront_errno = errno;\n"
+        << "errno = mfront_errno_old;\n"
+        << "tfel::raise_if(mfront_errno != 0, \"" << name
+        << "::computeArray: errno has been set \"\n"
+        << "\"(\" + std::string(::strerror(mfront_errno)) + \")\");\n"
+        << "#endif /* MFRONT_NOERRNO_HANDLING */\n"
+        << "for (std::size_t mfront_i = 0; mfront_i != mfront_n; "
+        << "++mfront_i) {\n";
+    if (useQuantities(mpd)) {
+      src << "const auto " << mpd.output.name << " = " << mpd.output.type
+          << "(mfront_outputs[mfront_i]);\n"
+          << "tfel::raise_if(!tfel::math::ieee754::isfinite("
+          << mpd.output.name << ".getValue()), \"" << name
+          << "::computeArray: invalid result\");\n";
+    } else {
+      src << "const auto " << mpd.output.name
+          << " = mfront_outputs[mfront_i];\n"
+          << "tfel::raise_if(!tfel::math::ieee754::isfinite("
+          << mpd.output.name << "), \"" << name
+          << "::computeArray: invalid result\");\n";
+    }
+    writePhysicalBoundsChecks(src, mpd.output, name);
+    writeBoundsChecks(src, mpd, mpd.output, name);
+    src << "}\n"
+        << "} // end of " << name << "::computeArray\n\n";
+  }  // end of writeComputeArray
+
   std::string CppMaterialPropertyInterface::getName() { return "c++"; }
 
   CppMaterialPropertyInterface::CppMaterialPropertyInterface() = default;
@@ -261,6 +366,7 @@ namespace mfront {
 
     header << "#ifndef LIB_MFRONT_" << makeUpperCase(name) << "_HXX\n"
            << "#define LIB_MFRONT_" << makeUpperCase(name) << "_HXX\n\n"
+           << "#include<cstddef>\n"
            << "#include<ostream>\n"
            << "#include<cmath>\n"
            << "#include<algorithm>\n"
@@ -304,6 +410,18 @@ namespace mfront {
       }
     }
     header << ") const;\n\n";
+    if (!mpd.inputs.empty()) {
+      header << "/*!\n"
+             << " * \\brief evaluate the material property on a set of points\n"
+             << " * \\param[in] args: values of the inputs. The values of the\n"
+             << " * inputs of the i-th point start at `args + i * stride`\n"
+             << " * \\param[in] stride: distance between two points\n"
+             << " * \\param[in] n: number of points\n"
+             << " * \\param[out] outputs: values of the material property\n"
+             << " */\n"
+             << "void computeArray(const double* const, const std::size_t,\n"
+             << "const std::size_t, double* const) const;\n\n";
+    }
     if ((hasBounds(mpd.inputs)) || (hasPhysicalBounds(mpd.inputs))) {
       header << "static void\ncheckBounds(";
       for (auto p4 = mpd.inputs.begin(); p4 != mpd.inputs.end();) {
@@ -437,24 +555,8 @@ namespace mfront {
         src << ",";
       }
     }
-    src << ") const\n{\n"
-        << "using namespace std;\n"
-        << "using tfel::math::invert_type;\n"
-        << "using tfel::math::result_type;\n"
-        << "using tfel::math::derivative_type;\n";
-    if (useQuantities(mpd)) {
-      src << "using PhysicalConstants [[maybe_unused]] = "
-          << "tfel::PhysicalConstants<double, true>;\n";
-    } else {
-      src << "using PhysicalConstants [[maybe_unused]] = "
-          << "tfel::PhysicalConstants<double, false>;\n";
-    }
-    src << "[[maybe_unused]] auto min = [](const auto a, const auto b) "
-	<< "{ return a < b ? a : b; };\n"
-	<< "[[maybe_unused]] auto max = [](const auto a, const auto b) "
-	<< "{ return a > b ? a : b; };\n";
-    writeMaterialLaws(src, mpd.materialLaws);
-    writeStaticVariables(src, mpd.staticVars, fd.fileName);
+    src << ") const\n{\n";
+    writeBodyPrologue(src, mpd, fd);
     for (const auto& i : mpd.inputs) {
       if (useQuantities(mpd)) {
         src << "const auto " << i.name << " = "  //
@@ -514,6 +616,9 @@ namespace mfront {
       src << "return " << mpd.output.name << ";\n";
     }
     src << "} // end of " << name << "::operator()\n\n";
+    if (!mpd.inputs.empty()) {
+      writeComputeArray(src, mpd, fd, name);
+    }
     if ((hasBounds(mpd.inputs)) || (hasPhysicalBounds(mpd.inputs))) {
       src << "void\n";
       src << name;
@@ -13,6 +13,11 @@
 
 #include <sstream>
 #include <fstream>
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <functional>
 #include "TFEL/Raise.hxx"
 #include "TFEL/Config/GetInstallPath.hxx"
 #include "TFEL/System/System.hxx"
@@ -33,6 +38,42 @@ namespace mfront {
    * \param[in] bd: behaviour description
    * \param[in] n: name of the generated function
    */
+  /*!
+   * \brief write the declaration of a function rotating an array of values
+   * using one rotation matrix per element
+   * \param[in] os: output stream
+   * \param[in] fn: name of the function
+   * \param[in] v: description of the values
+   * \param[in] from: frame in which the values are expressed
+   * \param[in] to: frame in which the values are rotated
+   */
+  static void writeArrayByElementsRotationFunctionDeclaration(
+      std::ostream& os,
+      const std::string& fn,
+      const std::string& v,
+      const std::string& from,
+      const std::string& to) {
+    os << "/*!\n"
+       << " * \\brief rotate an array of " << v << " from the " << from
+       << " frame to the " << to << " frame using one rotation matrix per"
+       << " element\n"
+       << " * \\param[out] dest: array of " << v << " in the " << to
+       << " frame\n"
+       << " * \\param[in] src: array of " << v << " in the " << from
+       << " frame\n"
+       << " * \\param[in] rvs: rotation matrices of the elements\n"
+       << " * \\param[in] elements: index of the element associated with"
+       << " each entry of the array\n"
+       << " * \\param[in] s: number of entry of the array to be treated\n"
+       << " */\n"
+       << "MFRONT_SHAREDOBJ void " << fn << "("
+       << "mfront_gb_real* const, "
+       << "const mfront_gb_real* const, "
+       << "const mfront_gb_real* const, "
+       << "const mfront_gb_size_type* const, "
+       << "const mfront_gb_size_type);\n\n";
+  }  // end of writeArrayByElementsRotationFunctionDeclaration
+
   static void writeRotationFunctionsDeclarations(
       std::ostream& os,
       const GenericBehaviourInterface& i,
@@ -77,6 +118,9 @@ namespace mfront {
          << "const mfront_gb_real* const, "
          << "const mfront_gb_real* const, "
          << "const mfront_gb_size_type);\n\n";
+      writeArrayByElementsRotationFunctionDeclaration(
+          os, f + "_rotateArrayOfGradientsByElements",
+          "gradients", "global", "material");
       if (is_finite_strain) {
         os << "/*!\n"
               " * \\brief rotate the Cauchy stress from the material "
@@ -105,8 +149,11 @@ namespace mfront {
            << "mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
-           << "const mfront_gb_size_type);\n\n"
-           << "/*!\n"
+           << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfThermodynamicForcesByElements_CauchyStress",
+            "Cauchy stresses", "material", "global");
+        os << "/*!\n"
               " * \\brief rotate the second Piola-Kirchhoff stress from the"
               " material frame to the global frame\n"
               " * \\param[out] dest: second Piola-Kirchhoff stress in the"
@@ -135,8 +182,11 @@ namespace mfront {
            << "mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
-           << "const mfront_gb_size_type);\n\n"
-           << "/*!\n"
+           << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfThermodynamicForcesByElements_PK2Stress",
+            "second Piola-Kirchhoff stresses", "material", "global");
+        os << "/*!\n"
               " * \\brief rotate the first Piola-Kirchhoff stress from the"
               " material frame to the global frame\n"
               " * \\param[out] dest: first Piola-Kirchhoff stress in the"
@@ -165,8 +215,11 @@ namespace mfront {
            << "mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
-           << "const mfront_gb_size_type);\n\n"
-           << "/*!\n"
+           << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfThermodynamicForcesByElements_PK1Stress",
+            "first Piola-Kirchhoff stresses", "material", "global");
+        os << "/*!\n"
               " * \\brief rotate the derivative of the Cauchy stress with"
               " respect to the deformation gradient from the material frame"
               " to the global frame\n"
@@ -199,8 +252,13 @@ namespace mfront {
            << "mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
-           << "const mfront_gb_size_type);\n\n"
-           << "/*!\n"
+           << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfTangentOperatorBlocksByElements_dsig_dF",
+            "derivatives of the Cauchy stress with respect to the deformation "
+            "gradient",
+            "material", "global");
+        os << "/*!\n"
               " * \\brief rotate the derivative of the first Piola-Kirchhoff"
               " stress with respect to the deformation gradient from the"
               " material frame to the global frame\n"
@@ -235,8 +293,13 @@ namespace mfront {
            << "mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
-           << "const mfront_gb_size_type);\n\n"
-           << "/*!\n"
+           << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfTangentOperatorBlocksByElements_dPK1_dF",
+            "derivatives of the first Piola-Kirchhoff stress with respect to "
+            "the deformation gradient",
+            "material", "global");
+        os << "/*!\n"
               " * \\brief rotate the derivative of the second Piola-Kirchhoff"
               " stress with respect to the Green-Lagrange strain from the"
               " material frame to the global frame\n"
@@ -271,8 +334,13 @@ namespace mfront {
            << "mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
-           << "const mfront_gb_size_type);\n\n"
-           << "/*!\n"
+           << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfTangentOperatorBlocksByElements_dPK2_dEGL",
+            "derivatives of the second Piola-Kirchhoff stress with respect to "
+            "the Green-Lagrange strain",
+            "material", "global");
+        os << "/*!\n"
               " * \\brief rotate the derivative of the Kirchhoff stress with"
               " respect to the spatial increment of the deformation gradient "
               "from the material frame"
@@ -314,6 +382,11 @@ namespace mfront {
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfTangentOperatorBlocksByElements_dtau_ddF",
+            "derivatives of the Kirchhoff stress with respect to the spatial "
+            "increment of the deformation gradient",
+            "material", "global");
       } else {
         os << "/*!\n"
               " * \\brief rotate the thermodynamic forces from the material "
@@ -342,6 +415,9 @@ namespace mfront {
            << "const mfront_gb_real* const, "
               "const mfront_gb_real* const, "
            << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfThermodynamicForcesByElements",
+            "thermodynamic forces", "material", "global");
         os << "/*!\n"
               " * \\brief rotate the tangent operator blocks from the "
               " material frame to the global frame\n"
@@ -371,6 +447,9 @@ namespace mfront {
            << "const mfront_gb_real* const, "
            << "const mfront_gb_real* const, "
            << "const mfront_gb_size_type);\n\n";
+        writeArrayByElementsRotationFunctionDeclaration(
+            os, f + "_rotateArrayOfTangentOperatorBlocksByElements",
+            "tangent operator blocks", "material", "global");
       }
     }  // end of for (const auto h : mhs)
   }  // end of writeRotationFunctionsDeclarations
@@ -560,6 +639,210 @@ namespace mfront {
     }
   }  // end of writeVariableRotation
 
+  /*!
+   * \brief description of the values associated with an integration point
+   * in the arrays treated by the `rotateArrayOf` functions
+   */
+  struct RotatedObjectsDescription {
+    //! \brief objects, described by their type and offset
+    std::vector<std::pair<std::string, size_t>> objects;
+    //! \brief number of values per integration point
+    size_t stride = 0;
+  };  // end of RotatedObjectsDescription
+
+  /*!
+   * \return the type of the object, as defined by the `RotatedObjectType`
+   * enumeration of the `MFront/GenericBehaviour/RotationKernels.hxx` header,
+   * or an empty string if the object can't be treated by the rotation
+   * kernels.
+   * \param[in] f1: type flag of the variable (or of the first variable of a
+   * tangent operator block)
+   * \param[in] f2: type flag of the second variable of a tangent operator
+   * block, if any
+   */
+  static std::string getRotatedObjectType(
+      const SupportedTypes::TypeFlag f1,
+      const SupportedTypes::TypeFlag f2 = SupportedTypes::SCALAR) {
+    if (f1 == SupportedTypes::SCALAR) {
+      if (f2 == SupportedTypes::SCALAR) {
+        return "SCALAR";
+      } else if (f2 == SupportedTypes::STENSOR) {
+        return "STENSOR";
+      } else if (f2 == SupportedTypes::TENSOR) {
+        return "TENSOR";
+      }
+    } else if (f1 == SupportedTypes::STENSOR) {
+      if (f2 == SupportedTypes::SCALAR) {
+        return "STENSOR";
+      } else if (f2 == SupportedTypes::STENSOR) {
+        return "ST2TOST2";
+      } else if (f2 == SupportedTypes::TENSOR) {
+        return "T2TOST2";
+      }
+    } else if (f1 == SupportedTypes::TENSOR) {
+      if (f2 == SupportedTypes::SCALAR) {
+        return "TENSOR";
+      } else if (f2 == SupportedTypes::STENSOR) {
+        return "ST2TOT2";
+      } else if (f2 == SupportedTypes::TENSOR) {
+        return "T2TOT2";
+      }
+    }
+    return "";
+  }  // end of getRotatedObjectType
+
+  /*!
+   * \return the description of the gradients (if `b` is true) or of the
+   * thermodynamic forces (if `b` is false) of an integration point, or an
+   * empty optional if one of those variables can't be treated by the
+   * rotation kernels.
+   * \param[in] bd: behaviour description
+   * \param[in] h: modelling hypothesis
+   * \param[in] b: boolean stating if the gradients shall be considered
+   */
+  static std::optional<RotatedObjectsDescription>
+  getMainVariablesRotatedObjectsDescription(
+      const BehaviourDescription& bd,
+      const tfel::material::ModellingHypothesis::Hypothesis h,
+      const bool b) {
+    auto d = RotatedObjectsDescription{};
+    for (const auto& mv : bd.getMainVariables()) {
+      const auto& v = b ? static_cast<const VariableDescription&>(mv.first)
+                        : static_cast<const VariableDescription&>(mv.second);
+      const auto t = getRotatedObjectType(SupportedTypes::getTypeFlag(v.type));
+      if ((v.arraySize != 1) || (t.empty())) {
+        return {};
+      }
+      d.objects.push_back({t, d.stride});
+      d.stride += static_cast<size_t>(
+          SupportedTypes::getTypeSize(v.type, v.arraySize)
+              .getValueForModellingHypothesis(h));
+    }
+    return d;
+  }  // end of getMainVariablesRotatedObjectsDescription
+
+  /*!
+   * \return the description of the tangent operator blocks of an
+   * integration point, or an empty optional if one of those blocks can't be
+   * treated by the rotation kernels.
+   * \param[in] bd: behaviour description
+   * \param[in] h: modelling hypothesis
+   */
+  static std::optional<RotatedObjectsDescription>
+  getTangentOperatorBlocksRotatedObjectsDescription(
+      const BehaviourDescription& bd,
+      const tfel::material::ModellingHypothesis::Hypothesis h) {
+    auto d = RotatedObjectsDescription{};
+    for (const auto& b : bd.getTangentOperatorBlocks()) {
+      const auto& v1 = b.first;
+      const auto& v2 = b.second;
+      const auto t = getRotatedObjectType(SupportedTypes::getTypeFlag(v1.type),
+                                          SupportedTypes::getTypeFlag(v2.type));
+      if ((v1.arraySize != 1) || (v2.arraySize != 1) || (t.empty())) {
+        return {};
+      }
+      d.objects.push_back({t, d.stride});
+      d.stride += static_cast<size_t>(
+          SupportedTypes::getTypeSize(v1.type, v1.arraySize)
+              .getValueForModellingHypothesis(h) *
+          SupportedTypes::getTypeSize(v2.type, v2.arraySize)
+              .getValueForModellingHypothesis(h));
+    }
+    return d;
+  }  // end of getTangentOperatorBlocksRotatedObjectsDescription
+
+  /*!
+   * \return the description of an array containing a single object per
+   * integration point
+   * \param[in] t: type of the object
+   * \param[in] s: size of the object
+   */
+  static RotatedObjectsDescription getRotatedObjectsDescription(
+      const std::string& t, const size_t s) {
+    auto d = RotatedObjectsDescription{};
+    d.objects.push_back({t, 0});
+    d.stride = s;
+    return d;
+  }  // end of getRotatedObjectsDescription
+
+  /*!
+   * \brief write the functions rotating an array of values using the same
+   * rotation matrix for all the integration points or one rotation matrix
+   * per element.
+   *
+   * If the values can't be treated by the rotation kernels, the given
+   * function is called to write the first function and the second one calls
+   * the first one for each integration point.
+   *
+   * \param[in] os: output stream
+   * \param[in] fa: name of the function using a shared rotation matrix
+   * \param[in] fe: name of the function using one rotation matrix per
+   * element
+   * \param[in] h: modelling hypothesis
+   * \param[in] b: if true, the transpose of the rotation matrix is used
+   * \param[in] d: description of the values of an integration point
+   * \param[in] w: function writing the first function when `d` is empty
+   */
+  static void writeArrayRotationFunctions(
+      std::ostream& os,
+      const std::string& fa,
+      const std::string& fe,
+      const tfel::material::ModellingHypothesis::Hypothesis h,
+      const bool b,
+      const std::optional<RotatedObjectsDescription>& d,
+      const std::function<void()>& w) {
+    const auto N = tfel::material::getSpaceDimension(h);
+    auto write_objects = [&os, &d] {
+      os << "static constexpr auto objects = "
+         << "std::array<mfront::gb::RotatedObject, " << d->objects.size()
+         << ">{";
+      for (auto p = d->objects.begin(); p != d->objects.end();) {
+        os << "mfront::gb::RotatedObject{"
+           << "mfront::gb::RotatedObjectType::" << p->first << ", "
+           << p->second << "}";
+        if (++p != d->objects.end()) {
+          os << ",\n";
+        }
+      }
+      os << "};\n";
+    };
+    if (d.has_value()) {
+      os << "void " << fa << "("
+         << "mfront_gb_real* const dest, "
+         << "const mfront_gb_real* const src, "
+         << "const mfront_gb_real* const rv, "
+         << "const mfront_gb_size_type s){\n";
+      write_objects();
+      os << "mfront::gb::rotateArray<" << N << ">(dest, src, rv, "
+         << (b ? "true" : "false") << ", " << d->stride
+         << ", s, objects);\n"
+         << "}\n\n";
+      os << "void " << fe << "("
+         << "mfront_gb_real* const dest, "
+         << "const mfront_gb_real* const src, "
+         << "const mfront_gb_real* const rvs, "
+         << "const mfront_gb_size_type* const elements, "
+         << "const mfront_gb_size_type s){\n";
+      write_objects();
+      os << "mfront::gb::rotateArrayByElements<" << N
+         << ">(dest, src, rvs, elements, " << (b ? "true" : "false") << ", "
+         << d->stride << ", s, objects);\n"
+         << "}\n\n";
+      return;
+    }
+    w();
+    os << "void " << fe << "("
+       << "mfront_gb_real* const dest, "
+       << "const mfront_gb_real* const src, "
+       << "const mfront_gb_real* const rvs, "
+       << "const mfront_gb_size_type* const elements, "
+       << "const mfront_gb_size_type s){\n"
+       << "std::cerr << \"" << fe << ": \"\n"
+       << "          << \"unsupported variable type\";\n"
+       << "std::exit(-1);\n"
+       << "}\n\n";
+  }  // end of writeArrayRotationFunctions
+
   static void writeGradientsRotationFunctionsImplementation(
       std::ostream& os,
       const GenericBehaviourInterface& i,
@@ -583,28 +866,34 @@ namespace mfront {
       og += SupportedTypes::getTypeSize(g.type, g.arraySize);
     }
     os << "}\n\n";
-    os << "void " << f << "_rotateArrayOfGradients("
-       << "mfront_gb_real* const dest, "
-       << "const mfront_gb_real* const src, "
-       << "const mfront_gb_real* const rv, "
-       << "const mfront_gb_size_type s){\n";
-    writeRotationMatrixDefinition(os, false);
-    os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-    auto gsize = SupportedTypes::TypeSize{};
-    for (const auto& mv : bd.getMainVariables()) {
-      const auto& g = mv.first;
-      gsize += SupportedTypes::getTypeSize(g.type, g.arraySize);
-    }
-    const auto goffset =
-        "idx * " + std::to_string(gsize.getValueForModellingHypothesis(h));
-    og = SupportedTypes::TypeSize{};
-    for (const auto& mv : bd.getMainVariables()) {
-      const auto& g = mv.first;
-      writeVariableRotation(os, h, g, og, goffset);
-      og += SupportedTypes::getTypeSize(g.type, g.arraySize);
-    }
-    os << "}\n";
-    os << "}\n\n";
+    writeArrayRotationFunctions(
+        os, f + "_rotateArrayOfGradients",
+        f + "_rotateArrayOfGradientsByElements", h, false,
+        getMainVariablesRotatedObjectsDescription(bd, h, true), [&] {
+          os << "void " << f << "_rotateArrayOfGradients("
+             << "mfront_gb_real* const dest, "
+             << "const mfront_gb_real* const src, "
+             << "const mfront_gb_real* const rv, "
+             << "const mfront_gb_size_type s){\n";
+          writeRotationMatrixDefinition(os, false);
+          os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
+          auto gsize = SupportedTypes::TypeSize{};
+          for (const auto& mv : bd.getMainVariables()) {
+            const auto& g = mv.first;
+            gsize += SupportedTypes::getTypeSize(g.type, g.arraySize);
+          }
+          const auto goffset =
+              "idx * " +
+              std::to_string(gsize.getValueForModellingHypothesis(h));
+          og = SupportedTypes::TypeSize{};
+          for (const auto& mv : bd.getMainVariables()) {
+            const auto& g = mv.first;
+            writeVariableRotation(os, h, g, og, goffset);
+            og += SupportedTypes::getTypeSize(g.type, g.arraySize);
+          }
+          os << "}\n";
+          os << "}\n\n";
+        });
   }  // end of writeGradientsRotationFunctionsImplementation
 
   static void writeThermodynamicForcesRotationFunctionsImplementation(
@@ -626,10 +915,9 @@ namespace mfront {
     const auto f = i.getFunctionNameForHypothesis(name, h);
     // rotate thermodynamic forces
     if (is_finite_strain) {
-      const auto stensor_offset =
-          "idx * " + std::to_string(tfel::material::getStensorSize(h));
-      const auto tensor_offset =
-          "idx * " + std::to_string(tfel::material::getTensorSize(h));
+      const auto stsize =
+          static_cast<size_t>(tfel::material::getStensorSize(h));
+      const auto tsize = static_cast<size_t>(tfel::material::getTensorSize(h));
       os << "void " << f << "_rotateThermodynamicForces_CauchyStress("
          << "mfront_gb_real* const dest, "
          << "const mfront_gb_real* const src, "
@@ -638,18 +926,10 @@ namespace mfront {
       auto args_cauchy = WriteRotationFunctionArgument{os, h, "sig", 0, ""};
       writeStensorRotation(args_cauchy);
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfThermodynamicForces_CauchyStress("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real* const rv, "
-         << "mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      auto args_cauchy_2 =
-          WriteRotationFunctionArgument{os, h, "sig", 0, stensor_offset};
-      writeStensorRotation(args_cauchy_2);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfThermodynamicForces_CauchyStress",
+          f + "_rotateArrayOfThermodynamicForcesByElements_CauchyStress", h,
+          true, getRotatedObjectsDescription("STENSOR", stsize), {});
       os << "void " << f << "_rotateThermodynamicForces_PK2Stress("
          << "mfront_gb_real* const dest, "
          << "const mfront_gb_real* const src, "
@@ -658,18 +938,10 @@ namespace mfront {
       auto args_pk2 = WriteRotationFunctionArgument{os, h, "pk2", 0, ""};
       writeStensorRotation(args_pk2);
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfThermodynamicForces_PK2Stress("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real* const rv, "
-         << "mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      auto args_pk2_2 =
-          WriteRotationFunctionArgument{os, h, "pk2", 0, stensor_offset};
-      writeStensorRotation(args_pk2_2);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfThermodynamicForces_PK2Stress",
+          f + "_rotateArrayOfThermodynamicForcesByElements_PK2Stress", h, true,
+          getRotatedObjectsDescription("STENSOR", stsize), {});
       os << "void " << f << "_rotateThermodynamicForces_PK1Stress("
          << "mfront_gb_real* const dest, "
          << "const mfront_gb_real* const src, "
@@ -678,18 +950,10 @@ namespace mfront {
       auto args_pk1 = WriteRotationFunctionArgument{os, h, "pk1", 0, ""};
       writeTensorRotation(args_pk1);
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfThermodynamicForces_PK1Stress("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real* const rv, "
-         << "mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      auto args_pk1_2 =
-          WriteRotationFunctionArgument{os, h, "pk1", 0, tensor_offset};
-      writeTensorRotation(args_pk1_2);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfThermodynamicForces_PK1Stress",
+          f + "_rotateArrayOfThermodynamicForcesByElements_PK1Stress", h, true,
+          getRotatedObjectsDescription("TENSOR", tsize), {});
     } else {
       os << "void " << f << "_rotateThermodynamicForces("
          << "mfront_gb_real* const dest, "
@@ -703,28 +967,34 @@ namespace mfront {
         otf += SupportedTypes::getTypeSize(tf.type, tf.arraySize);
       }
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfThermodynamicForces("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real* const rv, "
-         << "mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      auto thsize = SupportedTypes::TypeSize{};
-      for (const auto& mv : bd.getMainVariables()) {
-        const auto& th = mv.second;
-        thsize += SupportedTypes::getTypeSize(th.type, th.arraySize);
-      }
-      const auto thoffset =
-          "idx * " + std::to_string(thsize.getValueForModellingHypothesis(h));
-      otf = SupportedTypes::TypeSize{};
-      for (const auto& mv : bd.getMainVariables()) {
-        const auto& tf = mv.second;
-        writeVariableRotation(os, h, tf, otf, thoffset);
-        otf += SupportedTypes::getTypeSize(tf.type, tf.arraySize);
-      }
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfThermodynamicForces",
+          f + "_rotateArrayOfThermodynamicForcesByElements", h, true,
+          getMainVariablesRotatedObjectsDescription(bd, h, false), [&] {
+            os << "void " << f << "_rotateArrayOfThermodynamicForces("
+               << "mfront_gb_real* const dest, "
+               << "const mfront_gb_real* const src, "
+               << "const mfront_gb_real* const rv, "
+               << "mfront_gb_size_type s){\n";
+            writeRotationMatrixDefinition(os, true);
+            os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
+            auto thsize = SupportedTypes::TypeSize{};
+            for (const auto& mv : bd.getMainVariables()) {
+              const auto& th = mv.second;
+              thsize += SupportedTypes::getTypeSize(th.type, th.arraySize);
+            }
+            const auto thoffset =
+                "idx * " +
+                std::to_string(thsize.getValueForModellingHypothesis(h));
+            otf = SupportedTypes::TypeSize{};
+            for (const auto& mv : bd.getMainVariables()) {
+              const auto& tf = mv.second;
+              writeVariableRotation(os, h, tf, otf, thoffset);
+              otf += SupportedTypes::getTypeSize(tf.type, tf.arraySize);
+            }
+            os << "}\n";
+            os << "}\n\n";
+          });
     }
   }  // end of writeThermodynamicForcesRotationFunctionsImplementation
 
@@ -835,8 +1105,10 @@ namespace mfront {
          (bd.isStrainMeasureDefined()) &&
          (bd.getStrainMeasure() != BehaviourDescription::LINEARISED));
     if (is_finite_strain) {
-      const auto stsize = tfel::material::getStensorSize(h);
-      const auto tsize = tfel::material::getTensorSize(h);
+      const auto stsize =
+          static_cast<size_type>(tfel::material::getStensorSize(h));
+      const auto tsize =
+          static_cast<size_type>(tfel::material::getTensorSize(h));
       os << "void " << f << "_rotateTangentOperatorBlocks_dsig_dF("
          << "mfront_gb_real* const dest, "
          << "const mfront_gb_real* const src, "
@@ -846,18 +1118,10 @@ namespace mfront {
           WriteRotationFunctionArgument{os, h, "dsig_dF", 0, ""};
       writeT2toST2Rotation(args_dsig_dF);
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfTangentOperatorBlocks_dsig_dF("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real* const rv, "
-         << "const mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      auto args_dsig_dF_2 = WriteRotationFunctionArgument{
-          os, h, "dsig_dF", 0, "idx * " + std::to_string(stsize * tsize)};
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      writeT2toST2Rotation(args_dsig_dF_2);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfTangentOperatorBlocks_dsig_dF",
+          f + "_rotateArrayOfTangentOperatorBlocksByElements_dsig_dF", h, true,
+          getRotatedObjectsDescription("T2TOST2", stsize * tsize), {});
       //
       os << "void " << f << "_rotateTangentOperatorBlocks_dPK1_dF("
          << "mfront_gb_real* const dest, "
@@ -868,18 +1132,10 @@ namespace mfront {
           WriteRotationFunctionArgument{os, h, "dpk1_dF", 0, ""};
       writeT2toT2Rotation(args_dPK1_dF);
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfTangentOperatorBlocks_dPK1_dF("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real* const rv, "
-         << "const mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      auto args_dPK1_dF_2 = WriteRotationFunctionArgument{
-          os, h, "dpk1_dF", 0, "idx * " + std::to_string(tsize * tsize)};
-      writeT2toT2Rotation(args_dPK1_dF_2);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfTangentOperatorBlocks_dPK1_dF",
+          f + "_rotateArrayOfTangentOperatorBlocksByElements_dPK1_dF", h, true,
+          getRotatedObjectsDescription("T2TOT2", tsize * tsize), {});
       //
       os << "void " << f << "_rotateTangentOperatorBlocks_dPK2_dEGL("
          << "mfront_gb_real* const dest, "
@@ -890,18 +1146,11 @@ namespace mfront {
           WriteRotationFunctionArgument{os, h, "dpk2_degl", 0, ""};
       writeST2toST2Rotation(args_dpk2_degl);
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfTangentOperatorBlocks_dPK2_dEGL("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real * const rv, "
-         << "const mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      auto args_dpk2_degl_2 = WriteRotationFunctionArgument{
-          os, h, "dpk2_degl", 0, "idx * " + std::to_string(stsize * stsize)};
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      writeST2toST2Rotation(args_dpk2_degl_2);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfTangentOperatorBlocks_dPK2_dEGL",
+          f + "_rotateArrayOfTangentOperatorBlocksByElements_dPK2_dEGL", h,
+          true, getRotatedObjectsDescription("ST2TOST2", stsize * stsize), {});
+      //
       os << "void " << f << "_rotateTangentOperatorBlocks_dtau_ddF("
          << "mfront_gb_real* const dest, "
          << "const mfront_gb_real* const src, "
@@ -911,18 +1160,10 @@ namespace mfront {
           WriteRotationFunctionArgument{os, h, "dtau_ddF", 0, ""};
       writeT2toST2Rotation(args_dtau_ddF);
       os << "}\n\n";
-      os << "void " << f << "_rotateArrayOfTangentOperatorBlocks_dtau_ddF("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-         << "const mfront_gb_real* const rv, "
-         << "const mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      auto args_dtau_ddF_2 = WriteRotationFunctionArgument{
-          os, h, "dtau_ddF", 0, "idx * " + std::to_string(stsize * tsize)};
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      writeT2toST2Rotation(args_dsig_dF_2);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfTangentOperatorBlocks_dtau_ddF",
+          f + "_rotateArrayOfTangentOperatorBlocksByElements_dtau_ddF", h,
+          true, getRotatedObjectsDescription("T2TOST2", stsize * tsize), {});
     } else {
       os << "void " << f << "_rotateTangentOperatorBlocks("
          << "mfront_gb_real* const dest,"
@@ -932,28 +1173,36 @@ namespace mfront {
       writeTangentOperatorRotationFunctionsImplementationBody(
           os, f + "_rotateTangentOperatorBlocks", bd, h);
       os << "}\n\n";
-      auto tob_size = size_type{};
-      for (const auto& to : bd.getTangentOperatorBlocks()) {
-        const auto& v1 = to.first;
-        const auto& v2 = to.second;
-        const auto v1size = SupportedTypes::getTypeSize(v1.type, v1.arraySize);
-        const auto v2size = SupportedTypes::getTypeSize(v2.type, v2.arraySize);
-        tob_size +=
-            static_cast<size_type>(v1size.getValueForModellingHypothesis(h) *
-                                   v2size.getValueForModellingHypothesis(h));
-      }
-      const auto tob_offset = "idx * " + std::to_string(tob_size);
-      os << "void " << f << "_rotateArrayOfTangentOperatorBlocks("
-         << "mfront_gb_real* const dest, "
-         << "const mfront_gb_real* const src, "
-            "const mfront_gb_real* const rv, "
-         << "const mfront_gb_size_type s){\n";
-      writeRotationMatrixDefinition(os, true);
-      os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
-      writeTangentOperatorRotationFunctionsImplementationBody(
-          os, f + "_rotateArrayOfTangentOperatorBlocks", bd, h, tob_offset);
-      os << "}\n";
-      os << "}\n\n";
+      writeArrayRotationFunctions(
+          os, f + "_rotateArrayOfTangentOperatorBlocks",
+          f + "_rotateArrayOfTangentOperatorBlocksByElements", h, true,
+          getTangentOperatorBlocksRotatedObjectsDescription(bd, h), [&] {
+            auto tob_size = size_type{};
+            for (const auto& to : bd.getTangentOperatorBlocks()) {
+              const auto& v1 = to.first;
+              const auto& v2 = to.second;
+              const auto v1size =
+                  SupportedTypes::getTypeSize(v1.type, v1.arraySize);
+              const auto v2size =
+                  SupportedTypes::getTypeSize(v2.type, v2.arraySize);
+              tob_size += static_cast<size_type>(
+                  v1size.getValueForModellingHypothesis(h) *
+                  v2size.getValueForModellingHypothesis(h));
+            }
+            const auto tob_offset = "idx * " + std::to_string(tob_size);
+            os << "void " << f << "_rotateArrayOfTangentOperatorBlocks("
+               << "mfront_gb_real* const dest, "
+               << "const mfront_gb_real* const src, "
+                  "const mfront_gb_real* const rv, "
+               << "const mfront_gb_size_type s){\n";
+            writeRotationMatrixDefinition(os, true);
+            os << "for(mfront_gb_size_type idx=0; idx != s; ++idx){\n";
+            writeTangentOperatorRotationFunctionsImplementationBody(
+                os, f + "_rotateArrayOfTangentOperatorBlocks", bd, h,
+                tob_offset);
+            os << "}\n";
+            os << "}\n\n";
+          });
     }
   }  // end of writeTangentOperatorRotationFunctionsImplementation
 
@@ -1143,7 +1392,8 @@ namespace mfront {
     out << "#ifndef " << hg << "\n"
         << "#define " << hg << "\n\n"
         << "#include\"TFEL/Config/TFELConfig.hxx\"\n"
-        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n\n";
+        << "#include\"MFront/GenericBehaviour/BehaviourData.h\"\n"
+        << "#include\"MFront/GenericBehaviour/BatchBehaviourData.h\"\n\n";
 
     this->writeVisibilityDefines(out);
     out << "#ifdef __cplusplus\n"
@@ -1153,6 +1403,7 @@ namespace mfront {
     writeRotationFunctionsDeclarations(out, *this, bd, name);
     this->writeSetOutOfBoundsPolicyFunctionDeclaration(out, name);
     this->writeSetParametersFunctionsDeclarations(out, bd, name);
+    this->writeParametersSetFunctionsDeclarations(out, bd, name);
 
     for (const auto h : mhs) {
       const auto& d = bd.getBehaviourData(h);
@@ -1172,6 +1423,13 @@ namespace mfront {
           << " */\n"
           << "MFRONT_SHAREDOBJ int " << f
           << "(mfront_gb_BehaviourData* const);\n\n";
+      out << "/*!\n"
+          << " * \\brief integrate the behaviour on a batch of integration "
+          << "points\n"
+          << " * \\param[in,out] d: material data of the batch\n"
+          << " */\n"
+          << "MFRONT_SHAREDOBJ int " << f
+          << "_integrateBatch(mfront_gb_BatchBehaviourData* const);\n\n";
       // postprocessings
       for (const auto& p : d.getPostProcessings()) {
         out << "/*!\n"
@@ -1267,6 +1525,10 @@ namespace mfront {
       raise("unsupported behaviour type");
     }
 
+    out << "#include\"MFront/GenericBehaviour/IntegrateBatch.hxx\"\n";
+    if (bd.getSymmetryType() == mfront::ORTHOTROPIC) {
+      out << "#include\"MFront/GenericBehaviour/RotationKernels.hxx\"\n";
+    }
     out << "#include\"MFront/GenericBehaviour/" << header << "\"\n\n";
 
     this->writeGetOutOfBoundsPolicyFunctionImplementation(out, bd, name);
@@ -1335,6 +1597,10 @@ namespace mfront {
 
     GenericBehaviourSymbolsGenerator sg;
     sg.generateGeneralSymbols(out, *this, bd, fd, mhs, name);
+    // the `_integrateBatch` functions are generated for every modelling
+    // hypothesis
+    exportUnsignedShortSymbol(
+        out, this->getFunctionNameBasis(name) + "_BatchIntegration", 1u);
     if (!bd.areAllMechanicalDataSpecialised(mhs)) {
       const auto uh = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
       sg.generateSymbols(out, *this, bd, fd, name, uh);
@@ -1349,6 +1615,69 @@ namespace mfront {
     this->writeSetOutOfBoundsPolicyFunctionImplementation(out, bd, name);
     // parameters
     this->writeSetParametersFunctionsImplementations(out, bd, name);
+    this->writeParametersSetFunctionsImplementations(out, bd, name);
+    // small strain and general behaviours only read the first value of the
+    // tangent operator to get the integration options. Those options can
+    // thus be decoded once when integrating a batch of integration points.
+    const auto uses_integration_options =
+        (type == BehaviourDescription::GENERALBEHAVIOUR) ||
+        (type == BehaviourDescription::COHESIVEZONEMODEL) ||
+        ((type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
+         (!is_finite_strain_through_strain_measure));
+    const auto number_of_options = uses_integration_options ? 1 : 3;
+    // behaviours generated by the isotropic DSLs may provide a vectorized
+    // version of their Newton algorithm
+    const auto use_vectorized_batch_integration =
+        (bd.getAttribute(BehaviourDescription::vectorizedBatchIntegration,
+                         false)) &&
+        (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) &&
+        (uses_integration_options) &&
+        (!this->shallGenerateMTestFileOnFailure(bd));
+    // write the call to the integration of one integration point
+    auto write_integration_call = [this, &out, &bd, &name, &raise, type,
+                                   is_finite_strain_through_strain_measure](
+                                      const Hypothesis h,
+                                      const std::string& policy,
+                                      const std::string& options) {
+      const auto extra_arguments =
+          options.empty() ? policy : policy + ", " + options;
+      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
+          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
+        out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
+            << "Behaviour::STANDARDTANGENTOPERATOR, " << extra_arguments
+            << ");\n";
+      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
+        if (is_finite_strain_through_strain_measure) {
+          const auto ms = bd.getStrainMeasure();
+          if (ms == BehaviourDescription::GREENLAGRANGE) {
+            out << "const auto r = "
+                << "mfront::gb::green_lagrange_strain::integrate<Behaviour>("
+                << "*d, " << policy << ");\n";
+          } else if (ms == BehaviourDescription::HENCKY) {
+            out << "const auto r = "
+                << "mfront::gb::logarithmic_strain::integrate<Behaviour>("
+                << "*d, " << policy << ");\n";
+          } else {
+            raise("unsupported strain measure");
+          }
+        } else {
+          out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
+              << "Behaviour::STANDARDTANGENTOPERATOR, " << extra_arguments
+              << ");\n";
+        }
+      } else if (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
+        out << "const auto r = "
+            << "mfront::gb::finite_strain::integrate<Behaviour>(*d, "  //
+            << policy << ");\n";
+      } else {
+        raise("unsupported behaviour type");
+      }
+      if (this->shallGenerateMTestFileOnFailure(bd)) {
+        out << "if(r!=1){\n";
+        this->generateMTestFile(out, bd, h);
+        out << "}\n";
+      }
+    };
     // behaviour implementations
     for (const auto h : mhs) {
       const auto& d = bd.getBehaviourData(h);
@@ -1425,44 +1754,55 @@ namespace mfront {
       if (this->shallGenerateMTestFileOnFailure(bd)) {
         out << "using mfront::SupportedTypes;\n";
       }
-      if ((type == BehaviourDescription::GENERALBEHAVIOUR) ||
-          (type == BehaviourDescription::COHESIVEZONEMODEL)) {
-        out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-            << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-            << "_getOutOfBoundsPolicy());\n";
-      } else if (type == BehaviourDescription::STANDARDSTRAINBASEDBEHAVIOUR) {
-        if (is_finite_strain_through_strain_measure) {
-          const auto ms = bd.getStrainMeasure();
-          if (ms == BehaviourDescription::GREENLAGRANGE) {
-            out << "const auto r = "
-                << "mfront::gb::green_lagrange_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else if (ms == BehaviourDescription::HENCKY) {
-            out << "const auto r = "
-                << "mfront::gb::logarithmic_strain::integrate<Behaviour>("
-                << "*d, " << name << "_getOutOfBoundsPolicy());\n";
-          } else {
-            raise("unsupported strain measure");
-          }
-        } else {
-          out << "const auto r = mfront::gb::integrate<Behaviour>(*d, "
-              << "Behaviour::STANDARDTANGENTOPERATOR, " << name
-              << "_getOutOfBoundsPolicy());\n";
-        }
-      } else if (type == BehaviourDescription::STANDARDFINITESTRAINBEHAVIOUR) {
-        out << "const auto r = "
-            << "mfront::gb::finite_strain::integrate<Behaviour>(*d, "  //
-            << name << "_getOutOfBoundsPolicy());\n";
+      write_integration_call(h, name + "_getOutOfBoundsPolicy()", "");
+      out << "return r;\n"
+          << "} // end of " << f << "\n\n";
+      // batch integration
+      out << "MFRONT_SHAREDOBJ int " << f << "_integrateBatch"
+          << "(mfront_gb_BatchBehaviourData* const bd){\n"
+          << "using namespace tfel::material;\n";
+      out << "using real = mfront::gb::real;\n"
+          << "constexpr auto h = ModellingHypothesis::"
+          << ModellingHypothesis::toUpperCaseString(h) << ";\n";
+      if (bd.useQt()) {
+        out << "using Behaviour = " << bd.getClassName() << "<h,real,true>;\n";
       } else {
-        raise("unsupported behaviour type");
+        out << "using Behaviour = " << bd.getClassName() << "<h,real,false>;\n";
+      }
+      if (bd.getAttribute(BehaviourData::profiling, false)) {
+        out << "using mfront::BehaviourProfiler;\n"
+            << "using tfel::material::" << bd.getClassName() << "Profiler;\n"
+            << "BehaviourProfiler::Timer total_timer(" << bd.getClassName()
+            << "Profiler::getProfiler(),\n"
+            << "BehaviourProfiler::TOTALTIME);\n";
       }
       if (this->shallGenerateMTestFileOnFailure(bd)) {
-        out << "if(r!=1){\n";
-        this->generateMTestFile(out, bd, h);
-        out << "}\n";
+        out << "using mfront::SupportedTypes;\n";
       }
-      out << "return r;\n"
-          << "} // end of " << f << "\n\n";
+      out << "const auto policy = " << name << "_getOutOfBoundsPolicy();\n";
+      if (use_vectorized_batch_integration) {
+        out << "const auto options = "
+            << "mfront::gb::getIntegrationOptions(bd->K);\n"
+            << "return mfront::gb::integrateVectorizedBatch<Behaviour>(*bd, "
+            << "Behaviour::STANDARDTANGENTOPERATOR, policy, options);\n";
+      } else {
+        if (uses_integration_options) {
+          out << "const auto options = "
+              << "mfront::gb::getIntegrationOptions(bd->K);\n"
+              << "const auto integrate = [policy, &options]"
+              << "(mfront_gb_BehaviourData* const d){\n";
+          write_integration_call(h, "policy", "options");
+        } else {
+          out << "const auto integrate = [policy]"
+              << "(mfront_gb_BehaviourData* const d){\n";
+          write_integration_call(h, "policy", "");
+        }
+        out << "return r;\n"
+            << "};\n"
+            << "return mfront::gb::integrateBatch<" << number_of_options
+            << ">(*bd, integrate);\n";
+      }
+      out << "} // end of " << f << "_integrateBatch\n\n";
     }
     // postprocessings
     for (const auto h : mhs) {
@@ -1812,6 +2152,174 @@ namespace mfront {
     }
   }  // end of writeBehaviourConstructorHeader
 
+  /*!
+   * \return if the parameters of the behaviour can be gathered in a
+   * parameters set, i.e. if the behaviour has parameters defined for the
+   * default modelling hypothesis and if those parameters are not treated as
+   * static variables.
+   * \param[in] bd: behaviour description
+   */
+  static bool GenericBehaviourInterface_hasParametersSet(
+      const BehaviourDescription& bd) {
+    const auto uh = tfel::material::ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    return (!areParametersTreatedAsStaticVariables(bd)) &&
+           (bd.hasParameters(uh));
+  }  // end of GenericBehaviourInterface_hasParametersSet
+
+  /*!
+   * \return if the behaviour has real, integer and unsigned short parameters
+   * for the default modelling hypothesis.
+   * \param[in] bd: behaviour description
+   */
+  static std::tuple<bool, bool, bool>
+  GenericBehaviourInterface_getParametersTypes(const BehaviourDescription& bd) {
+    const auto uh = tfel::material::ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    auto r = std::tuple<bool, bool, bool>{false, false, false};
+    for (const auto& p : bd.getBehaviourData(uh).getParameters()) {
+      if (p.type == "int") {
+        std::get<1>(r) = true;
+      } else if (p.type == "ushort") {
+        std::get<2>(r) = true;
+      } else {
+        std::get<0>(r) = true;
+      }
+    }
+    return r;
+  }  // end of GenericBehaviourInterface_getParametersTypes
+
+  std::string
+  GenericBehaviourInterface::getBehaviourConstructorParametersInitializer(
+      const BehaviourDescription& bd, const Hypothesis) const {
+    if (!GenericBehaviourInterface_hasParametersSet(bd)) {
+      return {};
+    }
+    const auto cname = bd.getClassName() + "ParametersInitializer";
+    return "((mgb_d.parameters != nullptr) ? *(reinterpret_cast<const " +
+           cname + "*>(mgb_d.parameters)) : " + cname + "::get())";
+  }  // end of getBehaviourConstructorParametersInitializer
+
+  void GenericBehaviourInterface::writeParametersSetFunctionsDeclarations(
+      std::ostream& out,
+      const BehaviourDescription& bd,
+      const std::string& name) const {
+    if (!GenericBehaviourInterface_hasParametersSet(bd)) {
+      return;
+    }
+    const auto fctName = this->getFunctionNameBasis(name);
+    out << "/*!\n"
+        << " * \\return a new set of parameters initialized with the current\n"
+        << " * values of the parameters, or a null pointer on failure.\n"
+        << " */\n"
+        << "MFRONT_SHAREDOBJ mfront_gb_ParametersSet*\n"
+        << fctName << "_createParametersSet(void);\n\n"
+        << "/*!\n"
+        << " * \\return a copy of the given set of parameters.\n"
+        << " * \\param[in] s: set of parameters\n"
+        << " */\n"
+        << "MFRONT_SHAREDOBJ mfront_gb_ParametersSet*\n"
+        << fctName
+        << "_copyParametersSet(const mfront_gb_ParametersSet* const);\n\n";
+    const auto [rp, ip, up] = GenericBehaviourInterface_getParametersTypes(bd);
+    if (rp) {
+      out << "MFRONT_SHAREDOBJ int\n"
+          << fctName << "_setParameterInParametersSet("
+          << "mfront_gb_ParametersSet* const, const char* const,"
+          << "const double);\n\n";
+    }
+    if (ip) {
+      out << "MFRONT_SHAREDOBJ int\n"
+          << fctName << "_setIntegerParameterInParametersSet("
+          << "mfront_gb_ParametersSet* const, const char* const,"
+          << "const int);\n\n";
+    }
+    if (up) {
+      out << "MFRONT_SHAREDOBJ int\n"
+          << fctName << "_setUnsignedShortParameterInParametersSet("
+          << "mfront_gb_ParametersSet* const, const char* const,"
+          << "const unsigned short);\n\n";
+    }
+    out << "/*!\n"
+        << " * \\brief destroy a set of parameters\n"
+        << " * \\param[in] s: set of parameters\n"
+        << " */\n"
+        << "MFRONT_SHAREDOBJ void\n"
+        << fctName
+        << "_destroyParametersSet(mfront_gb_ParametersSet* const);\n\n";
+  }  // end of writeParametersSetFunctionsDeclarations
+
+  void GenericBehaviourInterface::writeParametersSetFunctionsImplementations(
+      std::ostream& out,
+      const BehaviourDescription& bd,
+      const std::string& name) const {
+    if (!GenericBehaviourInterface_hasParametersSet(bd)) {
+      return;
+    }
+    const auto fctName = this->getFunctionNameBasis(name);
+    const auto cname = bd.getClassName() + "ParametersInitializer";
+    out << "MFRONT_SHAREDOBJ mfront_gb_ParametersSet*\n"
+        << fctName << "_createParametersSet(void){\n"
+        << "using tfel::material::" << cname << ";\n"
+        << "try{\n"
+        << "auto* const s = new " << cname << "(" << cname << "::get());\n"
+        << "return reinterpret_cast<mfront_gb_ParametersSet*>(s);\n"
+        << "} catch(std::exception& e){\n"
+        << "std::cerr << e.what() << std::endl;\n"
+        << "}\n"
+        << "return nullptr;\n"
+        << "}\n\n"
+        << "MFRONT_SHAREDOBJ mfront_gb_ParametersSet*\n"
+        << fctName << "_copyParametersSet("
+        << "const mfront_gb_ParametersSet* const src){\n"
+        << "using tfel::material::" << cname << ";\n"
+        << "if(src == nullptr){\n"
+        << "return nullptr;\n"
+        << "}\n"
+        << "try{\n"
+        << "auto* const s = new " << cname << "(*(reinterpret_cast<const "
+        << cname << "*>(src)));\n"
+        << "return reinterpret_cast<mfront_gb_ParametersSet*>(s);\n"
+        << "} catch(std::exception& e){\n"
+        << "std::cerr << e.what() << std::endl;\n"
+        << "}\n"
+        << "return nullptr;\n"
+        << "}\n\n";
+    auto write_setter = [&out, &fctName, &cname](const std::string& n,
+                                                 const std::string& t) {
+      out << "MFRONT_SHAREDOBJ int\n"
+          << fctName << "_set" << n << "InParametersSet("
+          << "mfront_gb_ParametersSet* const s, const char* const key,"
+          << "const " << t << " value){\n"
+          << "using tfel::material::" << cname << ";\n"
+          << "if(s == nullptr){\n"
+          << "return 0;\n"
+          << "}\n"
+          << "try{\n"
+          << "reinterpret_cast<" << cname << "*>(s)->set(key, value);\n"
+          << "} catch(std::runtime_error& e){\n"
+          << "std::cerr << e.what() << std::endl;\n"
+          << "return 0;\n"
+          << "}\n"
+          << "return 1;\n"
+          << "}\n\n";
+    };
+    const auto [rp, ip, up] = GenericBehaviourInterface_getParametersTypes(bd);
+    if (rp) {
+      write_setter("Parameter", "double");
+    }
+    if (ip) {
+      write_setter("IntegerParameter", "int");
+    }
+    if (up) {
+      write_setter("UnsignedShortParameter", "unsigned short");
+    }
+    out << "MFRONT_SHAREDOBJ void\n"
+        << fctName
+        << "_destroyParametersSet(mfront_gb_ParametersSet* const s){\n"
+        << "using tfel::material::" << cname << ";\n"
+        << "delete reinterpret_cast<" << cname << "*>(s);\n"
+        << "}\n\n";
+  }  // end of writeParametersSetFunctionsImplementations
+
   static void GenericBehaviourInterface_initializeVariable(
       std::ostream& os,
       const SupportedTypes::TypeSize& o,
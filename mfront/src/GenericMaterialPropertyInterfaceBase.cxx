@@ -285,6 +285,15 @@ namespace mfront {
        << "const " << types.real_type << "* const,"
        << "const " << types.integer_type << ","
        << "const " << types.out_of_bounds_policy_type << ");\n\n";
+    if (!mpd.inputs.empty()) {
+      os << "MFRONT_SHAREDOBJ void\n"
+         << name << "_array(" << types.output_status_type << "* const,"
+         << "const " << types.real_type << "* const,"
+         << "const " << types.integer_type << ","
+         << "const " << types.integer_type << ","
+         << types.real_type << "* const,"
+         << "const " << types.out_of_bounds_policy_type << ");\n\n";
+    }
     if (!mpd.parameters.empty()) {
       os << "MFRONT_SHAREDOBJ int\n"
          << name << "_setParameter(const char *const,"
@@ -548,13 +557,183 @@ namespace mfront {
     } else {
       os << "return " << mpd.output.name << ";\n";
     }
-    os << "} // end of " << name << "\n\n"
-       << "#ifdef __cplusplus\n"
+    os << "} // end of " << name << "\n\n";
+    if (!mpd.inputs.empty()) {
+      this->writeArrayFunction(os, mpd, fd);
+    }
+    os << "#ifdef __cplusplus\n"
        << "} // end of extern \"C\"\n"
        << "#endif /* __cplusplus */\n\n";
     os.close();
   }  // end of writeSrcFile()
 
+  void GenericMaterialPropertyInterfaceBase::writeArrayFunction(
+      std::ostream& os,
+      const MaterialPropertyDescription& mpd,
+      const FileDescription& fd) const {
+    const auto types = this->getTypesDescription();
+    const auto iucname = this->getInterfaceNameInUpperCase();
+    const auto iname = this->getInterfaceName();
+    const auto prefix = this->getOutOfBoundsPolicyEnumerationPrefix();
+    const auto name = this->getFunctionName(mpd);
+    const auto& params = mpd.parameters;
+    const auto checks = !areRuntimeChecksDisabled(mpd);
+    const auto has_bounds = (hasBounds(mpd.inputs)) || (hasBounds(mpd.output));
+    os << "MFRONT_SHAREDOBJ void\n"
+       << name << "_array(" << types.output_status_type
+       << "* const mfront_output_status,\n"
+       << "const " << types.real_type << "* const mfront_args,\n"
+       << "const " << types.integer_type << " mfront_stride,\n"
+       << "const " << types.integer_type << " mfront_n,\n"
+       << types.real_type << "* const mfront_outputs,\n"
+       << "const " << types.out_of_bounds_policy_type;
+    if (checks && has_bounds) {
+      os << " mfront_out_of_bounds_policy";
+    }
+    os << ")\n{\n";
+    writeBeginningOfMaterialPropertyBody(os, mpd, fd, "double", true);
+    os << "auto mfront_report = "
+       << "[&mfront_output_status](const std::string& "
+       << "mfront_error_message){\n"
+       << "if(mfront_error_message.empty()){\n"
+       << "return;\n"
+       << "}\n"
+       << "std::strncpy(mfront_output_status->msg,"
+       << "mfront_error_message.c_str(),511);\n"
+       << "mfront_output_status->msg[511]='\\0';\n"
+       << "};\n"
+       << "auto mfront_invalidate = [mfront_outputs, mfront_n]{\n"
+       << "std::fill(mfront_outputs, mfront_outputs + mfront_n, "
+       << "std::nan(\"\"));\n"
+       << "};\n"
+       << "const int mfront_errno_old = errno;\n"
+       << "mfront_output_status->status = 0;\n"
+       << "mfront_output_status->bounds_status = 0;\n"
+       << "mfront_output_status->c_error_number = 0;\n";
+    if (checks) {
+      os << "if(mfront_stride < " << mpd.inputs.size() << "){\n"
+         << "mfront_output_status->status = -5;\n"
+         << "mfront_report(\"invalid stride "
+         << "(\"+std::to_string(mfront_stride)+\" given, at least "
+         << mpd.inputs.size() << " expected)\");\n"
+         << "mfront_invalidate();\n"
+         << "return;\n"
+         << "}\n";
+      if ((!areParametersTreatedAsStaticVariables(mpd)) && (!params.empty())) {
+        const auto hn = getMaterialPropertyParametersHandlerClassName(name);
+        os << "if(!" << iname << "::" << hn << "::get" << hn << "().ok){\n"
+           << "mfront_output_status->status = -6;\n"
+           << "mfront_report(" << iname << "::" << hn << "::get" << hn
+           << "().msg);\n"
+           << "mfront_invalidate();\n"
+           << "return;\n"
+           << "}\n";
+      }
+    }
+    writeAssignMaterialPropertyParameters(os, mpd, name, "real", iname);
+    // checks of the bounds of the inputs, point by point. The checks return
+    // `nan` if the evaluation must be stopped.
+    if ((checks) &&
+        ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs)))) {
+      os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n"
+         << "auto mfront_check_inputs = [&](const " << types.real_type
+         << "* const mfront_params) -> real {\n";
+      auto i = std::size_t{};
+      for (const auto& v : mpd.inputs) {
+        os << "[[maybe_unused]] const auto " << v.name << " = ";
+        if (useQuantities(mpd)) {
+          os << v.type << "(mfront_params[" << i << "]);\n";
+        } else {
+          os << "mfront_params[" << i << "];\n";
+        }
+        ++i;
+      }
+      for (i = 0; i != mpd.inputs.size(); ++i) {
+        writePhysicalBounds(os, mpd.inputs[i], i + 1, useQuantities(mpd));
+      }
+      for (i = 0; i != mpd.inputs.size(); ++i) {
+        writeBounds(os, prefix, mpd.inputs[i], i + 1, useQuantities(mpd));
+      }
+      os << "return 0;\n"
+         << "};\n"
+         << "for(" << types.integer_type
+         << " mfront_i = 0; mfront_i != mfront_n; ++mfront_i){\n"
+         << "if(std::isnan(mfront_check_inputs(mfront_args + mfront_i * "
+         << "mfront_stride))){\n"
+         << "mfront_invalidate();\n"
+         << "return;\n"
+         << "}\n"
+         << "}\n"
+         << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+    }
+    os << "errno = 0;\n"
+       << "try{\n";
+    writeMaterialPropertyArrayLoop(os, mpd, "mfront_args", "mfront_stride",
+                                   "mfront_n", "mfront_outputs");
+    os << "} catch(std::exception& e){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(e.what());\n"
+       << "errno = mfront_errno_old;\n"
+       << "mfront_invalidate();\n"
+       << "return;\n"
+       << "} catch(...){\n"
+       << "mfront_output_status->status = -2;\n"
+       << "mfront_report(\"unknown C++ exception\");\n"
+       << "errno = mfront_errno_old;\n"
+       << "mfront_invalidate();\n"
+       << "return;\n"
+       << "}\n";
+    if (checks) {
+      os << "if (errno != 0) {\n"
+         << "mfront_output_status->status = -3;\n"
+         << "mfront_output_status->c_error_number = errno;\n"
+         << "mfront_report(strerror(errno));\n"
+         << "}\n"
+         << "errno = mfront_errno_old;\n"
+         << "if(mfront_output_status->status < 0){\n"
+         << "return;\n"
+         << "}\n"
+         << "for(" << types.integer_type
+         << " mfront_i = 0; mfront_i != mfront_n; ++mfront_i){\n"
+         << "if(!tfel::math::ieee754::isfinite(mfront_outputs[mfront_i])){\n"
+         << "mfront_output_status->status = -4;\n"
+         << "mfront_report(\"invalid result at point \" + "
+         << "std::to_string(mfront_i));\n"
+         << "return;\n"
+         << "}\n"
+         << "}\n";
+      if ((mpd.output.hasPhysicalBounds()) || (mpd.output.hasBounds())) {
+        const auto& v = mpd.output;
+        const auto n = mpd.inputs.size() + 1;
+        os << "#ifndef NO_" << iucname << "_BOUNDS_CHECK\n"
+           << "auto mfront_check_output = [&](const " << types.real_type
+           << " mfront_value) -> real {\n"
+           << "const auto " << v.name << " = ";
+        if (useQuantities(mpd)) {
+          os << v.type << "(mfront_value);\n";
+        } else {
+          os << "mfront_value;\n";
+        }
+        writePhysicalBounds(os, v, n, useQuantities(mpd));
+        writeBounds(os, prefix, v, n, useQuantities(mpd));
+        os << "return 0;\n"
+           << "};\n"
+           << "for(" << types.integer_type
+           << " mfront_i = 0; mfront_i != mfront_n; ++mfront_i){\n"
+           << "if(std::isnan(mfront_check_output("
+           << "mfront_outputs[mfront_i]))){\n"
+           << "mfront_invalidate();\n"
+           << "return;\n"
+           << "}\n"
+           << "}\n"
+           << "#endif /* NO_" << iucname << "_BOUNDS_CHECK */\n";
+      }
+    } else {
+      os << "errno = mfront_errno_old;\n";
+    }
+    os << "} // end of " << name << "_array\n\n";
+  }  // end of writeArrayFunction
+
   GenericMaterialPropertyInterfaceBase::
       ~GenericMaterialPropertyInterfaceBase() = default;
 
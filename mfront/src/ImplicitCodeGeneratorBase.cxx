@@ -112,8 +112,70 @@ namespace mfront {
                        "ModellingHypothesisToTensorSize<" + hn + ">::value"});
     os << "friend struct tfel::math::TinyNonLinearSolverBase<" << n
        << ", NumericType, " << this->bd.getClassName() << ">;\n";
+    if (this->requiresNumericTypeConversionConstructors(h)) {
+      os << "template <ModellingHypothesis::Hypothesis, typename, bool>\n"
+         << "friend struct " << this->bd.getClassName() << ";\n";
+    }
   }  // end of writeBehaviourFriends
 
+  bool ImplicitCodeGeneratorBase::requiresNumericTypeConversionConstructors(
+      const Hypothesis h) const {
+    return this->bd.getAttribute(
+        h, BehaviourData::automaticDifferentiationOfTheJacobian, false);
+  }  // end of requiresNumericTypeConversionConstructors
+
+  void ImplicitCodeGeneratorBase::writeBehaviourConstructors(
+      std::ostream& os, const Hypothesis h) const {
+    BehaviourCodeGeneratorBase::writeBehaviourConstructors(os, h);
+    if (!this->requiresNumericTypeConversionConstructors(h)) {
+      return;
+    }
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto use_static_variables =
+        areParametersTreatedAsStaticVariables(this->bd);
+    const auto& init = this->getBehaviourConstructorsInitializers(h);
+    const auto qt = this->bd.useQt() ? "use_qt" : "false";
+    os << "/*!\n"
+       << "* \\brief constructor from a behaviour using another numeric "
+          "type.\n"
+       << "*\n"
+       << "* This constructor is used to compute the jacobian by automatic\n"
+       << "* differentiation.\n"
+       << "*/\n"
+       << "template <typename NumericType2>\n"
+       << "explicit " << this->bd.getClassName() << "(const "
+       << this->bd.getClassName() << "<hypothesis, NumericType2, false>& src)\n"
+       << ": " << this->bd.getClassName() << "BehaviourData<hypothesis, "
+       << "NumericType, " << qt << ">(src),\n"
+       << this->bd.getClassName() << "IntegrationData<hypothesis, "
+       << "NumericType, " << qt << ">(src)";
+    if (!init.empty()) {
+      os << ",\n" << init;
+    }
+    os << "\n{\n";
+    for (const auto& p : d.getParameters()) {
+      if ((use_static_variables) &&
+          (!p.getAttribute<bool>(
+              VariableDescription::variableDeclaredInBaseClass, false))) {
+        continue;
+      }
+      os << "this->" << p.name << " = src." << p.name << ";\n";
+    }
+    // local variables of types which can't be converted (user defined
+    // types, references initialized in the initializers list, etc.) are
+    // ignored
+    for (const auto& v : d.getLocalVariables()) {
+      os << "if constexpr (std::is_assignable_v<decltype((this->" << v.name
+         << ")), decltype((src." << v.name << "))>){\n"
+         << "this->" << v.name << " = src." << v.name << ";\n"
+         << "}\n";
+    }
+    os << "this->zeros = src.zeros;\n"
+       << "this->iter = src.iter;\n"
+       << "this->stiffness_matrix_type = src.stiffness_matrix_type;\n"
+       << "}\n\n";
+  }  // end of writeBehaviourConstructors
+
   void ImplicitCodeGeneratorBase::writeDerivativeView(
       std::ostream& os, const DerivativeViewDescription& d) const {
     const auto v1 = d.first_variable;
@@ -287,6 +349,12 @@ namespace mfront {
        << "#include\"TFEL/Math/Matrix/tmatrixIO.hxx\"\n"
        << "#include\"TFEL/Math/st2tost2.hxx\"\n"
        << "#include\"TFEL/Math/ST2toST2/ST2toST2ConceptIO.hxx\"\n";
+    if (this->bd.getAttribute(
+            ModellingHypothesis::UNDEFINEDHYPOTHESIS,
+            BehaviourData::automaticDifferentiationOfTheJacobian, false)) {
+      os << "#include<memory>\n"
+         << "#include\"TFEL/Math/General/DualNumber.hxx\"\n";
+    }
     for (const auto& h : this->solver.getSpecificHeaders()) {
       os << "#include\"" << h << "\"\n";
     }
@@ -990,14 +1058,26 @@ namespace mfront {
       std::ostream& os, const Hypothesis h) const {
     const auto& d = this->bd.getBehaviourData(h);
     const auto n = d.getIntegrationVariables().getTypeSize();
+    const auto ad = this->bd.getAttribute(
+        h, BehaviourData::automaticDifferentiationOfTheJacobian, false);
     this->checkBehaviourFile(os);
     os << "TFEL_HOST_DEVICE void computeNumericalJacobian("
        << "tfel::math::tmatrix<" << n << "," << n
        << ", NumericType>& njacobian)\n"
        << "{\n"
        << "using namespace std;\n"
-       << "using namespace tfel::math;\n"
-       << "tvector<" << n << ", NumericType> tzeros(this->zeros);\n"
+       << "using namespace tfel::math;\n";
+    if (ad) {
+      // finite differences are only used by the behaviour based on dual
+      // numbers, which is not meant to compute its own jacobian (or if
+      // quantities are used)
+      os << "if constexpr ((tfel::math::isDualNumber<NumericType>())";
+      if (this->bd.useQt()) {
+        os << " || (use_qt)";
+      }
+      os << "){\n";
+    }
+    os << "tvector<" << n << ", NumericType> tzeros(this->zeros);\n"
        << "tvector<" << n << ", NumericType> tfzeros(this->fzeros);\n"
        << "tmatrix<" << n << "," << n
        << ", NumericType> tjacobian(this->jacobian);\n"
@@ -1027,8 +1107,39 @@ namespace mfront {
        << "}\n"
        << "if(&njacobian!=&(this->jacobian)){\n"
        << "this->jacobian = tjacobian;\n"
-       << "}\n"
-       << "}\n\n";
+       << "}\n";
+    if (ad) {
+      // the residual is evaluated once by a copy of the behaviour where the
+      // unknowns are replaced by dual numbers, each unknown being associated
+      // with one derivative lane. The copy is allocated on the heap since
+      // its jacobian holds n * n * (n + 1) values.
+      os << "} else {\n"
+         << "using ADNumericType = tfel::math::DualNumber<" << n
+         << ", NumericType>;\n"
+         << "auto mfront_ad_behaviour = std::make_unique<"
+         << this->bd.getClassName()
+         << "<hypothesis, ADNumericType, false>>(*this);\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "mfront_ad_behaviour->zeros(mfront_idx) = "
+         << "ADNumericType::variable(this->zeros(mfront_idx), mfront_idx);\n"
+         << "}\n";
+      if (this->bd.hasCode(h, BehaviourData::ComputeThermodynamicForces)) {
+        os << "mfront_ad_behaviour->computeThermodynamicForces();\n";
+      }
+      os << "mfront_ad_behaviour->computeFdF(true);\n"
+         << "for(ushort mfront_idx = 0; mfront_idx != " << n
+         << "; ++mfront_idx){\n"
+         << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << n
+         << "; ++mfront_idx2){\n"
+         << "njacobian(mfront_idx, mfront_idx2) = "
+         << "mfront_ad_behaviour->fzeros(mfront_idx)."
+         << "getDerivative(mfront_idx2);\n"
+         << "}\n"
+         << "}\n"
+         << "}\n";
+    }
+    os << "}\n\n";
   }  // end of writeComputeNumericalJacobian
 
   void ImplicitCodeGeneratorBase::writeBehaviourIntegrator(
@@ -1083,7 +1194,28 @@ namespace mfront {
                                              BehaviourData::Integrator);
     }
     this->solver.initializeNumericalParameters(os, this->bd, h);
-    os << "if(!this->solveNonLinearSystem()){\n";
+    if (this->bd.getAttribute(BehaviourData::profiling, false)) {
+      // the number of iterations is recorded for successful and failed
+      // integrations
+      os << "const auto mfront_solver_status = this->solveNonLinearSystem();\n";
+      if (this->bd.getAttribute(h, BehaviourData::warmStart, false)) {
+        // the time increment of the previous time step is only updated
+        // after the integration
+        os << "if (this->mfront_warm_start_dt > time(0)) {\n"
+           << this->bd.getClassName() << "Profiler::getProfiler()"
+           << ".addNumberOfWarmStartedIterations(this->iter);\n"
+           << "} else {\n"
+           << this->bd.getClassName() << "Profiler::getProfiler()"
+           << ".addNumberOfIterations(this->iter);\n"
+           << "}\n";
+      } else {
+        os << this->bd.getClassName() << "Profiler::getProfiler()"
+           << ".addNumberOfIterations(this->iter);\n";
+      }
+      os << "if(!mfront_solver_status){\n";
+    } else {
+      os << "if(!this->solveNonLinearSystem()){\n";
+    }
     if (this->bd.useQt()) {
       os << "return MechanicalBehaviour<" << btype
          << ",hypothesis, NumericType, use_qt>::FAILURE;\n";
@@ -1336,6 +1468,20 @@ namespace mfront {
          << "<< this->iter << \" : \" << error << '\\n';\n"
          << "}\n";
     }
+    this->writeSolveLinearSystem(os, h);
+    this->writeComputeFdF(os, h);
+  }  // end of writeBehaviourIntegrator
+
+  void ImplicitCodeGeneratorBase::writeSolveLinearSystem(
+      std::ostream& os, const Hypothesis h) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto& ivs = d.getIntegrationVariables();
+    const auto n = mfront::getTypeSize(ivs);
+    const auto c = this->bd.getAttribute<std::string>(
+        h, BehaviourData::jacobianBlockEliminationVariable, "");
+    if (!c.empty()) {
+      this->writeSolveLinearSystemByBlockElimination(os, h);
+    }
     os << "/*!\n"
        << " * \\brief solve linear system\n"
        << " * \\return true on success\n"
@@ -1343,25 +1489,193 @@ namespace mfront {
        << " * \\param[in,out] v: right hand side on input, solution on output\n"
        << " */\n"
        << "TFEL_HOST_DEVICE bool solveLinearSystem("
-       << "tfel::math::tmatrix<" << n2 << ", " << n2
+       << "tfel::math::tmatrix<" << n << ", " << n
        << ", NumericType>& mfront_matrix,"
-       << "tfel::math::tvector<" << n2 << ", NumericType>& mfront_vector)"
+       << "tfel::math::tvector<" << n << ", NumericType>& mfront_vector)"
        << "const noexcept{\n"
        << "auto mfront_success = true;\n";
     if (this->bd.getAttribute(BehaviourData::profiling, false)) {
-      writeStandardPerformanceProfilingBegin(os, this->bd.getClassName(),
-                                             "TinyMatrixSolve", "lu");
+      writeStandardPerformanceProfilingBegin(
+          os, this->bd.getClassName(), "TinyMatrixSolve",
+          c.empty() ? "lu" : "block_elimination");
+    }
+    if (!c.empty()) {
+      os << "mfront_success = this->solveLinearSystemByBlockElimination("
+         << "mfront_matrix, mfront_vector);\n"
+         << "if(!mfront_success){\n";
     }
     os << "mfront_success = "
        << this->solver.getExternalAlgorithmClassName(this->bd, h)
        << "::solveLinearSystem(mfront_matrix, mfront_vector);\n";
+    if (!c.empty()) {
+      os << "}\n";
+    }
     if (this->bd.getAttribute(BehaviourData::profiling, false)) {
       writeStandardPerformanceProfilingEnd(os);
     }
     os << "return mfront_success;\n"
        << "}\n";
-    this->writeComputeFdF(os, h);
-  }  // end of writeBehaviourIntegrator
+  }  // end of writeSolveLinearSystem
+
+  void ImplicitCodeGeneratorBase::writeSolveLinearSystemByBlockElimination(
+      std::ostream& os, const Hypothesis h) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto& ivs = d.getIntegrationVariables();
+    const auto n = mfront::getTypeSize(ivs);
+    const auto& c = ivs.getVariable(this->bd.getAttribute<std::string>(
+        h, BehaviourData::jacobianBlockEliminationVariable));
+    const auto nc = SupportedTypes::getTypeSize(c.type, c.arraySize);
+    const auto& wblocks = this->bd.getAttribute<std::vector<std::string>>(
+        h, BehaviourData::writtenJacobianBlocks);
+    auto is_written = [&wblocks](const VariableDescription& v1,
+                                 const VariableDescription& v2) {
+      const auto b = "df" + v1.name + "_dd" + v2.name;
+      return std::find(wblocks.begin(), wblocks.end(), b) != wblocks.end();
+    };
+    os << "/*!\n"
+       << " * \\brief solve the linear system by block elimination.\n"
+       << " *\n"
+       << " * The jacobian restricted to the integration variables other than\n"
+       << " * `" << c.name << "` is block-diagonal. Those variables are\n"
+       << " * eliminated and the Schur complement associated with\n"
+       << " * `" << c.name << "` is solved.\n"
+       << " *\n"
+       << " * \\return true on success. On failure, the right hand side is\n"
+       << " * left unchanged.\n"
+       << " * \\param[in] mfront_matrix: matrix\n"
+       << " * \\param[in,out] mfront_vector: right hand side on input,\n"
+       << " * solution on output\n"
+       << " */\n"
+       << "TFEL_HOST_DEVICE bool solveLinearSystemByBlockElimination("
+       << "const tfel::math::tmatrix<" << n << ", " << n
+       << ", NumericType>& mfront_matrix,"
+       << "tfel::math::tvector<" << n << ", NumericType>& mfront_vector)"
+       << "const noexcept{\n";
+    writeVariablesOffsets(os, ivs);
+    os << "auto mfront_schur = tfel::math::tmatrix<" << nc << ", " << nc
+       << ", NumericType>{};\n"
+       << "auto mfront_schur_rhs = tfel::math::tvector<" << nc
+       << ", NumericType>{};\n"
+       << "for(ushort mfront_idx = 0; mfront_idx != " << nc
+       << "; ++mfront_idx){\n"
+       << "mfront_schur_rhs(mfront_idx) = mfront_vector(" << c.name
+       << "_offset + mfront_idx);\n"
+       << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << nc
+       << "; ++mfront_idx2){\n"
+       << "mfront_schur(mfront_idx, mfront_idx2) = mfront_matrix(" << c.name
+       << "_offset + mfront_idx, " << c.name << "_offset + mfront_idx2);\n"
+       << "}\n"
+       << "}\n";
+    // elimination of the other variables. If the derivative of the residual
+    // associated with a variable v with respect to c is not null, the
+    // columns of this derivative are stored in front of the residual.
+    for (const auto& v : ivs) {
+      if (v.name == c.name) {
+        continue;
+      }
+      const auto nv = SupportedTypes::getTypeSize(v.type, v.arraySize);
+      const auto coupled = is_written(v, c);
+      const auto bname = "mfront_diagonal_block_" + v.name;
+      const auto xname = "mfront_eliminated_block_" + v.name;
+      os << "// elimination of variable " << v.name << "\n"
+         << "auto " << bname << " = tfel::math::tmatrix<" << nv << ", " << nv
+         << ", NumericType>{};\n";
+      if (coupled) {
+        os << "auto " << xname << " = tfel::math::tmatrix<" << nv << ", "
+           << nc << " + 1, NumericType>{};\n";
+      } else {
+        os << "auto " << xname << " = tfel::math::tvector<" << nv
+           << ", NumericType>{};\n";
+      }
+      os << "for(ushort mfront_idx = 0; mfront_idx != " << nv
+         << "; ++mfront_idx){\n"
+         << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << nv
+         << "; ++mfront_idx2){\n"
+         << bname << "(mfront_idx, mfront_idx2) = mfront_matrix(" << v.name
+         << "_offset + mfront_idx, " << v.name << "_offset + mfront_idx2);\n"
+         << "}\n";
+      if (coupled) {
+        os << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << nc
+           << "; ++mfront_idx2){\n"
+           << xname << "(mfront_idx, mfront_idx2) = mfront_matrix(" << v.name
+           << "_offset + mfront_idx, " << c.name
+           << "_offset + mfront_idx2);\n"
+           << "}\n"
+           << xname << "(mfront_idx, " << nc << ") = mfront_vector(" << v.name
+           << "_offset + mfront_idx);\n";
+      } else {
+        os << xname << "(mfront_idx) = mfront_vector(" << v.name
+           << "_offset + mfront_idx);\n";
+      }
+      os << "}\n"
+         << "if(!tfel::math::TinyMatrixSolve<" << nv
+         << ", NumericType, false>::exe(" << bname << ", " << xname
+         << ")){\n"
+         << "return false;\n"
+         << "}\n";
+      if (!is_written(c, v)) {
+        continue;
+      }
+      // update of the Schur complement
+      os << "for(ushort mfront_idx = 0; mfront_idx != " << nc
+         << "; ++mfront_idx){\n"
+         << "for(ushort mfront_idx3 = 0; mfront_idx3 != " << nv
+         << "; ++mfront_idx3){\n"
+         << "const auto mfront_coef = mfront_matrix(" << c.name
+         << "_offset + mfront_idx, " << v.name
+         << "_offset + mfront_idx3);\n";
+      if (coupled) {
+        os << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << nc
+           << "; ++mfront_idx2){\n"
+           << "mfront_schur(mfront_idx, mfront_idx2) -= mfront_coef * " << xname
+           << "(mfront_idx3, mfront_idx2);\n"
+           << "}\n"
+           << "mfront_schur_rhs(mfront_idx) -= mfront_coef * " << xname
+           << "(mfront_idx3, " << nc << ");\n";
+      } else {
+        os << "mfront_schur_rhs(mfront_idx) -= mfront_coef * " << xname
+           << "(mfront_idx3);\n";
+      }
+      os << "}\n"
+         << "}\n";
+    }
+    os << "if(!tfel::math::TinyMatrixSolve<" << nc
+       << ", NumericType, false>::exe(mfront_schur, mfront_schur_rhs)){\n"
+       << "return false;\n"
+       << "}\n"
+       << "// back-substitution\n"
+       << "for(ushort mfront_idx = 0; mfront_idx != " << nc
+       << "; ++mfront_idx){\n"
+       << "mfront_vector(" << c.name
+       << "_offset + mfront_idx) = mfront_schur_rhs(mfront_idx);\n"
+       << "}\n";
+    for (const auto& v : ivs) {
+      if (v.name == c.name) {
+        continue;
+      }
+      const auto nv = SupportedTypes::getTypeSize(v.type, v.arraySize);
+      const auto xname = "mfront_eliminated_block_" + v.name;
+      os << "for(ushort mfront_idx = 0; mfront_idx != " << nv
+         << "; ++mfront_idx){\n";
+      if (is_written(v, c)) {
+        os << "auto mfront_value = " << xname << "(mfront_idx, " << nc
+           << ");\n"
+           << "for(ushort mfront_idx2 = 0; mfront_idx2 != " << nc
+           << "; ++mfront_idx2){\n"
+           << "mfront_value -= " << xname
+           << "(mfront_idx, mfront_idx2) * mfront_schur_rhs(mfront_idx2);\n"
+           << "}\n"
+           << "mfront_vector(" << v.name
+           << "_offset + mfront_idx) = mfront_value;\n";
+      } else {
+        os << "mfront_vector(" << v.name << "_offset + mfront_idx) = " << xname
+           << "(mfront_idx);\n";
+      }
+      os << "}\n";
+    }
+    os << "return true;\n"
+       << "}\n";
+  }  // end of writeSolveLinearSystemByBlockElimination
 
   void ImplicitCodeGeneratorBase::writeComputeFdF(std::ostream& os,
                                                   const Hypothesis h) const {
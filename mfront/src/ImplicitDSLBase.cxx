@@ -119,6 +119,8 @@ namespace mfront {
     this->registerNewCallBack(
         "@CompareToNumericalJacobian",
         &ImplicitDSLBase::treatCompareToNumericalJacobian);
+    this->registerNewCallBack("@Jacobian", &ImplicitDSLBase::treatJacobian);
+    this->registerNewCallBack("@WarmStart", &ImplicitDSLBase::treatWarmStart);
     this->registerNewCallBack(
         "@JacobianComparisonCriterion",
         &ImplicitDSLBase::treatJacobianComparisonCriterion);
@@ -465,6 +467,28 @@ namespace mfront {
                              ";");
   }  // end of treatCompareToNumericalJacobian
 
+  void ImplicitDSLBase::treatJacobian() {
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    this->checkNotEndOfFile("ImplicitDSLBase::treatJacobian : ",
+                            "Expected 'AutomaticDifferentiation' or "
+                            "'FiniteDifferences'.");
+    if (this->current->value == "AutomaticDifferentiation") {
+      this->mb.setAttribute(
+          h, BehaviourData::automaticDifferentiationOfTheJacobian, true);
+    } else if (this->current->value == "FiniteDifferences") {
+      this->mb.setAttribute(
+          h, BehaviourData::automaticDifferentiationOfTheJacobian, false);
+    } else {
+      this->throwRuntimeError(
+          "ImplicitDSLBase::treatJacobian",
+          "Expected to read 'AutomaticDifferentiation' or "
+          "'FiniteDifferences' instead of '" +
+              this->current->value + ".");
+    }
+    ++(this->current);
+    this->readSpecifiedToken("ImplicitDSLBase::treatJacobian", ";");
+  }  // end of treatJacobian
+
   void ImplicitDSLBase::treatJacobianComparisonCriterion() {
     const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     if (!this->mb.getAttribute(h, BehaviourData::compareToNumericalJacobian,
@@ -490,6 +514,27 @@ namespace mfront {
                                       jacobianComparisonCriterion);
   }  // ImplicitDSLBase::treatJacobianComparisonCriterion
 
+  void ImplicitDSLBase::treatWarmStart() {
+    const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
+    this->checkNotEndOfFile("ImplicitDSLBase::treatWarmStart : ",
+                            "Expected 'true' or 'false'.");
+    if (this->mb.hasAttribute(h, BehaviourData::warmStart)) {
+      this->throwRuntimeError("ImplicitDSLBase::treatWarmStart",
+                              "warm start already specified");
+    }
+    if (this->current->value == "true") {
+      this->mb.setAttribute(h, BehaviourData::warmStart, true);
+    } else if (this->current->value == "false") {
+      this->mb.setAttribute(h, BehaviourData::warmStart, false);
+    } else {
+      this->throwRuntimeError("ImplicitDSLBase::treatWarmStart",
+                              "Expected to read 'true' or 'false' instead of '" +
+                                  this->current->value + ".");
+    }
+    ++(this->current);
+    this->readSpecifiedToken("ImplicitDSLBase::treatWarmStart", ";");
+  }  // end of treatWarmStart
+
   void ImplicitDSLBase::setNonLinearSolver(
       std::shared_ptr<NonLinearSystemSolver> s, const std::string& name) {
     this->solver = s;
@@ -1350,6 +1395,30 @@ namespace mfront {
                "@CompareToNumericalJacobian can only be used with solver using "
                "an analytical jacobian (or an approximation of it");
     }
+    if (this->mb.getAttribute(
+            uh, BehaviourData::automaticDifferentiationOfTheJacobian, false)) {
+      throw_if(!this->solver->usesJacobian(),
+               "the automatic differentiation of the jacobian can only be used "
+               "with solvers using the jacobian");
+    }
+    // warm start of the implicit scheme. Things are a bit tricky here
+    // because of the undefined hypothesis case which forwards everything to
+    // specialised hypotheses.
+    if (this->mb.getAttribute(uh, BehaviourData::warmStart, false)) {
+      for (const auto& h : mh) {
+        auto vars = VariableDescriptionContainer{};
+        for (const auto& v :
+             this->mb.getBehaviourData(h).getIntegrationVariables()) {
+          if ((h != uh) && (mh.find(uh) != mh.end()) &&
+              (this->mb.getBehaviourData(uh).getIntegrationVariables().contains(
+                  v.name))) {
+            continue;
+          }
+          vars.push_back(v);
+        }
+        this->addWarmStart(h, vars, (h == uh) || (mh.find(uh) == mh.end()));
+      }
+    }
     // create the compute final stress code is necessary
     this->setComputeFinalThermodynamicForcesFromComputeFinalThermodynamicForcesCandidateIfNecessary();
     // correct prediction to take into account normalisation factors
@@ -1435,8 +1504,161 @@ namespace mfront {
     }
     // minimal tangent operator
     this->setMinimalTangentOperator();
+    // structure of the jacobian
+    for (const auto& h : mh) {
+      this->analyseJacobianStructure(h);
+    }
   }  // end of endsInputFileProcessing()
 
+  void ImplicitDSLBase::addWarmStart(const Hypothesis h,
+                                     const VariableDescriptionContainer& vars,
+                                     const bool b) {
+    if (b) {
+      auto dt = VariableDescription("time", "mfront_warm_start_dt", 1u, 0u);
+      dt.description = "time increment of the previous time step";
+      this->mb.addAuxiliaryStateVariable(h, dt,
+                                         BehaviourData::FORCEREGISTRATION);
+    }
+    CodeBlock predictor;
+    CodeBlock save;
+    predictor.code =
+        "if (this->mfront_warm_start_dt > time(0)) {\n"
+        "const auto mfront_warm_start_factor = "
+        "(this->dt) / (this->mfront_warm_start_dt);\n";
+    for (const auto& v : vars) {
+      const auto n = "mfront_warm_start_d" + v.name;
+      auto ws = VariableDescription(v.type, n, v.arraySize, 0u);
+      ws.description = "increment of the integration variable '" + v.name +
+                       "' converged at the previous time step";
+      this->mb.addAuxiliaryStateVariable(h, ws,
+                                         BehaviourData::FORCEREGISTRATION);
+      if (v.arraySize == 1u) {
+        predictor.code += "this->d" + v.name +
+                          " = mfront_warm_start_factor * this->" + n + ";\n";
+        save.code += "this->" + n + " = this->d" + v.name + ";\n";
+      } else {
+        const auto s = std::to_string(v.arraySize);
+        predictor.code +=
+            "for (unsigned short mfront_idx = 0; mfront_idx != " + s +
+            "; ++mfront_idx) {\n"
+            "this->d" + v.name + "[mfront_idx] = mfront_warm_start_factor * "
+            "this->" + n + "[mfront_idx];\n"
+            "}\n";
+        save.code += "for (unsigned short mfront_idx = 0; mfront_idx != " +
+                     s + "; ++mfront_idx) {\n" + "this->" + n +
+                     "[mfront_idx] = this->d" + v.name + "[mfront_idx];\n" +
+                     "}\n";
+      }
+      // the increments are divided by the normalisation factors, if any
+      this->integrationVariablesIncrementsUsedInPredictor.insert('d' + v.name);
+    }
+    predictor.code += "}\n";
+    if (b) {
+      save.code += "this->mfront_warm_start_dt = this->dt;\n";
+    }
+    if (!vars.empty()) {
+      this->mb.setCode(h, BehaviourData::ComputePredictor, predictor,
+                       BehaviourData::CREATEORAPPEND,
+                       BehaviourData::AT_BEGINNING);
+    }
+    if (!save.code.empty()) {
+      this->mb.setCode(h, BehaviourData::UpdateAuxiliaryStateVariables, save,
+                       BehaviourData::CREATEORAPPEND,
+                       BehaviourData::AT_BEGINNING);
+    }
+  }  // end of addWarmStart
+
+  void ImplicitDSLBase::analyseJacobianStructure(const Hypothesis h) {
+    if (!this->solver->usesJacobian()) {
+      return;
+    }
+    auto set_attribute = [this, h](const std::string& n, const auto& v) {
+      if (this->mb.hasAttribute(h, n)) {
+        this->mb.updateAttribute(h, n, v);
+      } else {
+        this->mb.setAttribute(h, n, v, true);
+      }
+    };
+    if (this->solver->requiresNumericalJacobian()) {
+      // nothing is known about the structure of the jacobian
+      set_attribute(BehaviourData::jacobianBlockEliminationVariable,
+                    std::string{});
+      return;
+    }
+    const auto& ivs = this->mb.getBehaviourData(h).getIntegrationVariables();
+    // identifiers used in the code blocks evaluated at each iteration
+    auto identifiers = std::set<std::string>{};
+    for (const auto& n :
+         {BehaviourData::Integrator, BehaviourData::AdditionalConvergenceChecks,
+          BehaviourData::ProcessNewCorrection,
+          BehaviourData::ProcessNewEstimate}) {
+      if (!this->mb.hasCode(h, n)) {
+        continue;
+      }
+      CxxTokenizer t;
+      t.parseString(this->mb.getCodeBlock(h, n).code);
+      for (const auto& token : t) {
+        identifiers.insert(token.value);
+      }
+    }
+    // if the jacobian is used directly, all the blocks may be written
+    const auto uses_jacobian = identifiers.count("jacobian") != 0;
+    const auto ncb =
+        this->mb.getAttribute<std::vector<std::string>>(
+            h, BehaviourData::numericallyComputedJacobianBlocks, {});
+    auto is_written = [&identifiers, &ncb, uses_jacobian](
+                          const VariableDescription& v1,
+                          const VariableDescription& v2) {
+      const auto b = "df" + v1.name + "_dd" + v2.name;
+      return (uses_jacobian) || (v1.name == v2.name) ||
+             (identifiers.count(b) != 0) ||
+             (std::find(ncb.begin(), ncb.end(), b) != ncb.end());
+    };
+    auto blocks = std::vector<std::string>{};
+    for (const auto& v1 : ivs) {
+      for (const auto& v2 : ivs) {
+        if (is_written(v1, v2)) {
+          blocks.push_back("df" + v1.name + "_dd" + v2.name);
+        }
+      }
+    }
+    set_attribute(BehaviourData::writtenJacobianBlocks, blocks);
+    // selection of the variable on which the Schur complement is built. An
+    // empty string means that the linear systems are solved by a dense LU
+    // decomposition.
+    auto select_block_elimination_variable = [this, &ivs, &is_written,
+                                              uses_jacobian]() -> std::string {
+      // block elimination requires that the blocks which are not written
+      // are null, i.e. that the jacobian is reinitialised at each iteration
+      const auto& s = *(this->solver);
+      if ((uses_jacobian) || (ivs.size() < 2) ||
+          (!s.solvesLinearSystemsBasedOnTheJacobian()) ||
+          (!s.requiresJacobianToBeReinitialisedToIdentityAtEachIterations())) {
+        return "";
+      }
+      // the first integration variable (in declaration order) such that the
+      // jacobian restricted to the other integration variables is
+      // block-diagonal is selected
+      for (const auto& c : ivs) {
+        auto b = true;
+        for (const auto& v1 : ivs) {
+          for (const auto& v2 : ivs) {
+            if ((v1.name != c.name) && (v2.name != c.name) &&
+                (v1.name != v2.name) && (is_written(v1, v2))) {
+              b = false;
+            }
+          }
+        }
+        if (b) {
+          return c.name;
+        }
+      }
+      return "";
+    };
+    set_attribute(BehaviourData::jacobianBlockEliminationVariable,
+                  select_block_elimination_variable());
+  }  // end of analyseJacobianStructure
+
   void ImplicitDSLBase::getSymbols(std::map<std::string, std::string>& symbols,
                                    const Hypothesis h,
                                    const std::string& n) {
@@ -11,11 +11,70 @@
  * project under specific licensing conditions.
  */
 
+#include <set>
 #include <ostream>
+#include "MFront/DSLUtilities.hxx"
+#include "MFront/MaterialKnowledgeDescription.hxx"
 #include "MFront/IsotropicBehaviourCodeGeneratorBase.hxx"
 
 namespace mfront {
 
+  /*!
+   * \return the type of a variable used in the vectorized version of the
+   * Newton algorithm or an empty optional if the variable is not supported.
+   * \param[in] d: behaviour data
+   * \param[in] n: variable name
+   */
+  static std::optional<std::string> getVectorizedVariableType(
+      const BehaviourData& d, const std::string& n) {
+    if (n == "dt") {
+      return "time";
+    }
+    const auto vn = [&d, &n]() -> std::string {
+      if ((d.isStateVariableIncrementName(n)) ||
+          (d.isExternalStateVariableIncrementName(n))) {
+        return n.substr(1);
+      }
+      return n;
+    }();
+    if (!((d.isMaterialPropertyName(vn)) || (d.isStateVariableName(vn)) ||
+          (d.isExternalStateVariableName(vn)) || (d.isLocalVariableName(vn)) ||
+          (d.isParameterName(vn)))) {
+      return {};
+    }
+    const auto& v = d.getVariableDescription(vn);
+    if ((v.arraySize != 1u) || (!v.isScalar())) {
+      return {};
+    }
+    return v.type;
+  }  // end of getVectorizedVariableType
+
+  std::optional<std::map<std::string, std::string>>
+  getVectorizedFlowRuleVariables(
+      const BehaviourDescription& bd,
+      const tfel::material::ModellingHypothesis::Hypothesis h) {
+    const auto& d = bd.getBehaviourData(h);
+    if (!d.hasCode(BehaviourData::VectorizedFlowRule)) {
+      return {};
+    }
+    auto variables = std::map<std::string, std::string>{};
+    const auto& c = d.getCodeBlock(BehaviourData::VectorizedFlowRule);
+    for (const auto& v : c.members) {
+      // state variables and external state variables are evaluated at
+      // t+theta*dt, as in the scalar version of the flow rule
+      const auto n =
+          ((d.isStateVariableName(v)) || (d.isExternalStateVariableName(v)))
+              ? v + "_"
+              : v;
+      const auto t = getVectorizedVariableType(d, n);
+      if (!t.has_value()) {
+        return {};
+      }
+      variables.insert({n, *t});
+    }
+    return variables;
+  }  // end of getVectorizedFlowRuleVariables
+
   IsotropicBehaviourCodeGeneratorBase::IsotropicBehaviourCodeGeneratorBase(
       const FileDescription& f,
       const BehaviourDescription& d,
@@ -175,6 +234,181 @@ namespace mfront {
       std::ostream&, const Hypothesis) const {
   }  // end of writeBehaviourComputeTangentOperator
 
+  void IsotropicBehaviourCodeGeneratorBase::writeBehaviourIntegrator(
+      std::ostream& os, const Hypothesis h) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    const auto mb = "MechanicalBehaviour<" + this->bd.getBehaviourTypeFlag() +
+                    ",hypothesis, NumericType," +
+                    (this->bd.useQt() ? "use_qt" : "false") + ">";
+    auto write_tangent_operator_flag_check = [&os, &mb] {
+      os << "if(smflag!=" << mb << "::STANDARDTANGENTOPERATOR){\n"
+         << "throw(runtime_error(\"invalid tangent operator flag\"));\n"
+         << "}\n";
+    };
+    // everything done after the Newton algorithm
+    auto write_integration_end = [this, &os, &d, &mb] {
+      os << "if(smt!=NOSTIFFNESSREQUESTED){\n"
+         << "if(!this->computeConsistentTangentOperator(smt)){\n"
+         << "return " << mb << "::FAILURE;\n"
+         << "}\n"
+         << "}\n"
+         << "this->deel = this->deto-(this->dp)*(this->n);\n"
+         << "this->updateStateVariables();\n"
+         << "this->sig  = "
+            "(this->lambda_tdt)*trace(this->eel)*StrainStensor::Id()+2*(this->"
+            "mu_tdt)*(this->eel);\n"
+         << "this->updateAuxiliaryStateVariables();\n";
+      if (!areRuntimeChecksDisabled(this->bd)) {
+        for (const auto& v : d.getPersistentVariables()) {
+          this->writePhysicalBoundsChecks(os, v, false);
+        }
+        for (const auto& v : d.getPersistentVariables()) {
+          this->writeBoundsChecks(os, v, false);
+        }
+      }
+      os << "return " << mb << "::SUCCESS;\n";
+    };
+    this->checkBehaviourFile(os);
+    os << "/*!\n"
+       << "* \\brief Integrate behaviour law over the time step\n"
+       << "*/\n"
+       << "[[nodiscard]] IntegrationResult\n"
+       << "integrate(const SMFlag smflag,const SMType smt) override{\n"
+       << "using namespace std;\n";
+    write_tangent_operator_flag_check();
+    os << "if(!this->NewtonIntegration()){\n"
+       << "return " << mb << "::FAILURE;\n"
+       << "}\n";
+    write_integration_end();
+    os << "}\n\n";
+    if (this->isBatchNewtonIntegrationVectorized()) {
+      this->writeBatchNewtonIntegration(os, h);
+      os << "/*!\n"
+         << "* \\brief complete the integration of the behaviour over the "
+         << "time step\n"
+         << "* after a successful call to the `batchNewtonIntegration` "
+         << "method\n"
+         << "*/\n"
+         << "[[nodiscard]] IntegrationResult\n"
+         << "completeBatchIntegration(const SMFlag smflag,const SMType smt){\n"
+         << "using namespace std;\n";
+      write_tangent_operator_flag_check();
+      write_integration_end();
+      os << "}\n\n";
+    }
+  }  // end of writeBehaviourIntegrator
+
+  bool IsotropicBehaviourCodeGeneratorBase::isBatchNewtonIntegrationVectorized()
+      const {
+    return this->bd.getAttribute(
+        BehaviourDescription::vectorizedBatchIntegration, false);
+  }  // end of isBatchNewtonIntegrationVectorized
+
+  void IsotropicBehaviourCodeGeneratorBase::writeBatchNewtonIntegration(
+      std::ostream&, const Hypothesis) const {
+    this->throwRuntimeError(
+        "IsotropicBehaviourCodeGeneratorBase::writeBatchNewtonIntegration",
+        "the vectorized integration of a batch of integration points is not "
+        "supported");
+  }  // end of writeBatchNewtonIntegration
+
+  void IsotropicBehaviourCodeGeneratorBase::writeBatchNewtonIntegrationBegin(
+      std::ostream& os,
+      const Hypothesis h,
+      const std::vector<std::string>& newton_variables) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    auto ovariables = getVectorizedFlowRuleVariables(this->bd, h);
+    if (!ovariables.has_value()) {
+      this->throwRuntimeError(
+          "IsotropicBehaviourCodeGeneratorBase::"
+          "writeBatchNewtonIntegrationBegin",
+          "the flow rule can't be evaluated on a batch of integration points");
+    }
+    auto& variables = *ovariables;
+    for (const auto& v : newton_variables) {
+      const auto t = getVectorizedVariableType(d, v);
+      if (!t.has_value()) {
+        this->throwRuntimeError(
+            "IsotropicBehaviourCodeGeneratorBase::"
+            "writeBatchNewtonIntegrationBegin",
+            "unsupported variable '" + v + "'");
+      }
+      variables.insert({v, *t});
+    }
+    os << "/*!\n"
+       << "* \\brief vectorized version of the `NewtonIntegration` method "
+       << "which\n"
+       << "* integrates a batch of integration points simultaneously. The\n"
+       << "* integration points that have converged are masked.\n"
+       << "* \\param[in,out] mfront_batch: behaviours to be integrated\n"
+       << "* \\param[out] mfront_batch_status: convergence status of each "
+       << "behaviour\n"
+       << "*/\n"
+       << "template <std::size_t mfront_batch_size>\n"
+       << "static void batchNewtonIntegration(" << this->bd.getClassName()
+       << "* const* const mfront_batch,\n"
+       << "bool* const mfront_batch_status){\n"
+       << "using namespace std;\n"
+       << "using namespace tfel::math;\n"
+       << "using namespace tfel::material;\n"
+       << "using std::vector;\n";
+    writeMaterialLaws(os, this->bd.getMaterialLaws());
+    for (const auto& [n, t] : variables) {
+      os << t << " mfront_batch_" << n << "[mfront_batch_size];\n";
+    }
+    os << "bool mfront_batch_compute_flow_r[mfront_batch_size];\n"
+       << "bool mfront_batch_converged[mfront_batch_size];\n"
+       << "for(std::size_t mfront_batch_l = 0; "
+       << "mfront_batch_l != mfront_batch_size; ++mfront_batch_l){\n";
+    for (const auto& v : variables) {
+      os << "mfront_batch_" << v.first << "[mfront_batch_l] = "
+         << "mfront_batch[mfront_batch_l]->" << v.first << ";\n";
+    }
+    os << "mfront_batch_converged[mfront_batch_l] = false;\n"
+       << "}\n";
+  }  // end of writeBatchNewtonIntegrationBegin
+
+  void IsotropicBehaviourCodeGeneratorBase::writeBatchFlowRuleEvaluation(
+      std::ostream& os, const Hypothesis h) const {
+    os << "for(std::size_t mfront_batch_l = 0; "
+       << "mfront_batch_l != mfront_batch_size; ++mfront_batch_l){\n"
+       << "if(mfront_batch_converged[mfront_batch_l]){\n"
+       << "continue;\n"
+       << "}\n"
+       << "mfront_batch_compute_flow_r[mfront_batch_l] = [&]() -> bool {\n"
+       << this->bd.getCode(h, BehaviourData::VectorizedFlowRule)
+       << "return true;\n"
+       << "}();\n"
+       << "}\n";
+  }  // end of writeBatchFlowRuleEvaluation
+
+  void IsotropicBehaviourCodeGeneratorBase::writeBatchNewtonIntegrationEnd(
+      std::ostream& os,
+      const Hypothesis h,
+      const std::vector<std::string>& newton_variables) const {
+    const auto& d = this->bd.getBehaviourData(h);
+    auto variables = std::set<std::string>(newton_variables.begin(),
+                                           newton_variables.end());
+    const auto ovariables = getVectorizedFlowRuleVariables(this->bd, h);
+    if (ovariables.has_value()) {
+      for (const auto& v : *ovariables) {
+        if (d.isLocalVariableName(v.first)) {
+          variables.insert(v.first);
+        }
+      }
+    }
+    os << "for(std::size_t mfront_batch_l = 0; "
+       << "mfront_batch_l != mfront_batch_size; ++mfront_batch_l){\n";
+    for (const auto& v : variables) {
+      os << "mfront_batch[mfront_batch_l]->" << v << " = mfront_batch_" << v
+         << "[mfront_batch_l];\n";
+    }
+    os << "mfront_batch_status[mfront_batch_l] = "
+       << "mfront_batch_converged[mfront_batch_l];\n"
+       << "}\n"
+       << "}\n\n";
+  }  // end of writeBatchNewtonIntegrationEnd
+
   IsotropicBehaviourCodeGeneratorBase::~IsotropicBehaviourCodeGeneratorBase() =
       default;
 
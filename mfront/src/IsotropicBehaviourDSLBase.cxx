@@ -19,14 +19,24 @@
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MFront/DSLUtilities.hxx"
+#include "MFront/IsotropicBehaviourCodeGeneratorBase.hxx"
 #include "MFront/IsotropicBehaviourDSLBase.hxx"
 
 namespace mfront {
 
+  tfel::utilities::DataMapValidator
+  IsotropicBehaviourDSLBase::getDSLOptionsValidator() {
+    return BehaviourDSLCommon::getDSLOptionsValidator()
+        .addDataTypeValidator<bool>(
+            BehaviourDescription::vectorizedBatchIntegration);
+  }  // end of getDSLOptionsValidator
+
   IsotropicBehaviourDSLBase::IsotropicBehaviourDSLBase(const DSLOptions& opts)
       : BehaviourDSLBase<IsotropicBehaviourDSLBase>(opts) {
     const auto h = ModellingHypothesis::UNDEFINEDHYPOTHESIS;
     this->reserveName("NewtonIntegration");
+    this->reserveName("batchNewtonIntegration");
+    this->reserveName("completeBatchIntegration");
     // main variables
     this->mb.declareAsASmallStrainStandardBehaviour();
     // material symmetry
@@ -45,6 +55,12 @@ namespace mfront {
       const auto T_ = VariableDescription("temperature", "T_", 1u, 0u);
       this->mb.addLocalVariable(h, T_);
     }
+    // vectorized integration over a batch of integration points
+    if (tfel::utilities::get_if<bool>(
+            opts, BehaviourDescription::vectorizedBatchIntegration, false)) {
+      this->mb.setAttribute(BehaviourDescription::vectorizedBatchIntegration,
+                            true, false);
+    }
     // Call Back
     this->registerNewCallBack(
         "@UsableInPurelyImplicitResolution",
@@ -104,6 +120,25 @@ namespace mfront {
     return d;
   }  // end of IsotropicBehaviourDSLBase::getBehaviourDSLDescription
 
+  std::vector<AbstractDSL::DSLOptionDescription>
+  IsotropicBehaviourDSLBase::getDSLOptions() const {
+    auto opts = BehaviourDSLCommon::getDSLOptions();
+    opts.push_back({BehaviourDescription::vectorizedBatchIntegration,
+                    "boolean stating if the Newton algorithm shall be "
+                    "vectorized when integrating the behaviour on a batch of "
+                    "integration points"});
+    return opts;
+  }  // end of getDSLOptions
+
+  AbstractDSL::DSLOptions IsotropicBehaviourDSLBase::buildDSLOptions() const {
+    auto opts = BehaviourDSLCommon::buildDSLOptions();
+    if (this->mb.getAttribute(BehaviourDescription::vectorizedBatchIntegration,
+                              false)) {
+      opts.insert({BehaviourDescription::vectorizedBatchIntegration, true});
+    }
+    return opts;
+  }  // end of buildDSLOptions
+
   void IsotropicBehaviourDSLBase::getSymbols(
       std::map<std::string, std::string>& symbols,
       const Hypothesis h,
@@ -201,9 +236,50 @@ namespace mfront {
         m = [this](const Hypothesis h, const std::string& sv, const bool b) {
           return this->flowRuleVariableModifier(h, sv, b);
         };
+    if (this->mb.getAttribute(BehaviourDescription::vectorizedBatchIntegration,
+                              false)) {
+      std::function<std::string(const Hypothesis, const std::string&,
+                                const bool)>
+          vm = [this](const Hypothesis h, const std::string& sv,
+                      const bool b) {
+            return this->vectorizedFlowRuleVariableModifier(h, sv, b);
+          };
+      this->treatCodeBlock(BehaviourData::FlowRule,
+                           BehaviourData::VectorizedFlowRule, m, vm, true,
+                           false);
+      return;
+    }
     this->treatCodeBlock(BehaviourData::FlowRule, m, true, false);
   }  // end of IsotropicBehaviourDSLBase::treatFlowRule
 
+  std::string IsotropicBehaviourDSLBase::vectorizedFlowRuleVariableModifier(
+      const Hypothesis h, const std::string& var, const bool) {
+    if ((this->mb.isExternalStateVariableName(h, var)) ||
+        (this->mb.isStateVariableName(h, var))) {
+      return "mfront_batch_" + var + "_[mfront_batch_l]";
+    }
+    return "mfront_batch_" + var + "[mfront_batch_l]";
+  }  // end of IsotropicBehaviourDSLBase::vectorizedFlowRuleVariableModifier
+
+  void IsotropicBehaviourDSLBase::checkVectorizedBatchIntegration() {
+    const auto* const o = BehaviourDescription::vectorizedBatchIntegration;
+    if (!this->mb.getAttribute(o, false)) {
+      return;
+    }
+    for (const auto& h : this->mb.getDistinctModellingHypotheses()) {
+      if (!getVectorizedFlowRuleVariables(this->mb, h).has_value()) {
+        if (getVerboseMode() >= VERBOSE_LEVEL1) {
+          getLogStream() << "IsotropicBehaviourDSLBase::"
+                         << "checkVectorizedBatchIntegration: the flow rule "
+                         << "can't be evaluated on a batch of integration "
+                         << "points, the vectorized integration is disabled\n";
+        }
+        this->mb.updateAttribute(o, false);
+        return;
+      }
+    }
+  }  // end of IsotropicBehaviourDSLBase::checkVectorizedBatchIntegration
+
   void IsotropicBehaviourDSLBase::treatExternalStateVariable() {
     VariableDescriptionContainer ev;
     std::set<Hypothesis> h;
@@ -319,6 +395,7 @@ namespace mfront {
                        initLocalVars, BehaviourData::CREATEORAPPEND,
                        BehaviourData::BODY);
     }
+    this->checkVectorizedBatchIntegration();
     if (getVerboseMode() >= VERBOSE_DEBUG) {
       auto& log = getLogStream();
       log << "IsotropicBehaviourDSLBase::endsInputFileProcessing: end\n";
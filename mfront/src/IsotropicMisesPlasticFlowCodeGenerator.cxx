@@ -148,71 +148,101 @@ namespace mfront {
        << "}\n\n";
   }  // end of writeBehaviourParserSpecificMembers
 
-  void IsotropicMisesPlasticFlowCodeGenerator::writeBehaviourIntegrator(
+  void IsotropicMisesPlasticFlowCodeGenerator::writeBatchNewtonIntegration(
       std::ostream& os, const Hypothesis h) const {
-    const auto btype = this->bd.getBehaviourTypeFlag();
-    const auto& d = this->bd.getBehaviourData(h);
     this->checkBehaviourFile(os);
-    os << "/*!\n"
-       << "* \\brief Integrate behaviour law over the time step\n"
-       << "*/\n"
-       << "[[nodiscard]] IntegrationResult\n"
-       << "integrate(const SMFlag smflag,const SMType smt) override{\n"
-       << "using namespace std;\n";
-    if (this->bd.useQt()) {
-      os << "if(smflag!=MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,use_qt>::STANDARDTANGENTOPERATOR){\n"
-         << "throw(runtime_error(\"invalid tangent operator flag\"));\n"
-         << "}\n";
-    } else {
-      os << "if(smflag!=MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,false>::STANDARDTANGENTOPERATOR){\n"
-         << "throw(runtime_error(\"invalid tangent operator flag\"));\n"
-         << "}\n";
-    }
-    os << "if(!this->NewtonIntegration()){\n";
-    if (this->bd.useQt()) {
-      os << "return MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,use_qt>::FAILURE;\n";
-    } else {
-      os << "return MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,false>::FAILURE;\n";
-    }
-    os << "}\n"
-       << "if(smt!=NOSTIFFNESSREQUESTED){\n"
-       << "if(!this->computeConsistentTangentOperator(smt)){\n";
-    if (this->bd.useQt()) {
-      os << "return MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,use_qt>::FAILURE;\n";
-    } else {
-      os << "return MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,false>::FAILURE;\n";
-    }
-    os << "}\n"
+    const auto variables =
+        std::vector<std::string>{"dp", "p_", "seq", "f", "df_dseq", "df_dp"};
+    this->writeBatchNewtonIntegrationBegin(
+        os, h, {"dp", "p", "p_", "seq", "seq_e", "f", "df_dseq", "df_dp", "mu",
+         "theta", "young"});
+    os << "constexpr auto newton_epsilon = "
+          "100*std::numeric_limits<strain>::epsilon();\n"
+       << "const auto mfront_batch_iterMax = mfront_batch[0]->iterMax;\n"
+       << "const auto mfront_batch_epsilon = mfront_batch[0]->epsilon;\n"
+       << "stress mfront_batch_3_mu_theta[mfront_batch_size];\n"
+       << "strain mfront_batch_newton_ddp[mfront_batch_size];\n"
+       << "for(std::size_t mfront_batch_l = 0; "
+       << "mfront_batch_l != mfront_batch_size; ++mfront_batch_l){\n"
+       << "mfront_batch_3_mu_theta[mfront_batch_l] = "
+       << "3*(mfront_batch_theta[mfront_batch_l])*"
+       << "(mfront_batch_mu[mfront_batch_l]);\n"
+       << "mfront_batch_newton_ddp[mfront_batch_l] = strain{};\n"
+       << "mfront_batch_p_[mfront_batch_l] = mfront_batch_p[mfront_batch_l] + "
+       << "mfront_batch_dp[mfront_batch_l];\n"
        << "}\n"
-       << "this->deel = this->deto-(this->dp)*(this->n);\n"
-       << "this->updateStateVariables();\n"
-       << "this->sig  = "
-          "(this->lambda_tdt)*trace(this->eel)*StrainStensor::Id()+2*(this->mu_"
-          "tdt)*(this->eel);\n"
-       << "this->updateAuxiliaryStateVariables();\n";
-    if (!areRuntimeChecksDisabled(this->bd)) {
-      for (const auto& v : d.getPersistentVariables()) {
-        this->writePhysicalBoundsChecks(os, v, false);
-      }
-      for (const auto& v : d.getPersistentVariables()) {
-        this->writeBoundsChecks(os, v, false);
-      }
-    }
-    if (this->bd.useQt()) {
-      os << "return MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,use_qt>::SUCCESS;\n";
-    } else {
-      os << "return MechanicalBehaviour<" << btype
-         << ",hypothesis, NumericType,false>::SUCCESS;\n";
-    }
-    os << "}\n\n";
-  }  // end of writeBehaviourIntegrator
+       << "for(unsigned short mfront_batch_iter = 0; "
+       << "mfront_batch_iter != mfront_batch_iterMax; ++mfront_batch_iter){\n"
+       << "auto mfront_batch_all_converged = true;\n"
+       << "for(std::size_t mfront_batch_l = 0; "
+       << "mfront_batch_l != mfront_batch_size; ++mfront_batch_l){\n"
+       << "mfront_batch_all_converged = mfront_batch_all_converged && "
+       << "mfront_batch_converged[mfront_batch_l];\n"
+       << "mfront_batch_seq[mfront_batch_l] = "
+       << "mfront_batch_converged[mfront_batch_l] ? "
+       << "mfront_batch_seq[mfront_batch_l] : "
+       << "std::max(mfront_batch_seq_e[mfront_batch_l]-"
+       << "mfront_batch_3_mu_theta[mfront_batch_l]*"
+       << "(mfront_batch_dp[mfront_batch_l]),stress(0));\n"
+       << "}\n"
+       << "if(mfront_batch_all_converged){\n"
+       << "break;\n"
+       << "}\n";
+    this->writeBatchFlowRuleEvaluation(os, h);
+    os << "for(std::size_t mfront_batch_l = 0; "
+       << "mfront_batch_l != mfront_batch_size; ++mfront_batch_l){\n"
+       << "const auto mfront_batch_active = "
+       << "!mfront_batch_converged[mfront_batch_l];\n"
+       << "const auto mfront_batch_valid = "
+       << "(mfront_batch_active) && "
+       << "(mfront_batch_compute_flow_r[mfront_batch_l]) &&\n"
+       << "(tfel::math::ieee754::isfinite(mfront_batch_f[mfront_batch_l])) &&\n"
+       << "(tfel::math::ieee754::isfinite("
+       << "mfront_batch_df_dp[mfront_batch_l])) &&\n"
+       << "(tfel::math::ieee754::isfinite("
+       << "mfront_batch_df_dseq[mfront_batch_l]));\n"
+       << "const real mfront_batch_surf = (mfront_batch_f[mfront_batch_l])/"
+       << "(mfront_batch_young[mfront_batch_l]);\n"
+       << "const auto mfront_batch_plastic = "
+       << "((mfront_batch_surf>newton_epsilon)&&"
+       << "((mfront_batch_dp[mfront_batch_l])>=strain(0)))||"
+       << "((mfront_batch_dp[mfront_batch_l])>newton_epsilon);\n"
+       << "const strain newton_f = (mfront_batch_plastic) ? "
+       << "strain(mfront_batch_surf) : mfront_batch_dp[mfront_batch_l];\n"
+       << "const strain newton_df = (mfront_batch_plastic) ? "
+       << "strain(((mfront_batch_theta[mfront_batch_l])*"
+       << "(mfront_batch_df_dp[mfront_batch_l])"
+       << "-mfront_batch_3_mu_theta[mfront_batch_l]*"
+       << "(mfront_batch_df_dseq[mfront_batch_l]))/"
+       << "(mfront_batch_young[mfront_batch_l])) : strain(real(1.));\n"
+       << "const auto mfront_batch_valid_jacobian = (mfront_batch_valid) && "
+       << "(tfel::math::abs(newton_df) > newton_epsilon);\n"
+       << "// probably an elastic prediction on the first iteration\n"
+       << "const auto mfront_batch_default_ddp = (mfront_batch_iter == 0) ? "
+       << "strain((mfront_batch_seq_e[mfront_batch_l] / "
+       << "mfront_batch_3_mu_theta[mfront_batch_l]) / 2) : "
+       << "mfront_batch_newton_ddp[mfront_batch_l];\n"
+       << "const auto newton_ddp = (mfront_batch_valid_jacobian) ? "
+       << "strain(-newton_f/(mfront_batch_valid_jacobian ? newton_df : "
+       << "strain(1))) : mfront_batch_default_ddp;\n"
+       << "mfront_batch_newton_ddp[mfront_batch_l] = (mfront_batch_active) ? "
+       << "newton_ddp : mfront_batch_newton_ddp[mfront_batch_l];\n"
+       << "mfront_batch_dp[mfront_batch_l] = (mfront_batch_active) ? "
+       << "strain(mfront_batch_dp[mfront_batch_l] + newton_ddp) : "
+       << "mfront_batch_dp[mfront_batch_l];\n"
+       << "mfront_batch_p_[mfront_batch_l] = (mfront_batch_active) ? "
+       << "strain(mfront_batch_p[mfront_batch_l] + "
+       << "(mfront_batch_theta[mfront_batch_l])*"
+       << "(mfront_batch_dp[mfront_batch_l])) : "
+       << "mfront_batch_p_[mfront_batch_l];\n"
+       << "mfront_batch_converged[mfront_batch_l] = (!mfront_batch_active) || "
+       << "((mfront_batch_valid_jacobian) && "
+       << "(tfel::math::abs(newton_f) < mfront_batch_epsilon) && "
+       << "(mfront_batch_iter + 1 != mfront_batch_iterMax));\n"
+       << "}\n"
+       << "}\n";
+    this->writeBatchNewtonIntegrationEnd(os, h, variables);
+  }  // end of writeBatchNewtonIntegration
 
   void
   IsotropicMisesPlasticFlowCodeGenerator::writeBehaviourComputeTangentOperator(
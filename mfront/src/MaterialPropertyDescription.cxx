@@ -68,6 +68,37 @@ namespace mfront {
     }
   }  // end of writeScalarStandardTypedefs
 
+  void writeMaterialPropertyArrayLoop(std::ostream& os,
+                                      const MaterialPropertyDescription& mpd,
+                                      const std::string_view args,
+                                      const std::string_view stride,
+                                      const std::string_view n,
+                                      const std::string_view out) {
+    const auto use_qt = useQuantities(mpd);
+    os << "for (decltype(" << n << " + 0) mfront_i = 0; mfront_i < " << n
+       << "; ++mfront_i) {\n"
+       << "const auto* const mfront_point = " << args << " + mfront_i * "
+       << stride << ";\n";
+    auto i = std::size_t{};
+    for (const auto& v : mpd.inputs) {
+      os << "const auto " << v.name << " = ";
+      if (use_qt) {
+        os << v.type << "(mfront_point[" << i << "]);\n";
+      } else {
+        os << "mfront_point[" << i << "];\n";
+      }
+      ++i;
+    }
+    os << "auto " << mpd.output.name << " = " << mpd.output.type << "{};\n"
+       << mpd.f.body << '\n';
+    if (use_qt) {
+      os << out << "[mfront_i] = " << mpd.output.name << ".getValue();\n";
+    } else {
+      os << out << "[mfront_i] = " << mpd.output.name << ";\n";
+    }
+    os << "}\n";
+  }  // end of writeMaterialPropertyArrayLoop
+
   MaterialPropertyDescription::MaterialPropertyDescription() = default;
   MaterialPropertyDescription::MaterialPropertyDescription(
       const MaterialPropertyDescription&) = default;
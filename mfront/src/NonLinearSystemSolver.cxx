@@ -15,6 +15,10 @@
 
 namespace mfront {
 
+  bool NonLinearSystemSolver::solvesLinearSystemsBasedOnTheJacobian() const {
+    return false;
+  }  // end of solvesLinearSystemsBasedOnTheJacobian
+
   NonLinearSystemSolver::~NonLinearSystemSolver() = default;
 
 }  // end of namespace mfront
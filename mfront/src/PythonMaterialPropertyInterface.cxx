@@ -246,6 +246,194 @@ namespace mfront {
     }
   }
 
+  /*!
+   * \brief write the function evaluating the material property on a set of
+   * points stored in objects supporting the buffer protocol (`NumPy` arrays
+   * for instance). Data are neither copied nor converted.
+   * \param[out] os: output stream
+   * \param[in] mpd: material property description
+   * \param[in] fd: file description
+   * \param[in] name: name of the material property
+   */
+  static void writeArrayWrapper(std::ostream& os,
+                                const MaterialPropertyDescription& mpd,
+                                const FileDescription& fd,
+                                const std::string& name) {
+    const auto checks = !areRuntimeChecksDisabled(mpd);
+    const auto use_qt = useQuantities(mpd);
+    const auto n = mpd.inputs.size();
+    os << "PyObject *\n"
+       << name << "_array_wrapper(PyObject *,PyObject * py_args_)\n{\n";
+    writeBeginningOfMaterialPropertyBody(os, mpd, fd, "double", true);
+    os << "auto throwPythonRuntimeException = [](const string& msg){\n"
+       << "  PyErr_SetString(PyExc_RuntimeError,msg.c_str());\n"
+       << "  return nullptr;\n"
+       << "};\n"
+       << "auto throwPythonValueError = [](const char* const msg){\n"
+       << "  PyErr_SetString(PyExc_ValueError, msg);\n"
+       << "  return nullptr;\n"
+       << "};\n";
+    if ((!areParametersTreatedAsStaticVariables(mpd)) &&
+        (!mpd.parameters.empty())) {
+      const auto hn = getMaterialPropertyParametersHandlerClassName(name);
+      os << "if(!python::" << hn << "::get" << hn << "().ok){\n"
+         << "return throwPythonRuntimeException(python::" << name
+         << "MaterialPropertyHandler::get" << name
+         << "MaterialPropertyHandler().msg);\n"
+         << "}\n";
+    }
+    writeAssignMaterialPropertyParameters(os, mpd, name, "real", "python");
+    os << "PyObject* py_inputs_ = nullptr;\n"
+       << "PyObject* py_outputs_ = nullptr;\n"
+       << "if(!PyArg_ParseTuple(py_args_, \"OO\", &py_inputs_, "
+       << "&py_outputs_)){\n"
+       << "return NULL;\n"
+       << "}\n"
+       << "// buffers are released on exit\n"
+       << "struct BufferGuard {\n"
+       << "~BufferGuard(){\n"
+       << "if(this->acquired){\n"
+       << "PyBuffer_Release(&(this->view));\n"
+       << "}\n"
+       << "}\n"
+       << "Py_buffer view;\n"
+       << "bool acquired = false;\n"
+       << "};\n"
+       << "auto is_double = [](const Py_buffer& b){\n"
+       << "if(b.itemsize != sizeof(double)){\n"
+       << "return false;\n"
+       << "}\n"
+       << "return (b.format == nullptr) || (std::strcmp(b.format, \"d\") == 0) ||\n"
+       << "(std::strcmp(b.format, \"@d\") == 0) ||\n"
+       << "(std::strcmp(b.format, \"=d\") == 0);\n"
+       << "};\n"
+       << "BufferGuard py_inputs_buffer_;\n"
+       << "if(PyObject_GetBuffer(py_inputs_, &(py_inputs_buffer_.view), "
+       << "PyBUF_STRIDES | PyBUF_FORMAT) != 0){\n"
+       << "return NULL;\n"
+       << "}\n"
+       << "py_inputs_buffer_.acquired = true;\n"
+       << "BufferGuard py_outputs_buffer_;\n"
+       << "if(PyObject_GetBuffer(py_outputs_, &(py_outputs_buffer_.view), "
+       << "PyBUF_STRIDES | PyBUF_FORMAT | PyBUF_WRITABLE) != 0){\n"
+       << "return NULL;\n"
+       << "}\n"
+       << "py_outputs_buffer_.acquired = true;\n"
+       << "const auto& py_iv_ = py_inputs_buffer_.view;\n"
+       << "const auto& py_ov_ = py_outputs_buffer_.view;\n"
+       << "if((!is_double(py_iv_)) || (!is_double(py_ov_))){\n"
+       << "return throwPythonValueError(\"" << name << "_array: \"\n"
+       << "\"arrays of double precision numbers are expected\");\n"
+       << "}\n"
+       << "if((py_ov_.ndim != 1) || ((py_ov_.shape[0] > 1) && "
+       << "(py_ov_.strides[0] != sizeof(double)))){\n"
+       << "return throwPythonValueError(\"" << name << "_array: \"\n"
+       << "\"the outputs must be stored in a contiguous \"\n"
+       << "\"one-dimensional array\");\n"
+       << "}\n"
+       << "const auto mfront_n = static_cast<Py_ssize_t>(py_ov_.shape[0]);\n"
+       << "auto mfront_stride = Py_ssize_t{" << n << "};\n";
+    if (n == 1) {
+      os << "if(py_iv_.ndim == 1){\n"
+         << "if(py_iv_.shape[0] != mfront_n){\n"
+         << "return throwPythonValueError(\"" << name << "_array: \"\n"
+         << "\"the number of inputs does not match the number of \"\n"
+         << "\"outputs\");\n"
+         << "}\n"
+         << "if(mfront_n > 1){\n"
+         << "mfront_stride = py_iv_.strides[0] / "
+         << "static_cast<Py_ssize_t>(sizeof(double));\n"
+         << "}\n"
+         << "if((mfront_n > 1) && ((mfront_stride <= 0) || "
+         << "(py_iv_.strides[0] % sizeof(double) != 0))){\n"
+         << "return throwPythonValueError(\"" << name << "_array: \"\n"
+         << "\"unsupported layout of the inputs\");\n"
+         << "}\n"
+         << "} else ";
+    }
+    os << "if(py_iv_.ndim == 2){\n"
+       << "if((py_iv_.shape[0] != mfront_n) || (py_iv_.shape[1] < "
+       << n << ")){\n"
+       << "return throwPythonValueError(\"" << name << "_array: \"\n"
+       << "\"the inputs must be stored in an array of shape \"\n"
+       << "\"(n, " << n << ")\");\n"
+       << "}\n"
+       << "if(mfront_n > 1){\n"
+       << "mfront_stride = py_iv_.strides[0] / "
+       << "static_cast<Py_ssize_t>(sizeof(double));\n"
+       << "}\n"
+       << "if(((" << n << " > 1) && (py_iv_.strides[1] != sizeof(double))) ||\n"
+       << "((mfront_n > 1) && ((mfront_stride < " << n << ") || "
+       << "(py_iv_.strides[0] % sizeof(double) != 0)))){\n"
+       << "return throwPythonValueError(\"" << name << "_array: \"\n"
+       << "\"the values of the inputs of each point must be \"\n"
+       << "\"contiguous\");\n"
+       << "}\n"
+       << "} else {\n"
+       << "return throwPythonValueError(\"" << name << "_array: \"\n"
+       << "\"invalid number of dimensions of the inputs\");\n"
+       << "}\n"
+       << "const auto* const mfront_args = "
+       << "static_cast<const double*>(py_iv_.buf);\n"
+       << "auto* const mfront_outputs = static_cast<double*>(py_ov_.buf);\n";
+    auto write_inputs = [&os, &mpd, use_qt] {
+      os << "const auto* const mfront_point = "
+         << "mfront_args + mfront_i * mfront_stride;\n";
+      auto i = std::size_t{};
+      for (const auto& v : mpd.inputs) {
+        os << "[[maybe_unused]] const auto " << v.name << " = ";
+        if (use_qt) {
+          os << v.type << "(mfront_point[" << i << "]);\n";
+        } else {
+          os << "mfront_point[" << i << "];\n";
+        }
+        ++i;
+      }
+    };
+    if ((checks) &&
+        ((hasPhysicalBounds(mpd.inputs)) || (hasBounds(mpd.inputs)))) {
+      // inputs are checked before any evaluation
+      os << "#ifndef PYTHON_NO_BOUNDS_CHECK\n"
+         << "for(Py_ssize_t mfront_i = 0; mfront_i != mfront_n; "
+         << "++mfront_i){\n";
+      write_inputs();
+      for (const auto& i : mpd.inputs) {
+        writePhysicalBounds(os, name, i);
+      }
+      for (const auto& i : mpd.inputs) {
+        writeBounds(os, mpd, name, i);
+      }
+      os << "}\n"
+         << "#endif /* PYTHON_NO_BOUNDS_CHECK */\n";
+    }
+    os << "try{\n";
+    writeMaterialPropertyArrayLoop(os, mpd, "mfront_args", "mfront_stride",
+                                   "mfront_n", "mfront_outputs");
+    os << "} catch(exception& cpp_except){\n"
+       << "  return throwPythonRuntimeException(cpp_except.what());\n"
+       << "} catch(...){\n"
+       << "  return throwPythonRuntimeException(\"unknown C++ exception\");\n"
+       << "}\n";
+    if ((checks) &&
+        ((hasPhysicalBounds(mpd.output)) || (hasBounds(mpd.output)))) {
+      os << "#ifndef PYTHON_NO_BOUNDS_CHECK\n"
+         << "for(Py_ssize_t mfront_i = 0; mfront_i != mfront_n; "
+         << "++mfront_i){\n"
+         << "const auto " << mpd.output.name << " = ";
+      if (use_qt) {
+        os << mpd.output.type << "(mfront_outputs[mfront_i]);\n";
+      } else {
+        os << "mfront_outputs[mfront_i];\n";
+      }
+      writePhysicalBounds(os, name, mpd.output);
+      writeBounds(os, mpd, name, mpd.output);
+      os << "}\n"
+         << "#endif /* PYTHON_NO_BOUNDS_CHECK */\n";
+    }
+    os << "Py_RETURN_NONE;\n"
+       << "} // end of " << name << "_array\n\n";
+  }  // end of writeArrayWrapper
+
   void PythonMaterialPropertyInterface::writeOutputFiles(
       const MaterialPropertyDescription& mpd, const FileDescription& fd) const {
     using namespace tfel::system;
@@ -300,8 +488,15 @@ namespace mfront {
         << "#endif /* __cplusplus */\n\n"
         << "PyObject *\n"
         << name << "_wrapper("
-        << "PyObject *,PyObject *);\n\n"
-        << "#ifdef __cplusplus\n"
+        << "PyObject *,PyObject *);\n\n";
+    if (!inputs.empty()) {
+      out << "#define " << makeUpperCase(name)
+          << "_PYTHON_HAS_ARRAY_WRAPPER\n\n"
+          << "PyObject *\n"
+          << name << "_array_wrapper("
+          << "PyObject *,PyObject *);\n\n";
+    }
+    out << "#ifdef __cplusplus\n"
         << "} // end of extern \"C\"\n"
         << "#endif /* __cplusplus */\n\n"
         << "#endif /* " << makeUpperCase(name) << "_PYTHON_HH */\n";
@@ -482,8 +677,11 @@ namespace mfront {
       }
     }
     srcFile << "return Py_BuildValue(\"d\"," << output.name << ");\n"
-            << "} // end of " << name << "\n\n"
-            << "#ifdef __cplusplus\n"
+            << "} // end of " << name << "\n\n";
+    if (!inputs.empty()) {
+      writeArrayWrapper(srcFile, mpd, fd, name);
+    }
+    srcFile << "#ifdef __cplusplus\n"
             << "} // end of extern \"C\"\n"
             << "#endif /* __cplusplus */\n\n";
     srcFile.close();
@@ -564,7 +762,13 @@ namespace mfront {
     wrapper << "static PyMethodDef " << mlm << "[] = {\n";
     for (const auto& i : interfaces) {
       wrapper << "{\"" << i << "\"," << i << "_wrapper,METH_VARARGS,\n"
-              << "\"compute the " << i << " law.\"},\n";
+              << "\"compute the " << i << " law.\"},\n"
+              << "#ifdef " << makeUpperCase(i) << "_PYTHON_HAS_ARRAY_WRAPPER\n"
+              << "{\"" << i << "_array\"," << i << "_array_wrapper,"
+              << "METH_VARARGS,\n"
+              << "\"compute the " << i << " law on a set of points.\"},\n"
+              << "#endif /* " << makeUpperCase(i)
+              << "_PYTHON_HAS_ARRAY_WRAPPER */\n";
     }
     wrapper << "{NULL, NULL, 0, NULL} /* Sentinel */\n};\n\n";
     const auto md = makeLowerCase(getMaterialLawLibraryNameBase(mpd));
@@ -0,0 +1,117 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/AutomaticDifferentiationBenchmark.cxx
+ * \brief  This benchmark compares the cost of the integration of a single
+ * crystal behaviour when the jacobian of the implicit system is computed by
+ * automatic differentiation or by centered finite differences.
+ *
+ * Usage: `AutomaticDifferentiationBenchmark <library> [<repetitions>]`
+ *
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+//! \brief number of components of the strain and the stress
+static constexpr mfront_gb_size_type StensorSize = 6;
+//! \brief number of internal state variables
+static constexpr mfront_gb_size_type nisvs = StensorSize + 4 * 12;
+
+/*!
+ * \return the time, in seconds, spent to integrate the behaviour over a
+ * uniaxial strain loading of `nsteps` time steps, repeated `r` times.
+ * \param[in] fct: behaviour integration function
+ * \param[in] r: number of repetitions
+ */
+static double benchmark(const tfel::system::GenericBehaviourFctPtr fct,
+                        const int r) {
+  constexpr auto G = 80000.;
+  constexpr auto young = 2.6 * G;
+  constexpr auto nu = 0.3;
+  constexpr auto nsteps = 10;
+  constexpr auto rho0 = 1.e6 * 2.54e-7 * 2.54e-7;
+  const auto mps = std::vector<double>{
+      young, young, young, nu,  nu,   nu,  G,    G,       G, 105,
+      2.5e-7, 5,    1.e-3, 0.13, 0.005, 1.e6, 0.35, 2.54e-7, G};
+  const auto T = 293.15;
+  const auto start = std::chrono::steady_clock::now();
+  for (int k = 0; k != r; ++k) {
+    auto e0 = std::vector<double>(StensorSize, 0.);
+    auto s0 = std::vector<double>(StensorSize, 0.);
+    auto isvs0 = std::vector<double>(nisvs, 0.);
+    std::fill(isvs0.begin() + StensorSize, isvs0.begin() + StensorSize + 12,
+              rho0);
+    auto e1 = e0;
+    auto s1 = s0;
+    auto isvs1 = isvs0;
+    auto K = std::vector<double>(StensorSize * StensorSize, 0.);
+    for (int i = 0; i != nsteps; ++i) {
+      e1[2] = e0[2] + 4e-4;
+      auto rdt = 1.;
+      auto d = mfront_gb_BehaviourData{};
+      d.error_message = nullptr;
+      d.dt = 0.1;
+      d.rdt = &rdt;
+      d.K = K.data();
+      d.K[0] = 4;  // consistent tangent operator
+      d.speed_of_sound = nullptr;
+      d.s0 = {e0.data(),    s0.data(), nullptr, mps.data(),
+              isvs0.data(), nullptr,   nullptr, &T};
+      d.s1 = {e1.data(),    s1.data(), nullptr, mps.data(),
+              isvs1.data(), nullptr,   nullptr, &T};
+      d.parameters = nullptr;
+      if (fct(&d) != 1) {
+        std::cerr << "AutomaticDifferentiationBenchmark: "
+                  << "integration failed\n";
+        std::exit(EXIT_FAILURE);
+      }
+      std::swap(e0, e1);
+      std::swap(s0, s1);
+      std::swap(isvs0, isvs1);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  if ((argc != 2) && (argc != 3)) {
+    std::cerr << "usage: AutomaticDifferentiationBenchmark <library> "
+              << "[<repetitions>]\n";
+    return EXIT_FAILURE;
+  }
+  const auto r = (argc == 3) ? std::atoi(argv[2]) : 100;
+  if (r <= 0) {
+    std::cerr << "AutomaticDifferentiationBenchmark: "
+              << "invalid number of repetitions\n";
+    return EXIT_FAILURE;
+  }
+  using tfel::system::ExternalLibraryManager;
+  auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+  const auto fd = elm.getGenericBehaviourFunction(
+      argv[1], "MonoCrystal_DD_CFC_NumericalJacobian_Tridimensional");
+  const auto ad = elm.getGenericBehaviourFunction(
+      argv[1], "MonoCrystal_DD_CFC_AutomaticDifferentiation_Tridimensional");
+  // warm-up
+  benchmark(fd, 1);
+  benchmark(ad, 1);
+  const auto tfd = benchmark(fd, r);
+  const auto tad = benchmark(ad, r);
+  std::cout << "finite differences:         " << tfd << " s\n"
+            << "automatic differentiation:  " << tad << " s\n"
+            << "speed-up:                   " << tfd / tad << '\n';
+  return EXIT_SUCCESS;
+}  // end of main
@@ -0,0 +1,153 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/AutomaticDifferentiationTest.cxx
+ * \brief  This test checks that a behaviour whose jacobian is computed by
+ * automatic differentiation gives the same results as the same behaviour
+ * using a jacobian computed by finite differences.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+
+//! \brief path to the library containing the tested behaviours
+static std::string library;
+
+struct AutomaticDifferentiationTest final : public tfel::tests::TestCase {
+  AutomaticDifferentiationTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "AutomaticDifferentiationTest") {
+  }  // end of AutomaticDifferentiationTest
+
+  tfel::tests::TestResult execute() override {
+    const auto r1 = this->integrate(
+        "MonoCrystal_DD_CFC_NumericalJacobian_Tridimensional");
+    const auto r2 = this->integrate(
+        "MonoCrystal_DD_CFC_AutomaticDifferentiation_Tridimensional");
+    TFEL_TESTS_ASSERT(r1.size() == r2.size());
+    if (r1.size() != r2.size()) {
+      return this->result;
+    }
+    const auto smax = std::abs(r1.back().s[2]);
+    // the plastic flow must be activated
+    TFEL_TESTS_ASSERT(std::abs(r1.back().isvs[StensorSize + 12]) > 0);
+    for (std::vector<State>::size_type i = 0; i != r1.size(); ++i) {
+      for (mfront_gb_size_type c = 0; c != StensorSize; ++c) {
+        TFEL_TESTS_ASSERT(std::abs(r1[i].s[c] - r2[i].s[c]) < 1e-8 * smax);
+      }
+      for (mfront_gb_size_type c = 0; c != StensorSize + 12; ++c) {
+        const auto e =
+            std::max(std::abs(r1[i].isvs[c]), std::abs(r2[i].isvs[c]));
+        TFEL_TESTS_ASSERT(std::abs(r1[i].isvs[c] - r2[i].isvs[c]) <=
+                          1e-6 * e + 1e-14);
+      }
+      for (mfront_gb_size_type c = 0; c != StensorSize * StensorSize; ++c) {
+        TFEL_TESTS_ASSERT(std::abs(r1[i].K[c] - r2[i].K[c]) < 1e-5 * young);
+      }
+    }
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief number of components of the strain and the stress
+  static constexpr mfront_gb_size_type StensorSize = 6;
+  //! \brief number of internal state variables
+  static constexpr mfront_gb_size_type nisvs = StensorSize + 4 * 12;
+  //! \brief state of the material at the end of a time step
+  struct State {
+    std::vector<double> s;
+    std::vector<double> isvs;
+    std::vector<double> K;
+  };
+  //! \brief shear modulus
+  static constexpr double G = 80000;
+  //! \brief Young modulus
+  static constexpr double young = 2.6 * G;
+  //! \brief Poisson ratio
+  static constexpr double nu = 0.3;
+  //! \brief values of the material properties
+  const std::vector<double> mps = {young, young, young, nu,     nu,
+                                   nu,    G,     G,     G,      105,
+                                   2.5e-7, 5,    1.e-3, 0.13,   0.005,
+                                   1.e6,  0.35,  2.54e-7, G};
+  //! \brief temperature
+  const double T = 293.15;
+  /*!
+   * \brief integrate the behaviour over a uniaxial strain loading and return
+   * the state of the material at the end of each time step.
+   * \param[in] f: function name
+   */
+  std::vector<State> integrate(const std::string& f) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto fct = elm.getGenericBehaviourFunction(library, f);
+    constexpr auto nsteps = 10;
+    constexpr auto rho0 = 1.e6 * 2.54e-7 * 2.54e-7;
+    auto e0 = std::vector<double>(StensorSize, 0.);
+    auto s0 = std::vector<double>(StensorSize, 0.);
+    auto isvs0 = std::vector<double>(nisvs, 0.);
+    std::fill(isvs0.begin() + StensorSize, isvs0.begin() + StensorSize + 12,
+              rho0);
+    auto states = std::vector<State>{};
+    for (int i = 0; i != nsteps; ++i) {
+      auto e1 = e0;
+      e1[2] += 4e-4;
+      auto state = State{s0, isvs0,
+                         std::vector<double>(StensorSize * StensorSize, 0.)};
+      auto rdt = 1.;
+      auto d = mfront_gb_BehaviourData{};
+      d.error_message = nullptr;
+      d.dt = 0.1;
+      d.rdt = &rdt;
+      d.K = state.K.data();
+      d.K[0] = 4;  // consistent tangent operator
+      d.speed_of_sound = nullptr;
+      d.s0 = {e0.data(),    s0.data(), nullptr, mps.data(),
+              isvs0.data(), nullptr,   nullptr, &T};
+      d.s1 = {e1.data(),          state.s.data(), nullptr, mps.data(),
+              state.isvs.data(), nullptr,        nullptr, &T};
+      d.parameters = nullptr;
+      TFEL_TESTS_ASSERT(fct(&d) == 1);
+      e0 = e1;
+      s0 = state.s;
+      isvs0 = state.isvs;
+      states.push_back(std::move(state));
+    }
+    return states;
+  }  // end of integrate
+};
+
+TFEL_TESTS_GENERATE_PROXY(AutomaticDifferentiationTest,
+                          "AutomaticDifferentiationTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "AutomaticDifferentiationTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("AutomaticDifferentiationTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,100 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/MTestEnsembleTest.cxx
+ * \brief  This test runs an ensemble of variants of the `ensemble.mtest`
+ * input file and checks that the results gathered are consistent with
+ * the values of the parameters of each variant and do not depend on the
+ * number of threads used.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "MTest/MTestEnsemble.hxx"
+
+//! \brief path to the library containing the tested behaviours
+static std::string library;
+//! \brief path to the input file
+static std::string input;
+
+struct MTestEnsembleTest final : public tfel::tests::TestCase {
+  MTestEnsembleTest()
+      : tfel::tests::TestCase("MTest", "MTestEnsembleTest") {
+  }  // end of MTestEnsembleTest
+
+  tfel::tests::TestResult execute() override {
+    using real = mtest::real;
+    constexpr auto nv = std::size_t{8};
+    auto e = mtest::MTestEnsemble(input, {},
+                                  {{"@library@", '"' + library + '"'}});
+    for (std::size_t i = 0; i != nv; ++i) {
+      const auto v = static_cast<real>(i);
+      e.addVariant({{"YoungModulus", 100e9 + 10e9 * v},
+                    {"e0", 1e-3 * (1 + v / 2)}});
+    }
+    TFEL_TESTS_ASSERT(e.getNumberOfVariants() == nv);
+    const auto r1 = e.execute();
+    TFEL_TESTS_ASSERT(r1.succeeded());
+    TFEL_TESTS_ASSERT(r1.failures.size() == nv);
+    // 21 times per variant
+    const auto& variant = r1.getColumn("variant");
+    TFEL_TESTS_ASSERT(variant.size() == 21 * nv);
+    const auto& E = r1.getColumn("YoungModulus");
+    const auto& e0 = r1.getColumn("e0");
+    const auto& t = r1.getColumn("time");
+    const auto& exx = r1.getColumn("EXX");
+    const auto& sxx = r1.getColumn("SXX");
+    for (std::size_t i = 0; i != variant.size(); ++i) {
+      const auto v = i / 21;
+      TFEL_TESTS_CHECK_EQUAL(static_cast<std::size_t>(variant[i]), v);
+      TFEL_TESTS_ASSERT(std::abs(exx[i] - e0[i] * std::sin(t[i] / 900)) <
+                        1e-14);
+      TFEL_TESTS_ASSERT(std::abs(sxx[i] - E[i] * exx[i]) < 1e-3);
+    }
+    // the results must not depend on the number of threads
+    e.setNumberOfThreads(3);
+    const auto r2 = e.execute();
+    TFEL_TESTS_ASSERT(r2.succeeded());
+    TFEL_TESTS_ASSERT(r1.names == r2.names);
+    TFEL_TESTS_ASSERT(r1.columns == r2.columns);
+    // unknown column
+    TFEL_TESTS_CHECK_THROW(r1.getColumn("UnknownColumn"),
+                           std::runtime_error);
+    // all the variants must define the same parameters
+    TFEL_TESTS_CHECK_THROW(e.addVariant({{"YoungModulus", 150e9}}),
+                           std::runtime_error);
+    return this->result;
+  }  // end of execute
+};
+
+TFEL_TESTS_GENERATE_PROXY(MTestEnsembleTest, "MTestEnsembleTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 3) {
+    std::cerr << "MTestEnsembleTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  input = argv[2];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("MTestEnsembleTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
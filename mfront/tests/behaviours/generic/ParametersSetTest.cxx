@@ -0,0 +1,186 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/ParametersSetTest.cxx
+ * \brief  This test checks that the sets of parameters passed to the
+ * behaviour through the `parameters` member of the behaviour data are taken
+ * into account and are independent of the values of the parameters shared
+ * by all the integration points.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+//! \brief path to the library containing the tested behaviours
+static std::string library;
+
+struct ParametersSetTest final : public tfel::tests::TestCase {
+  ParametersSetTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour", "ParametersSetTest") {
+  }  // end of ParametersSetTest
+
+  tfel::tests::TestResult execute() override {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto b = std::string{"VectorizedNorton"};
+    const auto h = std::string{"Tridimensional"};
+    const auto create =
+        elm.getGenericBehaviourCreateParametersSetFunction(library, b);
+    const auto copy =
+        elm.getGenericBehaviourCopyParametersSetFunction(library, b);
+    const auto set =
+        elm.getGenericBehaviourSetParameterInParametersSetFunction(library, b);
+    const auto destroy =
+        elm.getGenericBehaviourDestroyParametersSetFunction(library, b);
+    // default values of the parameters
+    auto* const p1 = create();
+    TFEL_TESTS_ASSERT(p1 != nullptr);
+    // modified values of the parameters
+    auto* const p2 = copy(p1);
+    TFEL_TESTS_ASSERT(p2 != nullptr);
+    TFEL_TESTS_ASSERT(set(p2, "theta", 1.) == 1);
+    TFEL_TESTS_ASSERT(set(p2, "UnknownParameter", 1.) == 0);
+    const auto r0 = this->integrate(b + "_" + h, nullptr);
+    const auto r1 = this->integrate(b + "_" + h, p1);
+    const auto r2 = this->integrate(b + "_" + h, p2);
+    TFEL_TESTS_ASSERT(r0 == r1);
+    TFEL_TESTS_ASSERT(r0 != r2);
+    // the batch may be integrated by a vectorized algorithm, see the
+    // `VectorizedBatchIntegrationTest` test for details.
+    const auto r3 = this->integrateBatch(b + "_" + h, p2);
+    for (mfront_gb_size_type i = 0; i != ns; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(r2[i] - r3[i]) < 1e-12 * std::abs(r2[0]));
+    }
+    // modifying the values of the parameters shared by all the integration
+    // points does not affect the sets of parameters
+    elm.setParameter(library, b, h, "theta", 1.);
+    TFEL_TESTS_ASSERT(this->integrate(b + "_" + h, nullptr) == r2);
+    TFEL_TESTS_ASSERT(this->integrate(b + "_" + h, p1) == r0);
+    elm.setParameter(library, b, h, "theta", 0.5);
+    TFEL_TESTS_ASSERT(this->integrate(b + "_" + h, nullptr) == r0);
+    destroy(p1);
+    destroy(p2);
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief number of components of the strain and the stress
+  static constexpr mfront_gb_size_type ns = 6;
+  //! \brief number of internal state variables (elastic strain and p)
+  static constexpr mfront_gb_size_type nisvs = 7;
+  //! \brief values of the material properties
+  const std::vector<double> mps = {150e9, 0.3, 8.e-67, 8.2};
+  //! \brief temperature
+  const double T = 293.15;
+  //! \brief initial state
+  const std::vector<double> e0 = std::vector<double>(ns, 0.);
+  const std::vector<double> s0 = std::vector<double>(ns, 0.);
+  const std::vector<double> isvs0 = std::vector<double>(nisvs, 0.);
+  //! \brief imposed strain at the end of the time step
+  const std::vector<double> e1 = {4e-3, -1.2e-3, -1.2e-3, 0., 0., 0.};
+  /*!
+   * \brief integrate the behaviour over one time step and return the stress
+   * at the end of the time step.
+   * \param[in] f: function name
+   * \param[in] p: parameters set
+   */
+  std::vector<double> integrate(const std::string& f,
+                                const mfront_gb_ParametersSet* const p) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto fct = elm.getGenericBehaviourFunction(library, f);
+    auto s1 = std::vector<double>(ns, 0.);
+    auto isvs1 = std::vector<double>(nisvs, 0.);
+    auto K = std::vector<double>(ns * ns, 0.);
+    auto rdt = 1.;
+    auto d = mfront_gb_BehaviourData{};
+    d.error_message = nullptr;
+    d.dt = 10.;
+    d.rdt = &rdt;
+    d.K = K.data();
+    d.K[0] = 0;  // no tangent operator
+    d.speed_of_sound = nullptr;
+    d.s0 = {e0.data(),    s0.data(), nullptr, mps.data(),
+            isvs0.data(), nullptr,   nullptr, &T};
+    d.s1 = {e1.data(),    s1.data(), nullptr, mps.data(),
+            isvs1.data(), nullptr,   nullptr, &T};
+    d.parameters = p;
+    TFEL_TESTS_ASSERT(fct(&d) == 1);
+    return s1;
+  }  // end of integrate
+  /*!
+   * \brief integrate the behaviour over one time step on a batch of three
+   * identical integration points and return the stress of the last
+   * integration point at the end of the time step.
+   * \param[in] f: function name
+   * \param[in] p: parameters set
+   */
+  std::vector<double> integrateBatch(const std::string& f,
+                                     const mfront_gb_ParametersSet* const p) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto fct =
+        elm.getGenericBehaviourBatchIntegrationFunction(library, f);
+    constexpr mfront_gb_size_type n = 3;
+    auto s1 = std::vector<double>(n * ns, 0.);
+    auto isvs1 = std::vector<double>(n * nisvs, 0.);
+    auto K = std::vector<double>(n * ns * ns, 0.);
+    auto status = std::vector<int>(n, 0);
+    auto rdt = 1.;
+    auto bd = mfront_gb_BatchBehaviourData{};
+    bd.error_message = nullptr;
+    bd.n = n;
+    bd.dt = 10.;
+    bd.K = K.data();
+    bd.K[0] = 0;  // no tangent operator
+    bd.K_stride = ns * ns;
+    bd.rdt = &rdt;
+    bd.speed_of_sound = nullptr;
+    bd.speed_of_sound_stride = 0;
+    bd.status = status.data();
+    bd.s0 = {e0.data(),    0, s0.data(), 0, nullptr, 0, mps.data(), 0,
+             isvs0.data(), 0, nullptr,   0, nullptr, 0, &T,         0};
+    bd.s1 = {e1.data(),    0,     s1.data(), ns, nullptr, 0, mps.data(), 0,
+             isvs1.data(), nisvs, nullptr,   0,  nullptr, 0, &T,         0};
+    bd.parameters = p;
+    fct(&bd);
+    for (const auto s : status) {
+      TFEL_TESTS_ASSERT(s == 1);
+    }
+    return {s1.begin() + (n - 1) * ns, s1.end()};
+  }  // end of integrateBatch
+};
+
+TFEL_TESTS_GENERATE_PROXY(ParametersSetTest, "ParametersSetTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "ParametersSetTest: invalid number of arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("ParametersSetTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,213 @@
+/*!
+ * \file   mfront/tests/behaviours/generic/VectorizedBatchIntegrationTest.cxx
+ * \brief  This test checks that the vectorized integration of a batch of
+ * integration points gives the same results as the integration of each
+ * integration point.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <map>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "TFEL/Raise.hxx"
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/ExternalLibraryManager.hxx"
+#include "TFEL/System/ExternalBehaviourDescription.hxx"
+#include "MFront/GenericBehaviour/BehaviourData.h"
+#include "MFront/GenericBehaviour/BatchBehaviourData.h"
+
+//! \brief path to the library containing the tested behaviours
+static std::string library;
+
+struct VectorizedBatchIntegrationTest final : public tfel::tests::TestCase {
+  VectorizedBatchIntegrationTest()
+      : tfel::tests::TestCase("MFront/GenericBehaviour",
+                              "VectorizedBatchIntegrationTest") {
+  }  // end of VectorizedBatchIntegrationTest
+
+  tfel::tests::TestResult execute() override {
+    const auto elastic_properties = std::map<std::string, double>{
+        {"YoungModulus", 150e9}, {"PoissonRatio", 0.3}};
+    auto mps = elastic_properties;
+    mps.insert({{"NortonCoefficient", 8.e-67}, {"NortonExponent", 8.2}});
+    this->check("VectorizedNorton", mps);
+    mps = elastic_properties;
+    mps.insert({{"H", 10e9}, {"s0", 200e6}});
+    this->check("VectorizedPlasticity", mps);
+    this->check("VectorizedStrainHardeningCreep",
+                {{"A", 8.e-67}, {"Ns", 8.2}, {"Np", 0.2}});
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief number of integration points (not a multiple of the batch size)
+  static constexpr mfront_gb_size_type n = 21;
+  //! \brief number of components of the strain and the stress
+  static constexpr mfront_gb_size_type ns = 6;
+  //! \brief results of the integration of the behaviour
+  struct Results {
+    std::vector<double> e0, e1, s0, s1, isvs0, isvs1, K;
+    std::vector<int> status;
+  };
+  /*!
+   * \brief initialize the data used to integrate the behaviour over two time
+   * steps.
+   */
+  static Results initialize(const std::size_t nisvs) {
+    auto r = Results{};
+    r.e0.resize(n * ns, 0.);
+    r.e1.resize(n * ns, 0.);
+    r.s0.resize(n * ns, 0.);
+    r.s1.resize(n * ns, 0.);
+    r.isvs0.resize(n * nisvs, 0.);
+    r.isvs1.resize(n * nisvs, 0.);
+    r.K.resize(n * ns * ns, 0.);
+    r.status.resize(n, 1);
+    for (mfront_gb_size_type i = 0; i != n; ++i) {
+      // the first integration points are elastic
+      const auto de = 2.e-4 * i;
+      r.e1[i * ns] = de;
+      r.e1[i * ns + 1] = -0.3 * de;
+      r.e1[i * ns + 2] = -0.3 * de;
+      r.e1[i * ns + 3] = (i % 3) * 0.1 * de;
+    }
+    return r;
+  }  // end of initialize
+  //! \brief prepare the next time step
+  static void update(Results& r) {
+    r.e0 = r.e1;
+    r.s0 = r.s1;
+    r.isvs0 = r.isvs1;
+    for (auto& e : r.e1) {
+      e *= 2;
+    }
+  }  // end of update
+  /*!
+   * \brief check the vectorized integration of the given behaviour
+   * \param[in] b: behaviour name
+   * \param[in] mp: values of the material properties
+   */
+  void check(const std::string& b, const std::map<std::string, double>& mp) {
+    using tfel::system::ExternalLibraryManager;
+    auto& elm = ExternalLibraryManager::getExternalLibraryManager();
+    const auto h = std::string{"Tridimensional"};
+    const auto f = b + "_" + h;
+    const auto d = tfel::system::ExternalBehaviourDescription(library, b, h);
+    TFEL_TESTS_ASSERT(
+        elm.hasGenericBehaviourBatchIntegrationFunction(library, b, h));
+    const auto integrate = elm.getGenericBehaviourFunction(library, f);
+    const auto integrate_batch =
+        elm.getGenericBehaviourBatchIntegrationFunction(library, f);
+    auto mps = std::vector<double>{};
+    for (const auto& mp_name : d.mpnames) {
+      const auto p = mp.find(mp_name);
+      tfel::raise_if(p == mp.end(),
+                     "VectorizedBatchIntegrationTest::check: "
+                     "no value for material property '" +
+                         mp_name + "'");
+      mps.push_back(p->second);
+    }
+    const auto nisvs = std::size_t{7};  // elastic strain and p
+    const auto T = 293.15;
+    const auto dt = 10.;
+    const double* const null = nullptr;
+    auto r1 = initialize(nisvs);
+    auto r2 = initialize(nisvs);
+    for (int step = 0; step != 2; ++step) {
+      // integration of each integration point
+      for (mfront_gb_size_type i = 0; i != n; ++i) {
+        auto rdt = 1.;
+        auto data = mfront_gb_BehaviourData{};
+        data.error_message = nullptr;
+        data.dt = dt;
+        data.rdt = &rdt;
+        data.K = r1.K.data() + i * ns * ns;
+        data.K[0] = 4;  // consistent tangent operator
+        data.speed_of_sound = nullptr;
+        data.s0 = {r1.e0.data() + i * ns, r1.s0.data() + i * ns, null,
+                   mps.data(), r1.isvs0.data() + i * nisvs, null, null, &T};
+        data.s1 = {r1.e1.data() + i * ns, r1.s1.data() + i * ns, null,
+                   mps.data(), r1.isvs1.data() + i * nisvs, nullptr, nullptr,
+                   &T};
+        r1.status[i] = integrate(&data);
+      }
+      // integration of the batch
+      auto rdt = 1.;
+      auto bd = mfront_gb_BatchBehaviourData{};
+      bd.error_message = nullptr;
+      bd.n = n;
+      bd.dt = dt;
+      bd.K = r2.K.data();
+      bd.K[0] = 4;  // consistent tangent operator
+      bd.K_stride = ns * ns;
+      bd.rdt = &rdt;
+      bd.speed_of_sound = nullptr;
+      bd.speed_of_sound_stride = 0;
+      bd.status = r2.status.data();
+      bd.s0 = {r2.e0.data(), ns, r2.s0.data(), ns, null, 0, mps.data(), 0,
+               r2.isvs0.data(), nisvs, null, 0, null, 0, &T, 0};
+      bd.s1 = {r2.e1.data(), ns, r2.s1.data(), ns, null, 0, mps.data(), 0,
+               r2.isvs1.data(), nisvs, nullptr, 0, nullptr, 0, &T, 0};
+      integrate_batch(&bd);
+      // Both paths evaluate the same expressions in the same order. The
+      // results are expected to be identical unless the compiler contracts
+      // floating-point operations (fused multiply-add) differently in the
+      // scalar and the vectorized loops, hence a relative tolerance of
+      // 1e-12.
+      auto compare = [this, &b](const std::vector<double>& v1,
+                                const std::vector<double>& v2) {
+        for (std::size_t i = 0; i != v1.size(); ++i) {
+          const auto e = std::abs(v1[i] - v2[i]);
+          const auto s = std::max({std::abs(v1[i]), std::abs(v2[i]), 1.});
+          if (e > 1e-12 * s) {
+            std::cerr << b << ": " << v1[i] << " vs " << v2[i] << '\n';
+          }
+          TFEL_TESTS_ASSERT(e <= 1e-12 * s);
+        }
+      };
+      TFEL_TESTS_ASSERT(r1.status == r2.status);
+      compare(r1.s1, r2.s1);
+      compare(r1.isvs1, r2.isvs1);
+      compare(r1.K, r2.K);
+      update(r1);
+      update(r2);
+    }
+    // the last integration points must be plastic
+    TFEL_TESTS_ASSERT(r1.isvs1[n * nisvs - 1] > 0);
+  }  // end of check
+};
+
+TFEL_TESTS_GENERATE_PROXY(VectorizedBatchIntegrationTest,
+                          "VectorizedBatchIntegrationTest");
+
+int main(const int argc, const char* const* const argv) {
+  if (argc != 2) {
+    std::cerr << "VectorizedBatchIntegrationTest: invalid number of "
+                 "arguments\n";
+    return EXIT_FAILURE;
+  }
+  library = argv[1];
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("VectorizedBatchIntegrationTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -31,5 +31,27 @@ int main(void){
   assert(isnan(ErrnoHandlingCheck(2)));
   assert(!isnan(ErrnoHandlingCheck(0)));
   assert(isnan(ErrnoHandlingCheck(-2)));
+  // evaluation on a set of points
+  {
+    const double Ts[4] = {300., 600., 900., 1200.};
+    const double xs[6] = {0., 1., 0.5, 1., 2., 1.};
+    double r[4];
+    size_t i;
+    assert(VanadiumAlloy_YoungModulus_SRMA_array(Ts, 1, 4, r) == 0);
+    for (i = 0; i != 4; ++i) {
+      const double v = VanadiumAlloy_YoungModulus_SRMA(Ts[i]);
+      assert(fabs(r[i] - v) < 1.e-14 * v);
+    }
+    // the stride is used to skip unused values
+    assert(ErrnoHandlingCheck_array(xs, 2, 2, r) == 0);
+    assert(fabs(r[1] - ErrnoHandlingCheck(0.5)) < 1.e-14);
+    // errno is set for the last point: all outputs are invalidated
+    assert(ErrnoHandlingCheck_array(xs, 2, 3, r) == -1);
+    for (i = 0; i != 3; ++i) {
+      assert(isnan(r[i]));
+    }
+    // invalid stride
+    assert(VanadiumAlloy_YoungModulus_SRMA_array(Ts, 0, 4, r) == -1);
+  }
   return EXIT_SUCCESS;
 }
@@ -50,6 +50,16 @@ struct CxxMaterialPropertyInterfaceTest final : public tfel::tests::TestCase {
     TFEL_TESTS_ASSERT(std::abs(mp_n(900) - n(900)) < 1.e-14 * n(900));
     TFEL_TESTS_CHECK_THROW(mp_y(-900), std::range_error);
     TFEL_TESTS_CHECK_THROW(mp_n(-900), std::range_error);
+    // evaluation on a set of points
+    const double Ts[4] = {300., 600., 900., 1200.};
+    double Es[4];
+    mp_y.computeArray(Ts, 1, 4, Es);
+    for (std::size_t i = 0; i != 4; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(Es[i] - y(Ts[i])) < 1.e-14 * y(Ts[i]));
+    }
+    const double Ts2[2] = {300., -900.};
+    TFEL_TESTS_CHECK_THROW(mp_y.computeArray(Ts2, 1, 2, Es), std::range_error);
+    TFEL_TESTS_CHECK_THROW(mp_y.computeArray(Ts, 0, 4, Es), std::runtime_error);
 #if (!defined _WIN32)
     const auto e_c = mfront::ErrnoHandlingCheck();
     unsetenv("OUT_OF_BOUNDS_POLICY");
@@ -63,6 +73,9 @@ struct CxxMaterialPropertyInterfaceTest final : public tfel::tests::TestCase {
     TFEL_TESTS_CHECK_THROW(mp_n(50), std::range_error);
     TFEL_TESTS_CHECK_THROW(e_c(-2), std::runtime_error);
     TFEL_TESTS_CHECK_THROW(e_c(2), std::runtime_error);
+    const double xs[3] = {0., 0.5, 2.};
+    double rs[3];
+    TFEL_TESTS_CHECK_THROW(e_c.computeArray(xs, 1, 3, rs), std::runtime_error);
 #endif
     return this->result;
   }  // end of execute
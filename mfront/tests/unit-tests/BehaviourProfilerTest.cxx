@@ -0,0 +1,166 @@
+/*!
+ * \file   mfront/tests/unit-tests/BehaviourProfilerTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+
+#include "MFront/BehaviourProfiler.hxx"
+
+struct BehaviourProfilerTest final : public tfel::tests::TestCase {
+  BehaviourProfilerTest()
+      : tfel::tests::TestCase("MFront", "BehaviourProfilerTest") {
+  }  // end of BehaviourProfilerTest
+
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief check the histograms
+  void test1() {
+    using Statistics = mfront::BehaviourProfiler::Statistics;
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(0) == 0);
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(1) == 1);
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(2) == 2);
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(3) == 2);
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(4) == 3);
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(1023) == 10);
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(1024) == 11);
+    TFEL_TESTS_ASSERT(Statistics::getBinIndex(~std::uint64_t{0}) == 64);
+    auto s1 = Statistics{};
+    s1.add(3);
+    s1.add(5);
+    auto s2 = Statistics{};
+    s2.add(6);
+    s1.merge(s2);
+    TFEL_TESTS_ASSERT(s1.count == 3);
+    TFEL_TESTS_ASSERT(s1.total == 14);
+    TFEL_TESTS_ASSERT(s1.histogram[2] == 1);
+    TFEL_TESTS_ASSERT(s1.histogram[3] == 2);
+  }  // end of test1
+  //! \brief check the merge of the statistics of many threads
+  void test2() {
+    using mfront::BehaviourProfiler;
+    constexpr auto nthreads = std::size_t{4};
+    constexpr auto ncalls = std::uint64_t{100};
+    BehaviourProfiler p("BehaviourProfilerTest");
+    auto threads = std::vector<std::thread>{};
+    for (std::size_t i = 0; i != nthreads; ++i) {
+      threads.emplace_back([&p] {
+        for (std::uint64_t j = 0; j != ncalls; ++j) {
+          BehaviourProfiler::Timer t(p, BehaviourProfiler::INTEGRATOR);
+          p.addNumberOfIterations(j % 8);
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    const auto s = p.getStatistics();
+    TFEL_TESTS_ASSERT(s.code_blocks[BehaviourProfiler::INTEGRATOR].count ==
+                      nthreads * ncalls);
+    TFEL_TESTS_ASSERT(s.code_blocks[BehaviourProfiler::TOTALTIME].count == 0);
+    TFEL_TESTS_ASSERT(s.iterations.count == nthreads * ncalls);
+    TFEL_TESTS_ASSERT(s.iterations.total == nthreads * (ncalls / 8) * 28 +
+                                                nthreads * 6);
+    auto n = std::uint64_t{};
+    for (const auto v : s.code_blocks[BehaviourProfiler::INTEGRATOR].histogram) {
+      n += v;
+    }
+    TFEL_TESTS_ASSERT(n == nthreads * ncalls);
+  }  // end of test2
+  //! \brief check the exports
+  void test3() {
+    using mfront::BehaviourProfiler;
+    auto s = BehaviourProfiler::ThreadStatistics{};
+    s.code_blocks[BehaviourProfiler::INTEGRATOR].add(1500);
+    s.iterations.add(3);
+    const auto r =
+        std::vector<std::pair<std::string, BehaviourProfiler::ThreadStatistics>>{
+            {"Norton", s}};
+    std::ostringstream json;
+    BehaviourProfiler::exportToJSON(json, r);
+    const auto j = json.str();
+    TFEL_TESTS_ASSERT(j.find("\"name\": \"Norton\"") != std::string::npos);
+    TFEL_TESTS_ASSERT(j.find("{\"name\": \"Integrator\", \"calls\": 1, "
+                             "\"total_time\": 1500, \"histogram\": "
+                             "[{\"lower_bound\": 1024, \"upper_bound\": "
+                             "2048, \"count\": 1}]}") != std::string::npos);
+    TFEL_TESTS_ASSERT(j.find("\"iterations\": {\"calls\": 1, \"total\": 3") !=
+                      std::string::npos);
+    std::ostringstream csv;
+    BehaviourProfiler::exportToCSV(csv, r);
+    TFEL_TESTS_ASSERT(
+        csv.str() ==
+        "behaviour,code_block,calls,total,lower_bound,upper_bound,count\n"
+        "Norton,Integrator,1,1500,1024,2048,1\n"
+        "Norton,Iterations,1,3,2,4,1\n");
+  }  // end of test3
+  //! \brief check the estimate of the number of iterations saved by warm
+  //! starts
+  void test4() {
+    using mfront::BehaviourProfiler;
+    BehaviourProfiler p("BehaviourProfilerTest");
+    auto s = p.getStatistics();
+    TFEL_TESTS_ASSERT(
+        std::abs(BehaviourProfiler::getEstimatedNumberOfSavedIterations(s)) <
+        1e-14);
+    p.addNumberOfIterations(6);
+    p.addNumberOfIterations(4);
+    p.addNumberOfWarmStartedIterations(2);
+    p.addNumberOfWarmStartedIterations(1);
+    p.addNumberOfWarmStartedIterations(3);
+    s = p.getStatistics();
+    TFEL_TESTS_ASSERT(s.iterations.count == 5);
+    TFEL_TESTS_ASSERT(s.iterations.total == 16);
+    TFEL_TESTS_ASSERT(s.warm_started_iterations.count == 3);
+    TFEL_TESTS_ASSERT(s.warm_started_iterations.total == 6);
+    // the three warm started calls would have required 5 iterations each
+    const auto ns = BehaviourProfiler::getEstimatedNumberOfSavedIterations(s);
+    TFEL_TESTS_ASSERT(std::abs(ns - 9) < 1e-14);
+    const auto r =
+        std::vector<std::pair<std::string, BehaviourProfiler::ThreadStatistics>>{
+            {"Norton", s}};
+    std::ostringstream json;
+    BehaviourProfiler::exportToJSON(json, r);
+    TFEL_TESTS_ASSERT(json.str().find("\"estimated_saved_iterations\": 9") !=
+                      std::string::npos);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(BehaviourProfilerTest, "BehaviourProfilerTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BehaviourProfilerTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,158 @@
+/*!
+ * \file   mfront/tests/unit-tests/RotationKernelsBenchmark.cxx
+ * \brief  This benchmark compares the cost of the rotation of an array of
+ * stresses and consistent tangent operators using the kernels declared in
+ * `MFront/GenericBehaviour/RotationKernels.hxx` to the point by point
+ * implementation previously generated by the `generic` interface, which
+ * builds the change of basis operators for each point.
+ *
+ * Usage: `RotationKernelsBenchmark [<number of points>] [<repetitions>]`
+ *
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "MFront/GenericBehaviour/RotationKernels.hxx"
+
+//! \brief a simple alias
+using real = mfront::gb::real;
+//! \brief a simple alias
+using size_type = mfront::gb::size_type;
+//! \brief number of components of a symmetric tensor
+static constexpr size_type StensorSize = 6;
+//! \brief number of values per point: the stress and the tangent operator
+static constexpr size_type stride = StensorSize + StensorSize * StensorSize;
+//! \brief number of integration points per element
+static constexpr size_type nipe = 27;
+
+/*!
+ * \brief point by point rotation, as done by the functions generated by the
+ * `generic` interface before the introduction of the rotation kernels.
+ */
+static void rotatePointByPoint(real* const dest,
+                               const real* const src,
+                               const real* const rv,
+                               const size_type n) {
+  namespace tm = tfel::math;
+  auto m = tm::tmatrix<3u, 3u, real>{};
+  std::copy(rv, rv + 9, m.begin());
+  const auto r = tm::tmatrix<3u, 3u, real>{tm::transpose(m)};
+  for (size_type idx = 0; idx != n; ++idx) {
+    const auto sig = tm::stensor<3u, real>{src + idx * stride};
+    auto sig_view = tm::StensorView<3u, real>(dest + idx * stride);
+    sig_view = tm::change_basis(sig, r);
+    auto K = tm::st2tost2<3u, real>{};
+    std::copy(src + idx * stride + StensorSize,
+              src + idx * stride + StensorSize + K.size(), K.begin());
+    auto K_view =
+        tm::ST2toST2View<3u, real>(dest + idx * stride + StensorSize);
+    K_view = tm::change_basis(K, r);
+  }
+}  // end of rotatePointByPoint
+
+/*!
+ * \return the time, in seconds, spent to call `f` `r` times.
+ * \param[in] f: function to be benchmarked
+ * \param[in] r: number of repetitions
+ */
+template <typename Function>
+static double benchmark(const Function& f, const int r) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i != r; ++i) {
+    f();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  using namespace mfront::gb;
+  if (argc > 3) {
+    std::cerr << "usage: " << argv[0]
+              << " [<number of points>] [<repetitions>]\n";
+    return EXIT_FAILURE;
+  }
+  const auto n = static_cast<size_type>(argc > 1 ? std::stoul(argv[1])
+                                                 : size_type{100000});
+  const auto r = argc > 2 ? std::stoi(argv[2]) : 20;
+  constexpr auto objects = std::array<RotatedObject, 2>{
+      RotatedObject{RotatedObjectType::STENSOR, 0},
+      RotatedObject{RotatedObjectType::ST2TOST2, StensorSize}};
+  // rotation matrices of the elements
+  const auto ne = (n + nipe - 1) / nipe;
+  auto rvs = std::vector<real>(9 * ne);
+  for (size_type e = 0; e != ne; ++e) {
+    const auto a = real(e) / real(ne);
+    const auto c = std::cos(a);
+    const auto s = std::sin(a);
+    const real rv[9] = {c, -s, 0, s, c, 0, 0, 0, 1};
+    std::copy(rv, rv + 9, rvs.begin() + 9 * e);
+  }
+  auto elements = std::vector<size_type>(n);
+  for (size_type i = 0; i != n; ++i) {
+    elements[i] = i / nipe;
+  }
+  auto src = std::vector<real>(stride * n);
+  for (size_type i = 0; i != src.size(); ++i) {
+    src[i] = std::sin(real(i));
+  }
+  auto dest1 = std::vector<real>(src.size());
+  auto dest2 = std::vector<real>(src.size());
+  // shared rotation matrix
+  const auto t1 = benchmark(
+      [&] { rotatePointByPoint(dest1.data(), src.data(), rvs.data(), n); },
+      r);
+  const auto t2 = benchmark(
+      [&] {
+        rotateArray<3u>(dest2.data(), src.data(), rvs.data(), true, stride, n,
+                        objects);
+      },
+      r);
+  auto e = real{};
+  for (size_type i = 0; i != src.size(); ++i) {
+    e = std::max(e, std::abs(dest1[i] - dest2[i]));
+  }
+  // one rotation matrix per element
+  const auto t3 = benchmark(
+      [&] {
+        for (size_type i = 0; i != n; ++i) {
+          rotatePointByPoint(dest1.data() + i * stride,
+                             src.data() + i * stride,
+                             rvs.data() + 9 * elements[i], 1);
+        }
+      },
+      r);
+  const auto t4 = benchmark(
+      [&] {
+        rotateArrayByElements<3u>(dest2.data(), src.data(), rvs.data(),
+                                  elements.data(), true, stride, n, objects);
+      },
+      r);
+  for (size_type i = 0; i != src.size(); ++i) {
+    e = std::max(e, std::abs(dest1[i] - dest2[i]));
+  }
+  std::cout << "number of points:                  " << n << '\n'
+            << "shared rotation, point by point:   " << t1 << " s\n"
+            << "shared rotation, kernel:           " << t2 << " s\n"
+            << "speed-up:                          " << t1 / t2 << '\n'
+            << "per element rotation, point by point: " << t3 << " s\n"
+            << "per element rotation, kernel:         " << t4 << " s\n"
+            << "speed-up:                             " << t3 / t4 << '\n'
+            << "maximum difference:                " << e << '\n';
+  return EXIT_SUCCESS;
+}  // end of main
@@ -0,0 +1,199 @@
+/*!
+ * \file   RotationKernelsTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/tensor.hxx"
+#include "TFEL/Math/st2tost2.hxx"
+#include "TFEL/Math/t2tost2.hxx"
+#include "TFEL/Math/t2tot2.hxx"
+#include "MFront/GenericBehaviour/RotationKernels.hxx"
+
+struct RotationKernelsTest final : public tfel::tests::TestCase {
+  RotationKernelsTest()
+      : tfel::tests::TestCase("MFront", "RotationKernelsTest") {
+  }  // end of RotationKernelsTest
+
+  tfel::tests::TestResult execute() override {
+    this->test1<1>();
+    this->test1<2>();
+    this->test1<3>();
+    this->test2<2>();
+    this->test2<3>();
+    return this->result;
+  }  // end of execute()
+ private:
+  //! \brief a simple alias
+  using real = mfront::gb::real;
+  //! \brief a simple alias
+  using size_type = mfront::gb::size_type;
+  //! \brief layout of the values of a point used by the tests
+  template <unsigned short N>
+  static constexpr auto getObjects() {
+    using namespace mfront::gb;
+    constexpr auto ss = tfel::math::StensorDimeToSize<N>::value;
+    constexpr auto ts = tfel::math::TensorDimeToSize<N>::value;
+    return std::array<RotatedObject, 5>{
+        RotatedObject{RotatedObjectType::STENSOR, 0},
+        RotatedObject{RotatedObjectType::SCALAR, ss},
+        RotatedObject{RotatedObjectType::TENSOR, ss + 1},
+        RotatedObject{RotatedObjectType::ST2TOST2, ss + 1 + ts},
+        RotatedObject{RotatedObjectType::T2TOST2, ss + 1 + ts + ss * ss}};
+  }  // end of getObjects
+  //! \return the number of values per point
+  template <unsigned short N>
+  static constexpr size_type getStride() {
+    constexpr auto ss = tfel::math::StensorDimeToSize<N>::value;
+    constexpr auto ts = tfel::math::TensorDimeToSize<N>::value;
+    return ss + 1 + ts + ss * ss + ss * ts;
+  }  // end of getStride
+  //! \return a rotation matrix, stored by rows
+  static std::array<real, 9> getRotationMatrix(const real a) {
+    const auto c = std::cos(a);
+    const auto s = std::sin(a);
+    // rotation around z followed by a rotation around x
+    const auto c2 = std::cos(a / 3);
+    const auto s2 = std::sin(a / 3);
+    return {c, -s, 0,           //
+            s * c2, c * c2, -s2,  //
+            s * s2, c * s2, c2};
+  }  // end of getRotationMatrix
+  //! \brief fill the values of the points
+  static std::vector<real> getValues(const size_type stride,
+                                     const size_type n) {
+    auto values = std::vector<real>(stride * n);
+    for (size_type i = 0; i != values.size(); ++i) {
+      values[i] = std::sin(real(i) * real(0.37)) + real(i % 7) / 10;
+    }
+    return values;
+  }  // end of getValues
+  //! \brief reference implementation based on `tfel::math::change_basis`
+  template <unsigned short N>
+  static void rotate(real* const dest,
+                     const real* const src,
+                     const real* const rv,
+                     const bool b) {
+    using namespace tfel::math;
+    constexpr auto ss = StensorDimeToSize<N>::value;
+    constexpr auto ts = TensorDimeToSize<N>::value;
+    auto m = tmatrix<3u, 3u, real>{};
+    std::copy(rv, rv + 9, m.begin());
+    const auto r = b ? tmatrix<3u, 3u, real>{transpose(m)} : m;
+    auto s = stensor<N, real>{src};
+    auto t = tensor<N, real>{src + ss + 1};
+    auto K = st2tost2<N, real>{};
+    auto D = t2tost2<N, real>{};
+    std::copy(src + ss + 1 + ts, src + ss + 1 + ts + ss * ss, K.begin());
+    std::copy(src + ss + 1 + ts + ss * ss,
+              src + ss + 1 + ts + ss * ss + ss * ts, D.begin());
+    map<stensor<N, real>>(dest) = change_basis(s, r);
+    dest[ss] = src[ss];
+    map<tensor<N, real>>(dest + ss + 1) = change_basis(t, r);
+    const auto Kr = st2tost2<N, real>{change_basis(K, r)};
+    const auto Dr = t2tost2<N, real>{change_basis(D, r)};
+    std::copy(Kr.begin(), Kr.end(), dest + ss + 1 + ts);
+    std::copy(Dr.begin(), Dr.end(), dest + ss + 1 + ts + ss * ss);
+  }  // end of rotate
+  //! \brief check that two arrays are equal
+  void check(const std::vector<real>& v1, const std::vector<real>& v2) {
+    TFEL_TESTS_ASSERT(v1.size() == v2.size());
+    auto e = real{};
+    for (size_type i = 0; i != v1.size(); ++i) {
+      e = std::max(e, std::abs(v1[i] - v2[i]));
+    }
+    TFEL_TESTS_ASSERT(e < 1e-12);
+  }  // end of check
+  //! \brief shared rotation matrix
+  template <unsigned short N>
+  void test1() {
+    constexpr auto stride = getStride<N>();
+    constexpr auto objects = getObjects<N>();
+    // more points than the size of a tile
+    const auto n = 3 * mfront::gb::rotationKernelsTileSize + 5;
+    const auto rv = getRotationMatrix(0.7);
+    const auto src = getValues(stride, n);
+    for (const auto b : {false, true}) {
+      auto ref = std::vector<real>(src.size());
+      for (size_type i = 0; i != n; ++i) {
+        rotate<N>(ref.data() + i * stride, src.data() + i * stride, rv.data(),
+                  b);
+      }
+      auto dest = std::vector<real>(src.size());
+      mfront::gb::rotateArray<N>(dest.data(), src.data(), rv.data(), b,
+                                 stride, n, objects);
+      this->check(dest, ref);
+      // in place rotation
+      auto values = src;
+      mfront::gb::rotateArray<N>(values.data(), values.data(), rv.data(), b,
+                                 stride, n, objects);
+      this->check(values, ref);
+    }
+  }  // end of test1
+  //! \brief one rotation matrix per element
+  template <unsigned short N>
+  void test2() {
+    constexpr auto stride = getStride<N>();
+    constexpr auto objects = getObjects<N>();
+    constexpr size_type ne = 7;
+    const auto n = 2 * mfront::gb::rotationKernelsTileSize + 11;
+    auto rvs = std::vector<real>{};
+    for (size_type e = 0; e != ne; ++e) {
+      const auto rv = getRotationMatrix(0.3 + real(e));
+      rvs.insert(rvs.end(), rv.begin(), rv.end());
+    }
+    // contiguous runs of points plus a few isolated points
+    auto elements = std::vector<size_type>(n);
+    for (size_type i = 0; i != n; ++i) {
+      elements[i] = (i % 13 == 0) ? (i % ne) : ((i / 40) % ne);
+    }
+    const auto src = getValues(stride, n);
+    for (const auto b : {false, true}) {
+      auto ref = std::vector<real>(src.size());
+      for (size_type i = 0; i != n; ++i) {
+        rotate<N>(ref.data() + i * stride, src.data() + i * stride,
+                  rvs.data() + 9 * elements[i], b);
+      }
+      auto dest = std::vector<real>(src.size());
+      mfront::gb::rotateArrayByElements<N>(dest.data(), src.data(),
+                                           rvs.data(), elements.data(), b,
+                                           stride, n, objects);
+      this->check(dest, ref);
+      auto values = src;
+      mfront::gb::rotateArrayByElements<N>(values.data(), values.data(),
+                                           rvs.data(), elements.data(), b,
+                                           stride, n, objects);
+      this->check(values, ref);
+    }
+  }  // end of test2
+};
+
+TFEL_TESTS_GENERATE_PROXY(RotationKernelsTest, "RotationKernelsTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("RotationKernelsTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -68,6 +68,20 @@ namespace mtest {
      * called at each time step, once convergence is reached
      */
     virtual void postExecuteTasks() = 0;
+    /*!
+     * \brief save the history of the algorithm in a stream
+     * \param[in] f: output stream
+     * \note the default implementation does nothing, which is only
+     * valid for algorithms whose history is reset by the
+     * `preExecuteTasks` method.
+     */
+    virtual void writeHistory(const int) const;
+    /*!
+     * \brief restore the history of the algorithm from a stream
+     * \param[in] f: input stream
+     * \note the default implementation does nothing.
+     */
+    virtual void readHistory(const int);
     //! destructor
     virtual ~AccelerationAlgorithm();
   };  // end of struct struct AccelerationAlgorithm
@@ -0,0 +1,194 @@
+/*!
+ * \file   mtest/include/MTest/BinaryReadWrite.hxx
+ * \brief  This file specialises the `tfel::system::BinaryWriter` and
+ * `tfel::system::BinaryReader` classes for the states used by `MTest`.
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_BINARYREADWRITE_HXX
+#define LIB_MTEST_BINARYREADWRITE_HXX
+
+#include <cerrno>
+#include <cstddef>
+#include <type_traits>
+#include <unistd.h>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/System/BinaryRead.hxx"
+#include "TFEL/System/BinaryWrite.hxx"
+#include "TFEL/System/STLContainerBinaryRead.hxx"
+#include "TFEL/System/STLContainerBinaryWrite.hxx"
+#include "MTest/Config.hxx"
+
+namespace mtest {
+
+  // forward declaration
+  struct CurrentState;
+  // forward declaration
+  struct StructureCurrentState;
+  // forward declaration
+  struct StudyCurrentState;
+
+}  // end of namespace mtest
+
+namespace tfel::system {
+
+  /*!
+   * \brief partial specialisation for vectors of arithmetic types. The
+   * values are written in one system call.
+   */
+  template <typename T>
+  struct BinaryWriter<tfel::math::vector<T>> {
+    static_assert(std::is_arithmetic_v<T>, "unsupported type");
+    /*!
+     * \brief write a vector in a stream
+     * \param [in] f : output stream
+     * \param [in] v : vector to be written
+     */
+    static void exe(const int f, const tfel::math::vector<T>& v) {
+      binary_write(f, v.size());
+#if !(defined _WIN32 || defined _WIN64)
+      if (!v.empty()) {
+        systemCall::write(f, v.data(), v.size() * sizeof(T));
+      }
+#else  /* !(defined _WIN32 || defined _WIN64) */
+      for (const auto& e : v) {
+        binary_write(f, e);
+      }
+#endif /* !(defined _WIN32 || defined _WIN64) */
+    }
+  };  // end of BinaryWriter<tfel::math::vector<T>>
+
+  /*!
+   * \brief partial specialisation for vectors of arithmetic types.
+   * \note an exception is thrown if the stream ends before all the
+   * values are read.
+   */
+  template <typename T>
+  struct BinaryReader<tfel::math::vector<T>> {
+    static_assert(std::is_arithmetic_v<T>, "unsupported type");
+    /*!
+     * \brief read a vector in a stream
+     * \param [in]  f : input stream
+     * \param [out] v : vector read
+     */
+    static void exe(const int f, tfel::math::vector<T>& v) {
+      using size_type = typename tfel::math::vector<T>::size_type;
+      const auto s = binary_read<size_type>(f);
+      v.resize(s);
+      auto b = reinterpret_cast<char*>(v.data());
+      auto n = s * sizeof(T);
+      while (n != 0) {
+        const auto r = ::read(f, b, n);
+        if (r == -1) {
+          systemCall::throwSystemError("BinaryReader<vector<T>>::exe",
+                                       errno);
+        }
+        tfel::raise_if(r == 0,
+                       "BinaryReader<vector<T>>::exe: "
+                       "unexpected end of stream");
+        b += r;
+        n -= static_cast<std::size_t>(r);
+      }
+    }
+  };  // end of BinaryReader<tfel::math::vector<T>>
+
+  /*!
+   * \brief specialisation for the state of an integration point.
+   * \note the behaviour and the information collected during the
+   * packaging stage are not saved: they are built by the initialisation
+   * of the study.
+   */
+  template <>
+  struct MTEST_VISIBILITY_EXPORT BinaryWriter<mtest::CurrentState> {
+    /*!
+     * \brief write a state in a stream
+     * \param [in] f : output stream
+     * \param [in] s : state
+     */
+    static void exe(const int, const mtest::CurrentState&);
+  };  // end of BinaryWriter<mtest::CurrentState>
+
+  /*!
+   * \brief specialisation for the state of an integration point.
+   * \note the state must have been initialised by the study. An
+   * exception is thrown if the sizes of the vectors read do not match
+   * the ones of the state.
+   */
+  template <>
+  struct MTEST_VISIBILITY_EXPORT BinaryReader<mtest::CurrentState> {
+    /*!
+     * \brief read a state in a stream
+     * \param [in]  f : input stream
+     * \param [out] s : state
+     */
+    static void exe(const int, mtest::CurrentState&);
+  };  // end of BinaryReader<mtest::CurrentState>
+
+  /*!
+   * \brief specialisation for the state of a structure, including
+   * the states of the models.
+   */
+  template <>
+  struct MTEST_VISIBILITY_EXPORT BinaryWriter<mtest::StructureCurrentState> {
+    /*!
+     * \brief write a state in a stream
+     * \param [in] f : output stream
+     * \param [in] s : state
+     */
+    static void exe(const int, const mtest::StructureCurrentState&);
+  };  // end of BinaryWriter<mtest::StructureCurrentState>
+
+  /*!
+   * \brief specialisation for the state of a structure.
+   * \note the state must have been initialised by the study.
+   */
+  template <>
+  struct MTEST_VISIBILITY_EXPORT BinaryReader<mtest::StructureCurrentState> {
+    /*!
+     * \brief read a state in a stream
+     * \param [in]  f : input stream
+     * \param [out] s : state
+     */
+    static void exe(const int, mtest::StructureCurrentState&);
+  };  // end of BinaryReader<mtest::StructureCurrentState>
+
+  /*!
+   * \brief specialisation for the state of a study.
+   * \note only constant and linear piecewise evolutions can be saved.
+   */
+  template <>
+  struct MTEST_VISIBILITY_EXPORT BinaryWriter<mtest::StudyCurrentState> {
+    /*!
+     * \brief write a state in a stream
+     * \param [in] f : output stream
+     * \param [in] s : state
+     */
+    static void exe(const int, const mtest::StudyCurrentState&);
+  };  // end of BinaryWriter<mtest::StudyCurrentState>
+
+  /*!
+   * \brief specialisation for the state of a study.
+   * \note the state must have been initialised by the study. The
+   * evolutions and the parameters read replace the existing ones.
+   */
+  template <>
+  struct MTEST_VISIBILITY_EXPORT BinaryReader<mtest::StudyCurrentState> {
+    /*!
+     * \brief read a state in a stream
+     * \param [in]  f : input stream
+     * \param [out] s : state
+     */
+    static void exe(const int, mtest::StudyCurrentState&);
+  };  // end of BinaryReader<mtest::StudyCurrentState>
+
+}  // end of namespace tfel::system
+
+#endif /* LIB_MTEST_BINARYREADWRITE_HXX */
@@ -0,0 +1,137 @@
+/*!
+ * \file   BorderedBandedMatrix.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_BORDEREDBANDEDMATRIX_HXX
+#define LIB_MTEST_BORDEREDBANDEDMATRIX_HXX
+
+#include <vector>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a square matrix whose leading block is banded and whose
+   * last row and last column are dense:
+   *
+   * \f[
+   * K = \begin{pmatrix} A & b \\ c & d \end{pmatrix}
+   * \f]
+   *
+   * This is the structure of the stiffness matrix of the `PipeTest`
+   * study: the block \f$A\f$ couples the radial displacements of the
+   * nodes of the one dimensional mesh and the border is associated
+   * with the axial strain.
+   *
+   * The block \f$A\f$ is factorised by a banded LU decomposition with
+   * partial pivoting and the border is eliminated using the Schur
+   * complement \f$s=d-c\,.\,A^{-1}\,.\,b\f$. The cost of the
+   * factorisation and of the resolution is thus linear in the size of
+   * the matrix.
+   */
+  struct MTEST_VISIBILITY_EXPORT BorderedBandedMatrix {
+    //! \brief a simple alias
+    using size_type = tfel::math::matrix<real>::size_type;
+    //! \brief default constructor
+    BorderedBandedMatrix();
+    //! \brief move constructor
+    BorderedBandedMatrix(BorderedBandedMatrix&&);
+    //! \brief copy constructor
+    BorderedBandedMatrix(const BorderedBandedMatrix&);
+    //! \brief move assignement
+    BorderedBandedMatrix& operator=(BorderedBandedMatrix&&);
+    //! \brief standard assignement
+    BorderedBandedMatrix& operator=(const BorderedBandedMatrix&);
+    /*!
+     * \brief resize the matrix. All the values are set to zero.
+     * \param[in] n: size of the matrix, including the border
+     * \param[in] w: half bandwidth of the leading block
+     */
+    void resize(const size_type, const size_type);
+    //! \brief free the memory
+    void clear();
+    //! \brief set all the values to zero
+    void zero();
+    //! \return the size of the matrix, including the border
+    size_type size() const;
+    //! \return the half bandwidth of the leading block
+    size_type getHalfBandWidth() const;
+    /*!
+     * \return a reference to the given component
+     * \param[in] i: row
+     * \param[in] j: column
+     * \note an exception is thrown if the given component lies
+     * outside the band and the border
+     */
+    real& operator()(const size_type, const size_type);
+    /*!
+     * \return the value of the given component, zero outside the band
+     * and the border
+     * \param[in] i: row
+     * \param[in] j: column
+     * \note the values are meaningless once the matrix is factorised.
+     */
+    real operator()(const size_type, const size_type) const;
+    /*!
+     * \brief factorise the matrix
+     * \note an exception is thrown if a null pivot is found.
+     */
+    void factorize();
+    /*!
+     * \brief solve the linear system \f$K\,.\,x=y\f$
+     * \param[in,out] x: on input, the right hand side \f$y\f$. On
+     * output, the solution.
+     * \note the matrix must have been factorised.
+     */
+    void solve(tfel::math::vector<real>&) const;
+    //! \brief destructor
+    ~BorderedBandedMatrix();
+
+   private:
+    //! \return the number of values stored for each row of the band
+    size_type getBandStride() const;
+    //! \return the position of the given component in the band
+    size_type getBandIndex(const size_type, const size_type) const;
+    //! \brief solve \f$A\,.\,x=y\f$ using the factorised band in place
+    void solveBandedBlock(real* const) const;
+    /*!
+     * \brief leading banded block.
+     *
+     * Each row \f$i\f$ stores the columns \f$i-w\f$ to \f$i+2\,w\f$.
+     * The additional \f$w\f$ upper diagonals store the fill-in due to
+     * the row permutations.
+     */
+    std::vector<real> band;
+    //! \brief last column, without the corner
+    std::vector<real> bcolumn;
+    //! \brief last row, without the corner
+    std::vector<real> brow;
+    //! \brief row permutations of the banded LU decomposition
+    std::vector<size_type> pivots;
+    //! \brief size of the matrix, including the border
+    size_type n = 0;
+    //! \brief half bandwidth of the leading block
+    size_type w = 0;
+    //! \brief corner value
+    real corner = 0;
+    //! \brief Schur complement of the leading block
+    real schur = 0;
+    //! \brief boolean stating if the matrix has been factorised
+    bool factorized = false;
+  };  // end of struct BorderedBandedMatrix
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_BORDEREDBANDEDMATRIX_HXX */
@@ -63,6 +63,9 @@ namespace mtest {
      * called at each time step, once convergence is reached
      */
     void postExecuteTasks() override;
+    //
+    void writeHistory(const int) const override;
+    void readHistory(const int) override;
     //! destructor
     ~Crossed2DeltaAccelerationAlgorithm() override;
 
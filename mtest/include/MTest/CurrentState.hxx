@@ -27,8 +27,9 @@
 
 namespace mtest {
 
-  // forward declaration
+  // forward declarations
   struct Behaviour;
+  struct EvolutionBindingTable;
   /*!
    * \brief an helper structure used to store information for the packaging step
    */
@@ -156,6 +157,26 @@ namespace mtest {
       const std::vector<std::string>&,
       const real,
       const real);
+  /*!
+   * \brief compute the material properties at the end of the time step
+   * \param[out] s   : state
+   * \param[in]  mps : evolutions associated with the material properties
+   * \param[in]  t   : time at the beginning of the time step
+   * \param[in]  dt  : time increment
+   */
+  MTEST_VISIBILITY_EXPORT void computeMaterialProperties(
+      CurrentState&, const EvolutionBindingTable&, const real, const real);
+  /*!
+   * \brief compute the external state variables for the current time
+   * step
+   * \param[out] s    : state
+   * \param[in]  esvs : evolutions associated with the external state
+   * variables
+   * \param[in]  t    : time at the beginning of the time step
+   * \param[in]  dt   : time increment
+   */
+  MTEST_VISIBILITY_EXPORT void computeExternalStateVariables(
+      CurrentState&, const EvolutionBindingTable&, const real, const real);
   /*!
    * \brief compute the thermal expansion (orthotropic case)
    */
@@ -101,6 +101,8 @@ namespace mtest {
     bool isConstant() const override;
     void setValue(const real) override;
     void setValue(const real, const real) override;
+    //! \return the values defining the evolution
+    const std::map<real, real>& getValues() const;
     //! \brief destructor
     ~LPIEvolution() override;
 
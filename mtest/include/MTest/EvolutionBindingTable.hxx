@@ -0,0 +1,107 @@
+/*!
+ * \file   mtest/include/MTest/EvolutionBindingTable.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_EVOLUTIONBINDINGTABLE_HXX
+#define LIB_MTEST_EVOLUTIONBINDINGTABLE_HXX
+
+#include <string>
+#include <vector>
+#include <utility>
+#include "TFEL/Math/vector.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief a table associating a list of variables (for instance, the
+   * material properties or the external state variables of a behaviour)
+   * with the evolutions that describe them.
+   *
+   * The evolutions are looked up once, when the table is built, so that
+   * evaluating the variables does not require any search in the
+   * evolution managers. Constant evolutions are only evaluated once
+   * per call and their increments are set to zero.
+   *
+   * \note the table must be built again if the evolution managers used
+   * to build it are modified.
+   */
+  struct MTEST_VISIBILITY_EXPORT EvolutionBindingTable {
+    //! \brief a simple alias
+    using size_type = tfel::math::vector<real>::size_type;
+    //! \brief default constructor
+    EvolutionBindingTable();
+    /*!
+     * \brief constructor
+     * \param[in] n: names of the variables
+     * \param[in] evm: evolution manager
+     * \param[in] c: category of the variables, used in error messages
+     */
+    EvolutionBindingTable(const std::vector<std::string>&,
+                          const EvolutionManager&,
+                          const std::string&);
+    /*!
+     * \brief constructor
+     * \param[in] n: names of the variables
+     * \param[in] evm: evolution manager
+     * \param[in] dvm: evolution manager used if a variable is not
+     * defined in the first one
+     * \param[in] c: category of the variables, used in error messages
+     */
+    EvolutionBindingTable(const std::vector<std::string>&,
+                          const EvolutionManager&,
+                          const EvolutionManager&,
+                          const std::string&);
+    //! \brief move constructor
+    EvolutionBindingTable(EvolutionBindingTable&&);
+    //! \brief copy constructor
+    EvolutionBindingTable(const EvolutionBindingTable&);
+    //! \brief move assignement
+    EvolutionBindingTable& operator=(EvolutionBindingTable&&);
+    //! \brief standard assignement
+    EvolutionBindingTable& operator=(const EvolutionBindingTable&);
+    //! \return the number of variables
+    size_type size() const;
+    /*!
+     * \brief evaluate the variables at the given time
+     * \param[out] v: values
+     * \param[in] t: time
+     */
+    void evaluate(tfel::math::vector<real>&, const real) const;
+    /*!
+     * \brief evaluate the variables at the beginning of the time step
+     * and their increments over the time step
+     * \param[out] v0: values at the beginning of the time step
+     * \param[out] dv: increments over the time step
+     * \param[in] t: time at the beginning of the time step
+     * \param[in] dt: time increment
+     */
+    void evaluate(tfel::math::vector<real>&,
+                  tfel::math::vector<real>&,
+                  const real,
+                  const real) const;
+    //! \brief destructor
+    ~EvolutionBindingTable();
+
+   private:
+    //! \brief number of variables
+    size_type n = 0;
+    //! \brief position and evolution of the constant variables
+    std::vector<std::pair<size_type, EvolutionPtr>> constants;
+    //! \brief position and evolution of the other variables
+    std::vector<std::pair<size_type, EvolutionPtr>> evolutions;
+  };  // end of struct EvolutionBindingTable
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_EVOLUTIONBINDINGTABLE_HXX */
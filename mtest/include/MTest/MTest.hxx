@@ -120,6 +120,7 @@ namespace mtest {
         const real&,
         const real&,
         const StiffnessMatrixType) const override;
+    using Study::computeStiffnessMatrixAndResidual;
     [[nodiscard]] std::pair<bool, real> computeStiffnessMatrixAndResidual(
         StudyCurrentState&,
         tfel::math::matrix<real>&,
@@ -247,6 +248,11 @@ namespace mtest {
    protected:
     //! \brief set the modelling hypothesis to the default one
     void setDefaultModellingHypothesis() override;
+    /*!
+     * \brief treat the events that occurred before the given time
+     * \param[in] t: time
+     */
+    void treatEvents(const real);
     /*!
      * \brief set the position of the Gauss point in the evolution
      * manager
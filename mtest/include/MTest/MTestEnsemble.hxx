@@ -0,0 +1,132 @@
+/*!
+ * \file   mtest/include/MTest/MTestEnsemble.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_MTESTENSEMBLE_HXX
+#define LIB_MTEST_MTESTENSEMBLE_HXX
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <iosfwd>
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
+namespace mtest {
+
+  // forward declaration
+  struct MTestParser;
+
+  /*!
+   * \brief a class running many variants of a single `MTest` input file.
+   *
+   * The input file is read once. A variant is described by the values
+   * of a set of named parameters: each occurence of the pattern `@n@` in
+   * the input file is replaced by the value of the parameter `n` of the
+   * variant, as done by the `--@n@=value` command line option of
+   * `mtest`. Those patterns can be used to define material properties,
+   * external state variables or any evolution used in the definition of
+   * the loading.
+   *
+   * Each variant is handled by its own `MTest` object and uses its own
+   * `StudyCurrentState` and `SolverWorkSpace`, so that the variants can
+   * be run concurrently.
+   *
+   * \note the parameters of the behaviour are global to the library in
+   * which the behaviour is defined. Hence, they must not be modified by
+   * the variants.
+   */
+  struct MTEST_VISIBILITY_EXPORT MTestEnsemble {
+    //! \brief results of an ensemble of tests, stored by columns
+    struct Results {
+      //! \brief names of the columns
+      std::vector<std::string> names;
+      //! \brief values of the columns
+      std::vector<std::vector<real>> columns;
+      /*!
+       * \brief error messages associated with each variant. The
+       * message is empty if the variant succeeded.
+       */
+      std::vector<std::string> failures;
+      //! \return true if all the variants succeeded
+      bool succeeded() const;
+      /*!
+       * \return the column with the given name
+       * \param[in] n: name of the column
+       */
+      const std::vector<real>& getColumn(const std::string&) const;
+    };  // end of struct Results
+    /*!
+     * \brief constructor
+     * \param[in] f: input file
+     * \param[in] ecmds: external commands
+     * \param[in] s: substitutions patterns inserted (those
+     * substitutions are given through command-line options such as
+     * `--@YYY@=XXX`)
+     */
+    MTestEnsemble(const std::string&,
+                  const std::vector<std::string>& = {},
+                  const std::map<std::string, std::string>& = {});
+    /*!
+     * \brief set the number of threads used to run the variants
+     * \param[in] n: number of threads
+     */
+    void setNumberOfThreads(const int);
+    /*!
+     * \brief add a new variant
+     * \param[in] v: values of the parameters of the variant
+     *
+     * \note all the variants must define the same parameters
+     */
+    void addVariant(const std::map<std::string, real>&);
+    /*!
+     * \brief read variants from a text file. The first line of the file
+     * must give the names of the parameters, starting with a `#`
+     * character. Each following line defines a variant.
+     * \param[in] f: file name
+     */
+    void readVariants(const std::string&);
+    //! \return the number of variants
+    std::size_t getNumberOfVariants() const;
+    //! \brief run all the variants
+    Results execute() const;
+    //! \brief destructor
+    ~MTestEnsemble();
+
+   private:
+    //! \brief tokens of the input file
+    std::unique_ptr<MTestParser> parser;
+    //! \brief names of the parameters of the variants
+    std::vector<std::string> names;
+    //! \brief values of those parameters, stored by variants
+    std::vector<std::vector<real>> variants;
+    //! \brief thread pool, if any
+    std::shared_ptr<tfel::system::ThreadPool> pool;
+  };  // end of struct MTestEnsemble
+
+  /*!
+   * \brief write the results of an ensemble of tests as a text file
+   * \param[out] os: output stream
+   * \param[in] r: results
+   */
+  MTEST_VISIBILITY_EXPORT void write(std::ostream&,
+                                     const MTestEnsemble::Results&);
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_MTESTENSEMBLE_HXX */
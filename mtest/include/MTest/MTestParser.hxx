@@ -50,6 +50,29 @@ namespace mtest {
                  const std::string&,
                  const std::vector<std::string>&,
                  const std::map<std::string, std::string>&);
+    /*!
+     * \brief read a file, strip the comments and apply the substitutions
+     * and the external commands, without interpreting the keywords.
+     * \param[in] f:     file name
+     * \param[in] ecmds: external commands
+     * \param[in] s:     substitutions patterns inserted
+     *
+     * \note the tokens read can then be interpreted as many times as
+     * needed by other parsers using the
+     * `execute(MTest&, const MTestParser&)` method.
+     */
+    void readInputFile(const std::string&,
+                       const std::vector<std::string>&,
+                       const std::map<std::string, std::string>&);
+    /*!
+     * \brief interpret the tokens read by another parser
+     * \param[out] t: structure to be filled
+     * \param[in] p: parser
+     * \param[in] s: additional substitutions patterns
+     */
+    void execute(MTest&,
+                 const MTestParser&,
+                 const std::map<std::string, std::string>& = {});
     /*!
      * execute mtest parser on a string
      * \param[in] s : string
@@ -74,6 +97,11 @@ namespace mtest {
      * \param[out] t : structure to be filled
      */
     void execute(MTest& t);
+    /*!
+     * \brief replace the tokens matching a substitution pattern
+     * \param[in] s: substitutions patterns
+     */
+    void applySubstitutions(const std::map<std::string, std::string>&);
     /*!
      * register the call backs associated with each command
      */
@@ -22,12 +22,15 @@
 #include "MTest/Types.hxx"
 #include "MTest/SolverOptions.hxx"
 #include "MTest/PipeMesh.hxx"
+#include "MTest/PipeElementContribution.hxx"
 
 namespace mtest {
 
   // forward declaration
   struct Behaviour;
   // forward declaration
+  struct BehaviourWorkSpace;
+  // forward declaration
   struct StructureCurrentState;
 
   /*!
@@ -88,9 +91,10 @@ namespace mtest {
      *     - increase the time step if the integration was successfull
      *     - decrease the time step if the integration failed or if the
      *       results were not reliable (time step too large).
-     * \param[out] k:   stiffness matrix
-     * \param[out] r:   residual
+     * \param[out] c:   contribution of the element to the stiffness
+     * matrix and to the residual
      * \param[out] scs: structure current state
+     * \param[out] bwk: behaviour workspace
      * \param[in]  u1:  current displacement estimation
      * \param[in]  m:   pipe mesh
      * \param[in]  b:   behaviour
@@ -99,9 +103,9 @@ namespace mtest {
      * \param[in]  i:   element number
      */
     static std::pair<bool, real> updateStiffnessMatrixAndInnerForces(
-        tfel::math::matrix<real>&,
-        tfel::math::vector<real>&,
+        PipeElementContribution&,
         StructureCurrentState&,
+        BehaviourWorkSpace&,
         const Behaviour&,
         const tfel::math::vector<real>&,
         const PipeMesh&,
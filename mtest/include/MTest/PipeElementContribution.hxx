@@ -0,0 +1,142 @@
+/*!
+ * \file   PipeElementContribution.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifndef LIB_MTEST_PIPEELEMENTCONTRIBUTION_HXX
+#define LIB_MTEST_PIPEELEMENTCONTRIBUTION_HXX
+
+#include <vector>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "MTest/Config.hxx"
+#include "MTest/Types.hxx"
+
+namespace mtest {
+
+  // forward declaration
+  struct BorderedBandedMatrix;
+
+  /*!
+   * \brief contribution of an element of a pipe to the residual and to
+   * the stiffness matrix.
+   *
+   * The contribution is stored in local arrays, but is accessed through
+   * the global numbering of the unknowns, i.e. the radial displacements
+   * of the nodes of the element and the axial strain. Those local
+   * arrays allow the elements to be integrated concurrently. The
+   * contributions are then assembled in a fixed order, so that the
+   * results do not depend on the number of threads used.
+   */
+  struct MTEST_VISIBILITY_EXPORT PipeElementContribution {
+    //! \brief a simple alias
+    using size_type = tfel::math::vector<real>::size_type;
+    //! \brief numbering of the unknowns of the element
+    struct Numbering {
+      /*!
+       * \return the local index associated with the given global index
+       * \param[in] i: global index
+       */
+      size_type getLocalIndex(const size_type i) const {
+        return (i == this->axial) ? this->nnodes : i - this->first;
+      }  // end of getLocalIndex
+      //! \brief global index of the first node of the element
+      size_type first = 0;
+      //! \brief number of nodes of the element
+      size_type nnodes = 0;
+      //! \brief global index of the axial strain
+      size_type axial = 0;
+    };
+    //! \brief local stiffness matrix, accessed through global indices
+    struct StiffnessMatrix {
+      /*!
+       * \return the component associated with the given unknowns
+       * \param[in] i: global index of the first unknown
+       * \param[in] j: global index of the second unknown
+       */
+      real& operator()(const size_type i, const size_type j) {
+        const auto n = this->numbering.nnodes + 1;
+        return this->values[this->numbering.getLocalIndex(i) * n +
+                            this->numbering.getLocalIndex(j)];
+      }  // end of operator()
+
+     private:
+      friend struct PipeElementContribution;
+      //! \brief numbering of the unknowns
+      Numbering numbering;
+      //! \brief values
+      std::vector<real> values;
+    };
+    //! \brief local residual, accessed through global indices
+    struct Residual {
+      /*!
+       * \return the component associated with the given unknown
+       * \param[in] i: global index of the unknown
+       */
+      real& operator[](const size_type i) {
+        return this->values[this->numbering.getLocalIndex(i)];
+      }  // end of operator[]
+
+     private:
+      friend struct PipeElementContribution;
+      //! \brief numbering of the unknowns
+      Numbering numbering;
+      //! \brief values
+      std::vector<real> values;
+    };
+    /*!
+     * \brief set the unknowns associated with the element and reset the
+     * contribution.
+     * \param[in] f: global index of the first node of the element
+     * \param[in] nn: number of nodes of the element
+     * \param[in] a: global index of the axial strain
+     */
+    void setElement(const size_type, const size_type, const size_type);
+    /*!
+     * \brief add the contribution to the global residual and, if
+     * requested, to the global stiffness matrix.
+     * \param[in,out] gk: global stiffness matrix
+     * \param[in,out] gr: global residual
+     * \param[in] bk: if true, the stiffness matrix is updated
+     */
+    void assemble(tfel::math::matrix<real>&,
+                  tfel::math::vector<real>&,
+                  const bool) const;
+    /*!
+     * \brief add the contribution to the global residual and, if
+     * requested, to the global stiffness matrix.
+     * \param[in,out] gk: global stiffness matrix
+     * \param[in,out] gr: global residual
+     * \param[in] bk: if true, the stiffness matrix is updated
+     */
+    void assemble(BorderedBandedMatrix&,
+                  tfel::math::vector<real>&,
+                  const bool) const;
+    //! \brief stiffness matrix
+    StiffnessMatrix k;
+    //! \brief residual
+    Residual r;
+
+   private:
+    /*!
+     * \brief add the contribution to the global residual and, if
+     * requested, to the global stiffness matrix.
+     * \param[in,out] gk: global stiffness matrix
+     * \param[in,out] gr: global residual
+     * \param[in] bk: if true, the stiffness matrix is updated
+     */
+    template <typename MatrixType>
+    void assemble2(MatrixType&, tfel::math::vector<real>&, const bool) const;
+  };  // end of struct PipeElementContribution
+
+}  // end of namespace mtest
+
+#endif /* LIB_MTEST_PIPEELEMENTCONTRIBUTION_HXX */
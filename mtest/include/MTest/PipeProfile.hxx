@@ -17,6 +17,11 @@
 #include <iosfwd>
 #include "MTest/PipeProfile.hxx"
 
+namespace tfel::utilities {
+  // forward declaration
+  struct BinaryColumnarFileWriter;
+}  // end of namespace tfel::utilities
+
 namespace mtest {
 
   // forward declaration
@@ -33,6 +38,13 @@ namespace mtest {
      * \param[in]  s:  current state
      */
     virtual void report(std::ostream&, const CurrentState&) const = 0;
+    /*!
+     * write the requested value(s) in a binary columnar file
+     * \param[out] w: writer
+     * \param[in]  s: current state
+     */
+    virtual void report(tfel::utilities::BinaryColumnarFileWriter&,
+                        const CurrentState&) const = 0;
     //! destructor
     virtual ~PipeProfile();
   };
@@ -54,6 +66,13 @@ namespace mtest {
      * \param[in]  s:  current state
      */
     void report(std::ostream&, const CurrentState&) const override;
+    /*!
+     * write the requested value(s) in a binary columnar file
+     * \param[out] w: writer
+     * \param[in]  s: current state
+     */
+    void report(tfel::utilities::BinaryColumnarFileWriter&,
+                const CurrentState&) const override;
     //! destructor
     ~PipeStressProfile() override;
 
@@ -79,6 +98,13 @@ namespace mtest {
      * \param[in]  s:  current state
      */
     void report(std::ostream&, const CurrentState&) const override;
+    /*!
+     * write the requested value(s) in a binary columnar file
+     * \param[out] w: writer
+     * \param[in]  s: current state
+     */
+    void report(tfel::utilities::BinaryColumnarFileWriter&,
+                const CurrentState&) const override;
     //! destructor
     ~PipeStrainProfile() override;
 
@@ -104,6 +130,13 @@ namespace mtest {
      * \param[in]  s:  current state
      */
     void report(std::ostream&, const CurrentState&) const override;
+    /*!
+     * write the requested value(s) in a binary columnar file
+     * \param[out] w: writer
+     * \param[in]  s: current state
+     */
+    void report(tfel::utilities::BinaryColumnarFileWriter&,
+                const CurrentState&) const override;
     //! destructor
     ~PipeInternalStateVariableProfile() override;
 
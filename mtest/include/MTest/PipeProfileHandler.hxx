@@ -16,8 +16,14 @@
 
 #include <iosfwd>
 #include <memory>
+#include <string>
 #include <vector>
 
+namespace tfel::utilities {
+  // forward declaration
+  struct BinaryColumnarFileWriter;
+}  // end of namespace tfel::utilities
+
 namespace mtest {
 
   // forward declaration
@@ -33,7 +39,14 @@ namespace mtest {
     PipeProfileHandler(const PipeProfileHandler&);
     PipeProfileHandler& operator=(PipeProfileHandler&&);
     PipeProfileHandler& operator=(const PipeProfileHandler&);
+    //! \brief file name
+    std::string file;
+    //! \brief names of the profiles
+    std::vector<std::string> names;
+    //! \brief output stream, if the profiles are written in a text file
     std::shared_ptr<std::ostream> out;
+    //! \brief writer, if the profiles are written in a binary file
+    std::shared_ptr<tfel::utilities::BinaryColumnarFileWriter> bout;
     std::vector<std::shared_ptr<PipeProfile>> profiles;
   };
 
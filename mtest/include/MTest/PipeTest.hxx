@@ -29,6 +29,11 @@ namespace tfel::utilities {
   struct TextData;
 }  // namespace tfel::utilities
 
+namespace tfel::system {
+  // forward declaration
+  struct ThreadPool;
+}  // namespace tfel::system
+
 namespace mtest {
 
   // forward declarations
@@ -104,6 +109,10 @@ namespace mtest {
       std::shared_ptr<Behaviour> model;
       //! \brief default material properties
       std::shared_ptr<EvolutionManager> default_material_properties;
+      //! \brief evolutions associated with the material properties
+      EvolutionBindingTable material_properties;
+      //! \brief evolutions associated with the external state variables
+      EvolutionBindingTable external_state_variables;
     };  // end of OxidationModel
     //! \brief default constructor
     PipeTest();
@@ -149,6 +158,14 @@ namespace mtest {
      * \param[in] n: number of elements
      */
     virtual void setNumberOfElements(const int);
+    /*!
+     * \brief set the number of threads used to integrate the behaviour
+     * over the elements.
+     * \param[in] n: number of threads
+     *
+     * \note the results do not depend on the number of threads.
+     */
+    virtual void setNumberOfThreads(const int);
     /*!
      * \brief set the element type
      * \param[in] e: element type
@@ -259,6 +276,12 @@ namespace mtest {
         const real,
         const real,
         const StiffnessMatrixType) const override;
+    [[nodiscard]] std::pair<bool, real> computeStiffnessMatrixAndResidual(
+        StudyCurrentState&,
+        SolverWorkSpace&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const override;
     [[nodiscard]] real getErrorNorm(
         const tfel::math::vector<real>&) const override;
     [[nodiscard]] bool checkConvergence(StudyCurrentState&,
@@ -468,6 +491,20 @@ namespace mtest {
     ~PipeTest() override;
 
    protected:
+    /*!
+     * \brief print the outputs in a binary columnar file
+     * \param[in] t: time
+     * \param[in] s: current state
+     */
+    virtual void printBinaryOutput(const real,
+                                   const StudyCurrentState&) const;
+    /*!
+     * \brief open the file associated with a profile, using the output
+     * file format
+     * \param[in,out] ph: profile handler
+     */
+    virtual void openProfile(PipeProfileHandler&) const;
+    void flushOutputFiles() const override;
     /*!
      * \brief check that the behaviour is consistent with the
      * modelling hypothesis
@@ -490,12 +527,31 @@ namespace mtest {
      */
     void setGaussPointPositionForEvolutionsEvaluation(
         const CurrentState&) const override;
+    /*!
+     * \brief assemble the stiffness matrix and the residual
+     * \tparam MatrixType: type of the stiffness matrix, either
+     * `tfel::math::matrix<real>` or `BorderedBandedMatrix`
+     * \param[out] s: current structure state
+     * \param[out] k:   stiffness matrix
+     * \param[out] r:   residual
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     */
+    template <typename MatrixType>
+    std::pair<bool, real> assembleStiffnessMatrixAndResidual(
+        StudyCurrentState&,
+        MatrixType&,
+        tfel::math::vector<real>&,
+        const real,
+        const real,
+        const StiffnessMatrixType) const;
     //! \brief description of an additional
     struct AdditionalOutput {
       //! \brief description
       std::string d;
       //! \brief functor
-      std::function<void(std::ostream&, const StudyCurrentState&)> f;
+      std::function<real(const StudyCurrentState&)> f;
     };
     //! \brief additional outputs
     std::vector<AdditionalOutput> aoutputs;
@@ -511,6 +567,8 @@ namespace mtest {
     OxidationModel inner_boundary_oxidation_model;
     //! \brief oxidation model at the outer boundary
     OxidationModel outer_boundary_oxidation_model;
+    //! \brief pool of threads used to integrate the behaviour
+    std::shared_ptr<tfel::system::ThreadPool> pool;
     //! \brief evolution defining the oxidation status
     std::shared_ptr<OxidationStatusEvolution> oxidation_status_evolution;
     //! \brief user defined gas equation of state
@@ -28,6 +28,11 @@
 #include "MTest/Scheme.hxx"
 #include "MTest/SolverOptions.hxx"
 
+namespace tfel::utilities {
+  // forward declaration
+  struct BinaryColumnarFileWriter;
+}  // end of namespace tfel::utilities
+
 namespace mtest {
 
   // forward declaration
@@ -39,6 +44,15 @@ namespace mtest {
       USERDEFINEDTIMES,
       EVERYPERIOD
     };  // end of enum OutputFrequency
+    //! \brief format of the output files
+    enum OutputFileFormat {
+      //! \brief text file
+      TEXTFILEFORMAT,
+      //! \brief binary columnar file, values stored in double precision
+      BINARYFILEFORMAT,
+      //! \brief binary columnar file, values stored in single precision
+      SINGLEPRECISIONBINARYFILEFORMAT
+    };  // end of enum OutputFileFormat
     //! a simple alias
     using ModellingHypothesis = tfel::material::ModellingHypothesis;
     //! a simple alias
@@ -68,6 +82,8 @@ namespace mtest {
      * \param[in] t : times
      */
     virtual void setTimes(const std::vector<real>&);
+    //! \return the times
+    const std::vector<real>& getTimes() const;
     /*!
      * \brief set the output file
      * \param[in] f : file name
@@ -80,6 +96,11 @@ namespace mtest {
      * \param[in] p : precision
      */
     virtual void setOutputFilePrecision(const unsigned int);
+    /*!
+     * \brief set the output file format
+     * \param[in] f: format
+     */
+    virtual void setOutputFileFormat(const OutputFileFormat);
     /*!
      * \brief set the residual file
      * \param[in] f : file name
@@ -224,6 +245,23 @@ namespace mtest {
      * \param[in] p : period
      */
     virtual void setCastemAccelerationPeriod(const int);
+    /*!
+     * \brief set the number of time steps between two checkpoints
+     * \param[in] n: number of time steps
+     */
+    virtual void setCheckpointFrequency(const unsigned int);
+    /*!
+     * \brief set the checkpoint file
+     * \param[in] f: file name
+     */
+    virtual void setCheckpointFileName(const std::string&);
+    //! \return true if the checkpoint file name has been defined
+    virtual bool isCheckpointFileNameDefined() const;
+    /*!
+     * \brief set the checkpoint file from which the study is restarted
+     * \param[in] f: file name
+     */
+    virtual void setRestartFileName(const std::string&);
     /*!
      * \brief close and reopen the output files
      */
@@ -249,6 +287,42 @@ namespace mtest {
      * \param[in] v : variable names
      */
     void declareVariables(const std::vector<std::string>&, const bool);
+    /*!
+     * \return a writer for a binary columnar file, using the output file
+     * format selected by the user
+     * \param[in] f: file name
+     * \param[in] n: names of the columns
+     */
+    std::shared_ptr<tfel::utilities::BinaryColumnarFileWriter>
+    makeBinaryColumnarFileWriter(const std::string&,
+                                 const std::vector<std::string>&) const;
+    /*!
+     * \brief open the output file as a binary columnar file. This method
+     * must be called by the derived class, at the end of the
+     * initialisation, if the output file format is not
+     * `TEXTFILEFORMAT`.
+     * \param[in] n: names of the columns
+     */
+    void openBinaryOutputFile(const std::vector<std::string>&);
+    //! \return true if the output files are binary columnar files
+    bool useBinaryOutputFiles() const;
+    //! \brief flush the output files
+    virtual void flushOutputFiles() const;
+    /*!
+     * \brief save the state of the study in the checkpoint file, if
+     * required by the checkpoint frequency.
+     * \param[in] i: index, in the list of times, of the current time
+     * \param[in] s: current state
+     */
+    void writeCheckpoint(const std::size_t, const StudyCurrentState&) const;
+    /*!
+     * \brief restore the state of the study from the restart file, if
+     * any.
+     * \return the index, in the list of times, of the time at which the
+     * computation is restarted, or 0 if no restart file has been given.
+     * \param[in,out] s: current state, initialised by the study
+     */
+    std::size_t readCheckpoint(StudyCurrentState&);
     //! declared variable names
     std::vector<std::string> vnames;
     //! initilisation stage
@@ -272,6 +346,13 @@ namespace mtest {
     std::string output;
     //! output file
     mutable std::ofstream out;
+    //! \brief output file, if a binary output file format is used
+    mutable std::shared_ptr<tfel::utilities::BinaryColumnarFileWriter>
+        boutput;
+    //! \brief names of the columns of the binary output file
+    std::vector<std::string> boutput_columns;
+    //! \brief output file format
+    OutputFileFormat output_file_format = TEXTFILEFORMAT;
     //! residual file name
     std::string residualFileName;
     //! xml file name
@@ -279,6 +360,12 @@ namespace mtest {
     //! file where residuals evolutions as a function of the iteration
     //! number are saved
     mutable std::ofstream residual;
+    //! \brief checkpoint file name
+    std::string checkpoint_file;
+    //! \brief file from which the study is restarted
+    std::string restart_file;
+    //! \brief number of time steps between two checkpoints
+    unsigned int checkpoint_frequency = 0;
     //! output frequency
     OutputFrequency output_frequency = USERDEFINEDTIMES;
     //! output file precision
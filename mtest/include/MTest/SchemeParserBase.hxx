@@ -69,6 +69,21 @@ namespace mtest {
      * \param[in,out] p : position in the input file
      */
     virtual void handleOutputFrequency(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@OutputFileFormat` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleOutputFileFormat(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@Checkpoint` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleCheckpoint(SchemeBase&, tokens_iterator&);
+    /*!
+     * \brief handle the `@CheckpointFile` keyword
+     * \param[in,out] p : position in the input file
+     */
+    virtual void handleCheckpointFile(SchemeBase&, tokens_iterator&);
     /*!
      * \brief handle the `@Description` keyword
      * \param[in,out] p : position in the input file
@@ -19,6 +19,7 @@
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
 #include "MTest/SchemeBase.hxx"
+#include "MTest/EvolutionBindingTable.hxx"
 
 namespace mtest {
 
@@ -173,12 +174,25 @@ namespace mtest {
     virtual void setBehaviour(const std::shared_ptr<Behaviour>&);
     //! \return the default stiffness matrix type
     StiffnessMatrixType getDefaultStiffnessMatrixType() const override;
+    /*!
+     * \brief build the tables associating the material properties and
+     * the external state variables of the behaviour with their
+     * evolutions.
+     *
+     * \note this method is called by `completeInitialisation` and must
+     * be called again if the evolutions are modified afterwards.
+     */
+    void bindEvolutions();
     //! \brief list of internal variable names, including their suffixes
     std::vector<std::string> ivfullnames;
     //! \brief the mechanical behaviour
     std::shared_ptr<Behaviour> b;
     //! \brief default values for material properties as given by the behaviour
     std::shared_ptr<EvolutionManager> dmpv;
+    //! \brief evolutions associated with the material properties
+    EvolutionBindingTable mpevolutions;
+    //! \brief evolutions associated with the external state variables
+    EvolutionBindingTable esvevolutions;
     // \brief inital values of the internal state variables
     std::vector<real> iv_t0;
     //! \brief handle the computation of thermal expansion
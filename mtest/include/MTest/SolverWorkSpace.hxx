@@ -20,6 +20,7 @@
 
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
+#include "MTest/BorderedBandedMatrix.hxx"
 
 namespace mtest {
 
@@ -29,8 +30,19 @@ namespace mtest {
   struct SolverWorkSpace {
     //! a simple alias
     using size_type = tfel::math::matrix<real>::size_type;
+    //! \brief storage of the stiffness matrix
+    enum StiffnessMatrixStorage {
+      //! \brief the dense matrix `K` is used
+      DENSE,
+      //! \brief the bordered banded matrix `Kb` is used
+      BORDEREDBANDED
+    };
+    //! \brief storage of the stiffness matrix, chosen by the study
+    StiffnessMatrixStorage storage = DENSE;
     //! stiffness matrix
     tfel::math::matrix<real> K;
+    //! bordered banded stiffness matrix
+    BorderedBandedMatrix Kb;
     // residual
     tfel::math::vector<real> r;
     // unknowns correction
@@ -47,6 +59,25 @@ namespace mtest {
    */
   MTEST_VISIBILITY_EXPORT void initialize(SolverWorkSpace&,
                                           const SolverWorkSpace::size_type);
+  /*!
+   * \brief factorise the stiffness matrix and solve the linear system
+   * in place.
+   *
+   * The unknowns correction `du` must contain the right hand side on
+   * input.
+   *
+   * \param[in,out] wk: workspace
+   */
+  MTEST_VISIBILITY_EXPORT void solveLinearSystem(SolverWorkSpace&);
+  /*!
+   * \brief solve the linear system using the factorisation computed by
+   * the last call to `solveLinearSystem`.
+   * \param[in,out] wk: workspace
+   * \param[in,out] x: on input, the right hand side. On output, the
+   * solution.
+   */
+  MTEST_VISIBILITY_EXPORT void backSubstitute(SolverWorkSpace&,
+                                              tfel::math::vector<real>&);
 
 }  // namespace mtest
 
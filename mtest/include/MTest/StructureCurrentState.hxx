@@ -15,12 +15,22 @@
 #define LIB_MTEST_STRUCTURECURRENTSTATE_HXX
 
 #include <memory>
+#include <cstddef>
 #include <vector>
 #include "TFEL/Math/vector.hxx"
 #include "TFEL/Material/ModellingHypothesis.hxx"
 #include "MTest/Config.hxx"
 #include "MTest/Types.hxx"
 
+namespace tfel::system {
+  // forward declaration
+  template <typename>
+  struct BinaryWriter;
+  // forward declaration
+  template <typename>
+  struct BinaryReader;
+}  // end of namespace tfel::system
+
 namespace mtest {
 
   // forward declaration
@@ -69,8 +79,20 @@ namespace mtest {
      * \param[in] mh : modelling hypothesis
      */
     void setModellingHypothesis(const Hypothesis);
-    //! \return the behaviour workspace associated to the current thread.
+    /*!
+     * \return the behaviour workspace associated to the main thread.
+     * This is equivalent to `getBehaviourWorkSpace(0)`.
+     */
     BehaviourWorkSpace &getBehaviourWorkSpace() const;
+    /*!
+     * \return the behaviour workspace associated with the given thread.
+     * \param[in] i: thread index
+     *
+     * \note the workspaces are allocated on demand. This method is thus
+     * not thread safe: the workspaces must be retrieved before the
+     * threads are launched.
+     */
+    BehaviourWorkSpace &getBehaviourWorkSpace(const std::size_t) const;
     //! \return the behaviour associated to the structure
     const Behaviour &getBehaviour() const;
     /*!
@@ -104,6 +126,8 @@ namespace mtest {
     tfel::math::vector<CurrentState> istates;
 
    private:
+    friend struct tfel::system::BinaryWriter<StructureCurrentState>;
+    friend struct tfel::system::BinaryReader<StructureCurrentState>;
     //! \brief behaviour
     std::shared_ptr<Behaviour> b;
     //! \brief modelling hypothesis
@@ -112,6 +136,11 @@ namespace mtest {
     mutable std::vector<std::shared_ptr<BehaviourWorkSpace>> bwks;
     //! \brief model states
     std::map<const Model *, std::shared_ptr<CurrentState>> model_states;
+    /*!
+     * \brief models, in the order in which their states have been
+     * created. This order is used to save and restore the model states.
+     */
+    std::vector<const Model *> models;
     //! \brief model workspace
     std::map<const Model *, std::shared_ptr<BehaviourWorkSpace>> model_wks;
   };
@@ -126,6 +126,30 @@ namespace mtest {
                                       const real,
                                       const real,
                                       const StiffnessMatrixType) const = 0;
+    /*!
+     * \brief compute the stiffness matrix and the residual in the
+     * storage selected by the `initializeWorkSpace` method.
+     *
+     * The default implementation assembles the dense stiffness matrix
+     * `K` of the workspace.
+     *
+     * \return a pair containing:
+     * - a boolean syaing if the behaviour integration shall be
+     *   performed
+     * - a scaling factor that can be used to modify the time step.
+     * \param[out] s: current structure state
+     * \param[out] wk:  solver workspace
+     * \param[in]  t:   current time
+     * \param[in]  dt:  time increment
+     * \param[in]  smt: type of tangent operator
+     * \note the memory has already been allocated
+     */
+    [[nodiscard]] virtual std::pair<bool, real>
+    computeStiffnessMatrixAndResidual(StudyCurrentState&,
+                                      SolverWorkSpace&,
+                                      const real,
+                                      const real,
+                                      const StiffnessMatrixType) const;
     /*!
      * \param[in] : du unknows increment difference between two iterations
      */
@@ -24,6 +24,15 @@
 #include "MTest/Types.hxx"
 #include "MTest/StudyParameter.hxx"
 
+namespace tfel::system {
+  // forward declaration
+  template <typename>
+  struct BinaryWriter;
+  // forward declaration
+  template <typename>
+  struct BinaryReader;
+}  // end of namespace tfel::system
+
 namespace mtest {
 
   // forward declaration
@@ -187,6 +196,8 @@ namespace mtest {
     real dt_1 = real{};
 
    protected:
+    friend struct tfel::system::BinaryWriter<StudyCurrentState>;
+    friend struct tfel::system::BinaryReader<StudyCurrentState>;
     /*!
      * \brief throw an exception stating that no parameter with the
      * given name has been found
@@ -29,6 +29,12 @@ namespace mtest {
     return res;
   }
 
+  void AccelerationAlgorithm::writeHistory(const int) const {
+  }  // end of writeHistory
+
+  void AccelerationAlgorithm::readHistory(const int) {
+  }  // end of readHistory
+
   AccelerationAlgorithm::~AccelerationAlgorithm() = default;
 
 }  // end of namespace mtest
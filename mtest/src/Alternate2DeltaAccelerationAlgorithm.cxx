@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/Alternate2DeltaAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -132,4 +133,32 @@ namespace mtest {
   Alternate2DeltaAccelerationAlgorithm::
       ~Alternate2DeltaAccelerationAlgorithm() = default;
 
+  void Alternate2DeltaAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->asa_u0);
+    binary_write(f, this->asa_u1);
+    binary_write(f, this->asa_du0);
+    binary_write(f, this->asa_du1);
+    binary_write(f, this->asa_d2u);
+    binary_write(f, this->asa_r0);
+    binary_write(f, this->asa_r1);
+    binary_write(f, this->asa_dr0);
+    binary_write(f, this->asa_dr1);
+    binary_write(f, this->asa_d2r);
+  }  // end of writeHistory
+
+  void Alternate2DeltaAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->asa_u0);
+    binary_read(f, this->asa_u1);
+    binary_read(f, this->asa_du0);
+    binary_read(f, this->asa_du1);
+    binary_read(f, this->asa_d2u);
+    binary_read(f, this->asa_r0);
+    binary_read(f, this->asa_r1);
+    binary_read(f, this->asa_dr0);
+    binary_read(f, this->asa_dr1);
+    binary_read(f, this->asa_d2r);
+  }  // end of readHistory
+
 }  // end of namespace mtest
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/AlternateDelta2AccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -117,4 +118,32 @@ namespace mtest {
   AlternateDelta2AccelerationAlgorithm::
       ~AlternateDelta2AccelerationAlgorithm() = default;
 
+  void AlternateDelta2AccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->asa_u0);
+    binary_write(f, this->asa_u1);
+    binary_write(f, this->asa_du0);
+    binary_write(f, this->asa_du1);
+    binary_write(f, this->asa_d2u);
+    binary_write(f, this->asa_r0);
+    binary_write(f, this->asa_r1);
+    binary_write(f, this->asa_dr0);
+    binary_write(f, this->asa_dr1);
+    binary_write(f, this->asa_d2r);
+  }  // end of writeHistory
+
+  void AlternateDelta2AccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->asa_u0);
+    binary_read(f, this->asa_u1);
+    binary_read(f, this->asa_du0);
+    binary_read(f, this->asa_du1);
+    binary_read(f, this->asa_d2u);
+    binary_read(f, this->asa_r0);
+    binary_read(f, this->asa_r1);
+    binary_read(f, this->asa_dr0);
+    binary_read(f, this->asa_dr1);
+    binary_read(f, this->asa_d2r);
+  }  // end of readHistory
+
 }  // end of namespace mtest
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/AlternateSecantAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -93,4 +94,24 @@ namespace mtest {
   AlternateSecantAccelerationAlgorithm::
       ~AlternateSecantAccelerationAlgorithm() = default;
 
+  void AlternateSecantAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->asa_u0);
+    binary_write(f, this->asa_u1);
+    binary_write(f, this->asa_du);
+    binary_write(f, this->asa_r0);
+    binary_write(f, this->asa_r1);
+    binary_write(f, this->asa_dr);
+  }  // end of writeHistory
+
+  void AlternateSecantAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->asa_u0);
+    binary_read(f, this->asa_u1);
+    binary_read(f, this->asa_du);
+    binary_read(f, this->asa_r0);
+    binary_read(f, this->asa_r1);
+    binary_read(f, this->asa_dr);
+  }  // end of readHistory
+
 }  // end of namespace mtest
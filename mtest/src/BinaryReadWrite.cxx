@@ -0,0 +1,264 @@
+/*!
+ * \file   mtest/src/BinaryReadWrite.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+#include "TFEL/Raise.hxx"
+#include "MTest/Behaviour.hxx"
+#include "MTest/Evolution.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/StructureCurrentState.hxx"
+#include "MTest/StudyCurrentState.hxx"
+#include "MTest/BinaryReadWrite.hxx"
+
+namespace tfel::system {
+
+  /*!
+   * \brief read a vector whose size is known
+   * \param[in] f: input stream
+   * \param[in,out] v: vector
+   * \param[in] n: name of the vector, used in error messages
+   */
+  static void binary_read_sized(const int f,
+                                tfel::math::vector<mtest::real>& v,
+                                const char* const n) {
+    const auto s = v.size();
+    binary_read(f, v);
+    raise_if(v.size() != s,
+             "binary_read: the size of the variable '" + std::string(n) +
+                 "' read does not match the size of the current state "
+                 "(read " +
+                 std::to_string(v.size()) + ", expected " +
+                 std::to_string(s) + ")");
+  }  // end of binary_read_sized
+
+  //! \brief type of the parameters of a study
+  enum struct StudyParameterType : unsigned short { BOOL, REAL, STRING };
+
+  //! \brief type of the evolutions of a study
+  enum struct StudyEvolutionType : unsigned short { CONSTANT, LPI };
+
+  void BinaryWriter<mtest::CurrentState>::exe(const int f,
+                                              const mtest::CurrentState& s) {
+    binary_write(f, s.s_1);
+    binary_write(f, s.s0);
+    binary_write(f, s.s1);
+    binary_write(f, s.e0);
+    binary_write(f, s.e1);
+    binary_write(f, s.e_th0);
+    binary_write(f, s.e_th1);
+    binary_write(f, s.mprops1);
+    binary_write(f, s.se0);
+    binary_write(f, s.se1);
+    binary_write(f, s.de0);
+    binary_write(f, s.de1);
+    binary_write(f, s.iv_1);
+    binary_write(f, s.iv0);
+    binary_write(f, s.iv1);
+    binary_write(f, s.esv0);
+    binary_write(f, s.desv);
+    binary_write(f, s.isRmDefined);
+    binary_write(f, s.r);
+    binary_write(f, s.position);
+    binary_write(f, s.Tref);
+  }  // end of BinaryWriter<mtest::CurrentState>::exe
+
+  void BinaryReader<mtest::CurrentState>::exe(const int f,
+                                              mtest::CurrentState& s) {
+    binary_read_sized(f, s.s_1, "s_1");
+    binary_read_sized(f, s.s0, "s0");
+    binary_read_sized(f, s.s1, "s1");
+    binary_read_sized(f, s.e0, "e0");
+    binary_read_sized(f, s.e1, "e1");
+    binary_read_sized(f, s.e_th0, "e_th0");
+    binary_read_sized(f, s.e_th1, "e_th1");
+    binary_read_sized(f, s.mprops1, "mprops1");
+    binary_read(f, s.se0);
+    binary_read(f, s.se1);
+    binary_read(f, s.de0);
+    binary_read(f, s.de1);
+    binary_read_sized(f, s.iv_1, "iv_1");
+    binary_read_sized(f, s.iv0, "iv0");
+    binary_read_sized(f, s.iv1, "iv1");
+    binary_read_sized(f, s.esv0, "esv0");
+    binary_read_sized(f, s.desv, "desv");
+    binary_read(f, s.isRmDefined);
+    binary_read(f, s.r);
+    binary_read(f, s.position);
+    binary_read(f, s.Tref);
+  }  // end of BinaryReader<mtest::CurrentState>::exe
+
+  void BinaryWriter<mtest::StructureCurrentState>::exe(
+      const int f, const mtest::StructureCurrentState& s) {
+    binary_write(f, s.b != nullptr ? s.b->getBehaviourName() : std::string{});
+    binary_write(f, s.istates.size());
+    for (const auto& cs : s.istates) {
+      binary_write(f, cs);
+    }
+    binary_write(f, s.models.size());
+    for (const auto& m : s.models) {
+      binary_write(f, m->getBehaviourName());
+      binary_write(f, *(s.model_states.at(m)));
+    }
+  }  // end of BinaryWriter<mtest::StructureCurrentState>::exe
+
+  void BinaryReader<mtest::StructureCurrentState>::exe(
+      const int f, mtest::StructureCurrentState& s) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      raise_if(c, "BinaryReader<mtest::StructureCurrentState>::exe: " + m);
+    };
+    const auto b = binary_read<std::string>(f);
+    throw_if(b != (s.b != nullptr ? s.b->getBehaviourName() : std::string{}),
+             "unmatched behaviour '" + b + "'");
+    const auto n = binary_read<std::size_t>(f);
+    throw_if(n != s.istates.size(),
+             "unmatched number of integration points (read " +
+                 std::to_string(n) + ", expected " +
+                 std::to_string(s.istates.size()) + ")");
+    for (auto& cs : s.istates) {
+      binary_read(f, cs);
+    }
+    const auto nm = binary_read<std::size_t>(f);
+    throw_if(nm != s.models.size(), "unmatched number of models");
+    for (const auto& m : s.models) {
+      const auto mn = binary_read<std::string>(f);
+      throw_if(mn != m->getBehaviourName(), "unmatched model '" + mn + "'");
+      binary_read(f, *(s.model_states.at(m)));
+    }
+  }  // end of BinaryReader<mtest::StructureCurrentState>::exe
+
+  void BinaryWriter<mtest::StudyCurrentState>::exe(
+      const int f, const mtest::StudyCurrentState& s) {
+    binary_write(f, s.u_1);
+    binary_write(f, s.u0);
+    binary_write(f, s.u1);
+    binary_write(f, s.u10);
+    binary_write(f, s.period);
+    binary_write(f, s.iterations);
+    binary_write(f, s.subSteps);
+    binary_write(f, s.dt_1);
+    // parameters
+    binary_write(f, s.parameters.size());
+    for (const auto& [n, p] : s.parameters) {
+      binary_write(f, n);
+      if (p.is<bool>()) {
+        binary_write(f, StudyParameterType::BOOL);
+        binary_write(f, p.get<bool>());
+      } else if (p.is<mtest::real>()) {
+        binary_write(f, StudyParameterType::REAL);
+        binary_write(f, p.get<mtest::real>());
+      } else {
+        binary_write(f, StudyParameterType::STRING);
+        binary_write(f, p.get<std::string>());
+      }
+    }
+    // structures
+    binary_write(f, s.s.size());
+    for (const auto& [n, ss] : s.s) {
+      binary_write(f, n);
+      binary_write(f, *ss);
+    }
+    // evolutions
+    binary_write(f, s.evs.size());
+    for (const auto& [n, ev] : s.evs) {
+      binary_write(f, n);
+      const auto lpi = dynamic_cast<const mtest::LPIEvolution*>(ev.get());
+      if (lpi != nullptr) {
+        binary_write(f, StudyEvolutionType::LPI);
+        binary_write(f, lpi->getValues());
+      } else {
+        raise_if(!ev->isConstant(),
+                 "BinaryWriter<mtest::StudyCurrentState>::exe: "
+                 "evolution '" +
+                     n + "' can't be saved");
+        binary_write(f, StudyEvolutionType::CONSTANT);
+        binary_write(f, (*ev)(0));
+      }
+    }
+    // failure criteria
+    binary_write(f, s.failure_criterion_status.size());
+    for (const auto v : s.failure_criterion_status) {
+      binary_write(f, static_cast<bool>(v));
+    }
+  }  // end of BinaryWriter<mtest::StudyCurrentState>::exe
+
+  void BinaryReader<mtest::StudyCurrentState>::exe(
+      const int f, mtest::StudyCurrentState& s) {
+    auto throw_if = [](const bool c, const std::string& m) {
+      raise_if(c, "BinaryReader<mtest::StudyCurrentState>::exe: " + m);
+    };
+    binary_read_sized(f, s.u_1, "u_1");
+    binary_read_sized(f, s.u0, "u0");
+    binary_read_sized(f, s.u1, "u1");
+    binary_read_sized(f, s.u10, "u10");
+    binary_read(f, s.period);
+    binary_read(f, s.iterations);
+    binary_read(f, s.subSteps);
+    binary_read(f, s.dt_1);
+    // parameters
+    s.parameters.clear();
+    const auto np = binary_read<std::size_t>(f);
+    for (std::size_t i = 0; i != np; ++i) {
+      const auto n = binary_read<std::string>(f);
+      const auto t = binary_read<StudyParameterType>(f);
+      if (t == StudyParameterType::BOOL) {
+        s.parameters.insert({n, mtest::StudyParameter{binary_read<bool>(f)}});
+      } else if (t == StudyParameterType::REAL) {
+        s.parameters.insert(
+            {n, mtest::StudyParameter{binary_read<mtest::real>(f)}});
+      } else {
+        throw_if(t != StudyParameterType::STRING,
+                 "invalid type for parameter '" + n + "'");
+        s.parameters.insert(
+            {n, mtest::StudyParameter{binary_read<std::string>(f)}});
+      }
+    }
+    // structures
+    const auto ns = binary_read<std::size_t>(f);
+    throw_if(ns != s.s.size(), "unmatched number of structures");
+    for (std::size_t i = 0; i != ns; ++i) {
+      const auto n = binary_read<std::string>(f);
+      const auto p = s.s.find(n);
+      throw_if(p == s.s.end(), "unknown structure '" + n + "'");
+      binary_read(f, *(p->second));
+    }
+    // evolutions
+    const auto ne = binary_read<std::size_t>(f);
+    for (std::size_t i = 0; i != ne; ++i) {
+      const auto n = binary_read<std::string>(f);
+      const auto t = binary_read<StudyEvolutionType>(f);
+      if (t == StudyEvolutionType::CONSTANT) {
+        s.evs[n] = mtest::make_evolution(binary_read<mtest::real>(f));
+      } else {
+        throw_if(t != StudyEvolutionType::LPI,
+                 "invalid type for evolution '" + n + "'");
+        const auto values = binary_read<std::map<mtest::real, mtest::real>>(f);
+        auto tv = std::vector<mtest::real>{};
+        auto vv = std::vector<mtest::real>{};
+        for (const auto& [tk, v] : values) {
+          tv.push_back(tk);
+          vv.push_back(v);
+        }
+        s.evs[n] = std::make_shared<mtest::LPIEvolution>(tv, vv);
+      }
+    }
+    // failure criteria
+    const auto nf = binary_read<std::size_t>(f);
+    s.failure_criterion_status.resize(nf);
+    for (std::size_t i = 0; i != nf; ++i) {
+      s.failure_criterion_status[i] = binary_read<bool>(f);
+    }
+  }  // end of BinaryReader<mtest::StudyCurrentState>::exe
+
+}  // end of namespace tfel::system
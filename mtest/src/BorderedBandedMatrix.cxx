@@ -0,0 +1,228 @@
+/*!
+ * \file   BorderedBandedMatrix.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "MTest/BorderedBandedMatrix.hxx"
+
+namespace mtest {
+
+  BorderedBandedMatrix::BorderedBandedMatrix() = default;
+  BorderedBandedMatrix::BorderedBandedMatrix(BorderedBandedMatrix&&) =
+      default;
+  BorderedBandedMatrix::BorderedBandedMatrix(const BorderedBandedMatrix&) =
+      default;
+  BorderedBandedMatrix& BorderedBandedMatrix::operator=(
+      BorderedBandedMatrix&&) = default;
+  BorderedBandedMatrix& BorderedBandedMatrix::operator=(
+      const BorderedBandedMatrix&) = default;
+
+  void BorderedBandedMatrix::resize(const size_type s, const size_type hw) {
+    this->n = s;
+    this->w = hw;
+    const auto m = (s == 0) ? size_type(0) : s - 1;
+    this->band.resize(m * this->getBandStride());
+    this->bcolumn.resize(m);
+    this->brow.resize(m);
+    this->pivots.resize(m);
+    this->zero();
+  }  // end of resize
+
+  void BorderedBandedMatrix::clear() {
+    this->band.clear();
+    this->bcolumn.clear();
+    this->brow.clear();
+    this->pivots.clear();
+    this->n = 0;
+    this->w = 0;
+    this->corner = 0;
+    this->schur = 0;
+    this->factorized = false;
+  }  // end of clear
+
+  void BorderedBandedMatrix::zero() {
+    std::fill(this->band.begin(), this->band.end(), real(0));
+    std::fill(this->bcolumn.begin(), this->bcolumn.end(), real(0));
+    std::fill(this->brow.begin(), this->brow.end(), real(0));
+    this->corner = real(0);
+    this->schur = real(0);
+    this->factorized = false;
+  }  // end of zero
+
+  BorderedBandedMatrix::size_type BorderedBandedMatrix::size() const {
+    return this->n;
+  }  // end of size
+
+  BorderedBandedMatrix::size_type BorderedBandedMatrix::getHalfBandWidth()
+      const {
+    return this->w;
+  }  // end of getHalfBandWidth
+
+  BorderedBandedMatrix::size_type BorderedBandedMatrix::getBandStride()
+      const {
+    return 3 * this->w + 1;
+  }  // end of getBandStride
+
+  BorderedBandedMatrix::size_type BorderedBandedMatrix::getBandIndex(
+      const size_type i, const size_type j) const {
+    return i * this->getBandStride() + j + this->w - i;
+  }  // end of getBandIndex
+
+  real& BorderedBandedMatrix::operator()(const size_type i,
+                                         const size_type j) {
+    const auto m = this->n - 1;
+    if (i == m) {
+      return (j == m) ? this->corner : this->brow[j];
+    }
+    if (j == m) {
+      return this->bcolumn[i];
+    }
+    const auto d = (i > j) ? i - j : j - i;
+    tfel::raise_if(d > this->w,
+                   "BorderedBandedMatrix::operator(): "
+                   "component (" +
+                       std::to_string(i) + "," + std::to_string(j) +
+                       ") is outside the band");
+    return this->band[this->getBandIndex(i, j)];
+  }  // end of operator()
+
+  real BorderedBandedMatrix::operator()(const size_type i,
+                                        const size_type j) const {
+    const auto m = this->n - 1;
+    if (i == m) {
+      return (j == m) ? this->corner : this->brow[j];
+    }
+    if (j == m) {
+      return this->bcolumn[i];
+    }
+    if ((i > j + this->w) || (j > i + 2 * this->w)) {
+      return real(0);
+    }
+    return this->band[this->getBandIndex(i, j)];
+  }  // end of operator()
+
+  void BorderedBandedMatrix::factorize() {
+    constexpr auto eps = std::numeric_limits<real>::min();
+    if (this->n == 0) {
+      this->factorized = true;
+      return;
+    }
+    const auto m = this->n - 1;
+    auto* const a = this->band.data();
+    const auto hw = this->w;
+    auto idx = [this](const size_type i, const size_type j) {
+      return this->getBandIndex(i, j);
+    };
+    for (size_type k = 0; k != m; ++k) {
+      const auto le = std::min(m - 1, k + hw);
+      const auto ce = std::min(m - 1, k + 2 * hw);
+      // partial pivoting
+      auto p = k;
+      auto amax = std::abs(a[idx(k, k)]);
+      for (size_type i = k + 1; i <= le; ++i) {
+        const auto v = std::abs(a[idx(i, k)]);
+        if (v > amax) {
+          amax = v;
+          p = i;
+        }
+      }
+      tfel::raise_if(amax < eps,
+                     "BorderedBandedMatrix::factorize: null pivot");
+      this->pivots[k] = p;
+      if (p != k) {
+        for (size_type j = k; j <= ce; ++j) {
+          std::swap(a[idx(k, j)], a[idx(p, j)]);
+        }
+      }
+      // elimination
+      const auto pv = a[idx(k, k)];
+      for (size_type i = k + 1; i <= le; ++i) {
+        const auto l = a[idx(i, k)] / pv;
+        a[idx(i, k)] = l;
+        for (size_type j = k + 1; j <= ce; ++j) {
+          a[idx(i, j)] -= l * a[idx(k, j)];
+        }
+      }
+    }
+    // the last column is replaced by A^{-1}.b
+    this->solveBandedBlock(this->bcolumn.data());
+    auto s = this->corner;
+    for (size_type i = 0; i != m; ++i) {
+      s -= this->brow[i] * this->bcolumn[i];
+    }
+    tfel::raise_if(std::abs(s) < eps,
+                   "BorderedBandedMatrix::factorize: "
+                   "null Schur complement");
+    this->schur = s;
+    this->factorized = true;
+  }  // end of factorize
+
+  void BorderedBandedMatrix::solveBandedBlock(real* const x) const {
+    const auto m = this->n - 1;
+    const auto* const a = this->band.data();
+    const auto hw = this->w;
+    auto idx = [this](const size_type i, const size_type j) {
+      return this->getBandIndex(i, j);
+    };
+    // forward substitution
+    for (size_type k = 0; k != m; ++k) {
+      const auto p = this->pivots[k];
+      if (p != k) {
+        std::swap(x[k], x[p]);
+      }
+      const auto le = std::min(m - 1, k + hw);
+      for (size_type i = k + 1; i <= le; ++i) {
+        x[i] -= a[idx(i, k)] * x[k];
+      }
+    }
+    // backward substitution
+    for (size_type k = m; k-- != 0;) {
+      const auto ce = std::min(m - 1, k + 2 * hw);
+      auto v = x[k];
+      for (size_type j = k + 1; j <= ce; ++j) {
+        v -= a[idx(k, j)] * x[j];
+      }
+      x[k] = v / a[idx(k, k)];
+    }
+  }  // end of solveBandedBlock
+
+  void BorderedBandedMatrix::solve(tfel::math::vector<real>& x) const {
+    tfel::raise_if(!this->factorized,
+                   "BorderedBandedMatrix::solve: "
+                   "matrix is not factorised");
+    tfel::raise_if(x.size() != this->n,
+                   "BorderedBandedMatrix::solve: "
+                   "unmatched size");
+    if (this->n == 0) {
+      return;
+    }
+    const auto m = this->n - 1;
+    this->solveBandedBlock(x.data());
+    auto xn = x[m];
+    for (size_type i = 0; i != m; ++i) {
+      xn -= this->brow[i] * x[i];
+    }
+    xn /= this->schur;
+    for (size_type i = 0; i != m; ++i) {
+      x[i] -= this->bcolumn[i] * xn;
+    }
+    x[m] = xn;
+  }  // end of solve
+
+  BorderedBandedMatrix::~BorderedBandedMatrix() = default;
+
+}  // end of namespace mtest
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/CastemAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -136,4 +137,32 @@ namespace mtest {
 
   CastemAccelerationAlgorithm::~CastemAccelerationAlgorithm() = default;
 
+  void CastemAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->ca_u0);
+    binary_write(f, this->ca_u1);
+    binary_write(f, this->ca_u2);
+    binary_write(f, this->ca_r0);
+    binary_write(f, this->ca_r1);
+    binary_write(f, this->ca_r2);
+    binary_write(f, this->ca_n0);
+    binary_write(f, this->ca_n1);
+    binary_write(f, this->ca_tmp0);
+    binary_write(f, this->ca_tmp1);
+  }  // end of writeHistory
+
+  void CastemAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->ca_u0);
+    binary_read(f, this->ca_u1);
+    binary_read(f, this->ca_u2);
+    binary_read(f, this->ca_r0);
+    binary_read(f, this->ca_r1);
+    binary_read(f, this->ca_r2);
+    binary_read(f, this->ca_n0);
+    binary_read(f, this->ca_n1);
+    binary_read(f, this->ca_tmp0);
+    binary_read(f, this->ca_tmp1);
+  }  // end of readHistory
+
 }  // end of namespace mtest
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/Crossed2DeltaAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -127,4 +128,26 @@ namespace mtest {
   Crossed2DeltaAccelerationAlgorithm::~Crossed2DeltaAccelerationAlgorithm() =
       default;
 
+  void Crossed2DeltaAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->csa_u0);
+    binary_write(f, this->csa_u1);
+    binary_write(f, this->csa_du);
+    binary_write(f, this->csa_r0);
+    binary_write(f, this->csa_r1);
+    binary_write(f, this->csa_dr0);
+    binary_write(f, this->csa_dr1);
+  }  // end of writeHistory
+
+  void Crossed2DeltaAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->csa_u0);
+    binary_read(f, this->csa_u1);
+    binary_read(f, this->csa_du);
+    binary_read(f, this->csa_r0);
+    binary_read(f, this->csa_r1);
+    binary_read(f, this->csa_dr0);
+    binary_read(f, this->csa_dr1);
+  }  // end of readHistory
+
 }  // end of namespace mtest
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/Crossed2DeltabisAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -137,4 +138,38 @@ namespace mtest {
   Crossed2DeltabisAccelerationAlgorithm::
       ~Crossed2DeltabisAccelerationAlgorithm() = default;
 
+  void Crossed2DeltabisAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->csa_u0);
+    binary_write(f, this->csa_u1);
+    binary_write(f, this->csa_du);
+    binary_write(f, this->csa_x0);
+    binary_write(f, this->csa_x1);
+    binary_write(f, this->csa_x2);
+    binary_write(f, this->csa_dx0);
+    binary_write(f, this->csa_dx1);
+    binary_write(f, this->csa_dx2);
+    binary_write(f, this->csa_dudx);
+    binary_write(f, this->csa_r0);
+    binary_write(f, this->csa_r1);
+    binary_write(f, this->csa_dr);
+  }  // end of writeHistory
+
+  void Crossed2DeltabisAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->csa_u0);
+    binary_read(f, this->csa_u1);
+    binary_read(f, this->csa_du);
+    binary_read(f, this->csa_x0);
+    binary_read(f, this->csa_x1);
+    binary_read(f, this->csa_x2);
+    binary_read(f, this->csa_dx0);
+    binary_read(f, this->csa_dx1);
+    binary_read(f, this->csa_dx2);
+    binary_read(f, this->csa_dudx);
+    binary_read(f, this->csa_r0);
+    binary_read(f, this->csa_r1);
+    binary_read(f, this->csa_dr);
+  }  // end of readHistory
+
 }  // end of namespace mtest
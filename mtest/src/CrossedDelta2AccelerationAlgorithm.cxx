@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/CrossedDelta2AccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -111,4 +112,28 @@ namespace mtest {
   CrossedDelta2AccelerationAlgorithm::~CrossedDelta2AccelerationAlgorithm() =
       default;
 
+  void CrossedDelta2AccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->csa_u0);
+    binary_write(f, this->csa_u1);
+    binary_write(f, this->csa_du);
+    binary_write(f, this->csa_r0);
+    binary_write(f, this->csa_r1);
+    binary_write(f, this->csa_dr0);
+    binary_write(f, this->csa_dr1);
+    binary_write(f, this->csa_d2r);
+  }  // end of writeHistory
+
+  void CrossedDelta2AccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->csa_u0);
+    binary_read(f, this->csa_u1);
+    binary_read(f, this->csa_du);
+    binary_read(f, this->csa_r0);
+    binary_read(f, this->csa_r1);
+    binary_read(f, this->csa_dr0);
+    binary_read(f, this->csa_dr1);
+    binary_read(f, this->csa_d2r);
+  }  // end of readHistory
+
 }  // end of namespace mtest
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/CrossedSecantAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -93,4 +94,24 @@ namespace mtest {
   CrossedSecantAccelerationAlgorithm::~CrossedSecantAccelerationAlgorithm() =
       default;
 
+  void CrossedSecantAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->csa_u0);
+    binary_write(f, this->csa_u1);
+    binary_write(f, this->csa_du);
+    binary_write(f, this->csa_r0);
+    binary_write(f, this->csa_r1);
+    binary_write(f, this->csa_dr);
+  }  // end of writeHistory
+
+  void CrossedSecantAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->csa_u0);
+    binary_read(f, this->csa_u1);
+    binary_read(f, this->csa_du);
+    binary_read(f, this->csa_r0);
+    binary_read(f, this->csa_r1);
+    binary_read(f, this->csa_dr);
+  }  // end of readHistory
+
 }  // end of namespace mtest
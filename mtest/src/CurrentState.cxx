@@ -17,6 +17,7 @@
 #include "MTest/Evolution.hxx"
 #include "MTest/Behaviour.hxx"
 #include "MTest/CurrentState.hxx"
+#include "MTest/EvolutionBindingTable.hxx"
 
 namespace mtest {
 
@@ -96,6 +97,35 @@ namespace mtest {
     }
   }  // end of computeExternalStateVariables
 
+  void computeMaterialProperties(CurrentState& s,
+                                 const EvolutionBindingTable& mps,
+                                 const real t,
+                                 const real dt) {
+    tfel::raise_if(s.behaviour == nullptr,
+                   "mtest::computeMaterialProperties: "
+                   "uninitialised state");
+    tfel::raise_if(s.mprops1.size() != mps.size(),
+                   "computeMaterialProperties:"
+                   "CurrentState variable was not "
+                   "initialized appropriately");
+    mps.evaluate(s.mprops1, t + dt);
+  }  // end of computeMaterialProperties
+
+  void computeExternalStateVariables(CurrentState& s,
+                                     const EvolutionBindingTable& esvs,
+                                     const real t,
+                                     const real dt) {
+    tfel::raise_if(s.behaviour == nullptr,
+                   "mtest::computeExternalStateVariables: "
+                   "uninitialised state");
+    tfel::raise_if((s.esv0.size() != esvs.size()) ||
+                       (s.desv.size() != esvs.size()),
+                   "computeExternalStateVariables: "
+                   "CurrentState variable was not "
+                   "initialized appropriately");
+    esvs.evaluate(s.esv0, s.desv, t, dt);
+  }  // end of computeExternalStateVariables
+
   void computeThermalExpansion(CurrentState& s,
                                const EvolutionManager& evm,
                                const real t,
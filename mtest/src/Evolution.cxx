@@ -100,6 +100,10 @@ namespace mtest {
     return (this->values.size() == 1);
   }  // end of LPIEvolution::isConstant
 
+  const std::map<real, real>& LPIEvolution::getValues() const {
+    return this->values;
+  }  // end of LPIEvolution::getValues
+
   LPIEvolution::~LPIEvolution() = default;
 
   std::shared_ptr<Evolution> make_evolution(const real v) {
@@ -0,0 +1,96 @@
+/*!
+ * \file   mtest/src/EvolutionBindingTable.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "TFEL/Raise.hxx"
+#include "MTest/Evolution.hxx"
+#include "MTest/EvolutionBindingTable.hxx"
+
+namespace mtest {
+
+  EvolutionBindingTable::EvolutionBindingTable() = default;
+
+  EvolutionBindingTable::EvolutionBindingTable(
+      const std::vector<std::string>& names,
+      const EvolutionManager& evm,
+      const std::string& c)
+      : EvolutionBindingTable(names, evm, EvolutionManager{}, c) {
+  }  // end of EvolutionBindingTable
+
+  EvolutionBindingTable::EvolutionBindingTable(
+      const std::vector<std::string>& names,
+      const EvolutionManager& evm,
+      const EvolutionManager& dvm,
+      const std::string& c)
+      : n(names.size()) {
+    for (size_type i = 0; i != names.size(); ++i) {
+      auto pev = evm.find(names[i]);
+      if (pev == evm.end()) {
+        pev = dvm.find(names[i]);
+        tfel::raise_if(pev == dvm.end(),
+                       "EvolutionBindingTable::EvolutionBindingTable: "
+                       "no evolution associated with the " +
+                           c + " '" + names[i] + "'");
+      }
+      // the value of a `ConstantEvolution` may be changed, but it never
+      // depends on time. Other evolutions which are constant at the
+      // time the table is built may become time-dependent (for
+      // instance, `LPIEvolution`s).
+      if (dynamic_cast<const ConstantEvolution*>(pev->second.get()) !=
+          nullptr) {
+        this->constants.push_back({i, pev->second});
+      } else {
+        this->evolutions.push_back({i, pev->second});
+      }
+    }
+  }  // end of EvolutionBindingTable
+
+  EvolutionBindingTable::EvolutionBindingTable(EvolutionBindingTable&&) =
+      default;
+  EvolutionBindingTable::EvolutionBindingTable(const EvolutionBindingTable&) =
+      default;
+  EvolutionBindingTable& EvolutionBindingTable::operator=(
+      EvolutionBindingTable&&) = default;
+  EvolutionBindingTable& EvolutionBindingTable::operator=(
+      const EvolutionBindingTable&) = default;
+
+  EvolutionBindingTable::size_type EvolutionBindingTable::size() const {
+    return this->n;
+  }  // end of size
+
+  void EvolutionBindingTable::evaluate(tfel::math::vector<real>& v,
+                                       const real t) const {
+    for (const auto& [i, ev] : this->constants) {
+      v[i] = (*ev)(t);
+    }
+    for (const auto& [i, ev] : this->evolutions) {
+      v[i] = (*ev)(t);
+    }
+  }  // end of evaluate
+
+  void EvolutionBindingTable::evaluate(tfel::math::vector<real>& v0,
+                                       tfel::math::vector<real>& dv,
+                                       const real t,
+                                       const real dt) const {
+    for (const auto& [i, ev] : this->constants) {
+      v0[i] = (*ev)(t);
+      dv[i] = real(0);
+    }
+    for (const auto& [i, ev] : this->evolutions) {
+      v0[i] = (*ev)(t);
+      dv[i] = (*ev)(t + dt) - v0[i];
+    }
+  }  // end of evaluate
+
+  EvolutionBindingTable::~EvolutionBindingTable() = default;
+
+}  // end of namespace mtest
@@ -38,6 +38,26 @@ namespace mtest {
     log << '\n';
   }
 
+  /*!
+   * \brief display the stiffness matrix
+   * \param[out] log: output stream
+   * \param[in] k: stiffness matrix
+   * \param[in] n: size of the matrix
+   */
+  template <typename MatrixType>
+  static void displayStiffnessMatrix(
+      std::ostream& log,
+      const MatrixType& k,
+      const tfel::math::matrix<real>::size_type n) {
+    using size_type = tfel::math::matrix<real>::size_type;
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        log << k(i, j) << " ";
+      }
+      log << '\n';
+    }
+  }  // end of displayStiffnessMatrix
+
   static std::pair<bool, real> iterate2(StudyCurrentState& scs,
                                         SolverWorkSpace& wk,
                                         const Study& s,
@@ -62,7 +82,7 @@ namespace mtest {
       }
     }
     const auto r =
-        s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+        s.computeStiffnessMatrixAndResidual(scs, wk, t, dt, o.ktype);
     if (!r.first) {
       return r;
     }
@@ -153,8 +173,7 @@ namespace mtest {
       ++iter;
       nep2 = nep;
       nep = ne;
-      auto r =
-          s.computeStiffnessMatrixAndResidual(scs, wk.K, wk.r, t, dt, o.ktype);
+      auto r = s.computeStiffnessMatrixAndResidual(scs, wk, t, dt, o.ktype);
       if (!r.first) {
         return r;
       }
@@ -163,11 +182,10 @@ namespace mtest {
           (o.ktype != StiffnessMatrixType::NOSTIFFNESS)) {
         auto& log = mfront::getLogStream();
         log << "Stiffness matrix:\n";
-        for (size_type i = 0; i != wk.K.getNbRows(); ++i) {
-          for (size_type j = 0; j != wk.K.getNbCols(); ++j) {
-            log << wk.K(i, j) << " ";
-          }
-          log << '\n';
+        if (wk.storage == SolverWorkSpace::BORDEREDBANDED) {
+          displayStiffnessMatrix(log, wk.Kb, wk.Kb.size());
+        } else {
+          displayStiffnessMatrix(log, wk.K, wk.K.getNbRows());
         }
         log << '\n';
       }
@@ -181,7 +199,7 @@ namespace mtest {
       }
       wk.du = wk.r;
       setRoundingMode();
-      LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+      solveLinearSystem(wk);
       setRoundingMode();
       u1 -= wk.du;
       converged =
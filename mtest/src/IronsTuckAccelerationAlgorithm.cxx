@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/IronsTuckAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -83,4 +84,18 @@ namespace mtest {
 
   IronsTuckAccelerationAlgorithm::~IronsTuckAccelerationAlgorithm() = default;
 
+  void IronsTuckAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->ita_r0);
+    binary_write(f, this->ita_r1);
+    binary_write(f, this->ita_dr);
+  }  // end of writeHistory
+
+  void IronsTuckAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->ita_r0);
+    binary_read(f, this->ita_r1);
+    binary_read(f, this->ita_dr);
+  }  // end of readHistory
+
 }  // end of namespace mtest
@@ -24,6 +24,7 @@
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
 #include "TFEL/Utilities/ArgumentParserBase.hxx"
 #include "TFEL/Utilities/TerminalColors.hxx"
 #include "TFEL/Math/General/IEEE754.hxx"
@@ -297,7 +298,18 @@ namespace mtest {
     unsigned short cnbr = 2;
     const char* dvn;
     const char* thn;
-    if (this->out) {
+    if (this->useBinaryOutputFiles()) {
+      auto n = std::vector<std::string>{"time"};
+      const auto gc = this->b->getGradientsComponents();
+      const auto thc = this->b->getThermodynamicForcesComponents();
+      const auto ivc = this->b->expandInternalStateVariablesNames();
+      n.insert(n.end(), gc.begin(), gc.end());
+      n.insert(n.end(), thc.begin(), thc.end());
+      n.insert(n.end(), ivc.begin(), ivc.end());
+      n.push_back("StoredEnergy");
+      n.push_back("DissipatedEnergy");
+      this->openBinaryOutputFile(n);
+    } else if (this->out) {
       this->out << "# first column: time\n";
       if (this->b->getBehaviourType() ==
           MechanicalBehaviourBase::STANDARDSTRAINBASEDBEHAVIOUR) {
@@ -440,11 +452,13 @@ namespace mtest {
     const auto psz = this->getNumberOfUnknowns();
     // clear
     wk.K.clear();
+    wk.Kb.clear();
     wk.p_lu.clear();
     wk.x.clear();
     wk.r.clear();
     wk.du.clear();
     // resizing
+    wk.storage = SolverWorkSpace::DENSE;
     wk.K.resize(psz, psz);
     wk.p_lu.resize(psz);
     wk.x.resize(psz);
@@ -507,8 +521,13 @@ namespace mtest {
       }
       this->initializeCurrentState(state);
       this->initializeWorkSpace(wk);
+      // restart, if requested
+      const auto r = this->readCheckpoint(state);
+      if (r != 0) {
+        this->treatEvents(this->times[r]);
+      }
       // integrating over the loading path
-      auto pt = this->times.begin();
+      auto pt = this->times.begin() + static_cast<std::ptrdiff_t>(r);
       auto pt2 = pt + 1;
       this->printOutput(*pt, state, true);
       // real work begins here
@@ -518,17 +537,19 @@ namespace mtest {
         this->printOutput(*pt2, state, true);
         ++pt;
         ++pt2;
+        this->writeCheckpoint(
+            static_cast<std::size_t>(pt - this->times.begin()), state);
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFiles();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFiles();
       report(nullptr, state, false);
       throw;
     }
-    this->out.flush();
+    this->flushOutputFiles();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -921,9 +942,13 @@ namespace mtest {
                       const real ti,
                       const real te) {
     GenericSolver().execute(state, wk, *this, this->options, ti, te);
+    this->treatEvents(te);
+  }  // end of execute
+
+  void MTest::treatEvents(const real t) {
     auto p = this->events.begin();
     while (p != this->events.end()) {
-      if (!(p->first > te)) {
+      if (!(p->first > t)) {
         for (const auto& e : p->second) {
           for (const auto& c : this->constraints) {
             c->treatEvent(e);
@@ -934,7 +959,7 @@ namespace mtest {
         break;
       }
     }
-  }  // end of execute
+  }  // end of treatEvents
 
   void MTest::printOutput(const real t,
                           const StudyCurrentState& s,
@@ -942,7 +967,25 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
-    if (this->out) {
+    if (this->boutput != nullptr) {
+      auto& cs = s.getStructureCurrentState("").istates[0];
+      const auto ndv = this->b->getGradientsSize();
+      const auto nth = this->b->getThermodynamicForcesSize();
+      auto& w = *(this->boutput);
+      w.write(t);
+      for (unsigned short i = 0; i != ndv; ++i) {
+        w.write(s.u0[i]);
+      }
+      for (unsigned short i = 0; i != nth; ++i) {
+        w.write(cs.s0[i]);
+      }
+      for (const auto& v : cs.iv0) {
+        w.write(v);
+      }
+      w.write(cs.se0);
+      w.write(cs.de0);
+      w.endRow();
+    } else if (this->out) {
       auto& cs = s.getStructureCurrentState("").istates[0];
       // number of components of the driving variables and the thermodynamic
       // forces
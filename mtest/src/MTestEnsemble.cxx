@@ -0,0 +1,319 @@
+/*!
+ * \file   mtest/src/MTestEnsemble.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <mutex>
+#include <limits>
+#include <future>
+#include <sstream>
+#include <ostream>
+#include <iterator>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/System/ThreadPool.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+#include "MTest/Behaviour.hxx"
+#include "MTest/CurrentState.hxx"
+#include "MTest/SolverWorkSpace.hxx"
+#include "MTest/StudyCurrentState.hxx"
+#include "MTest/StructureCurrentState.hxx"
+#include "MTest/MTest.hxx"
+#include "MTest/MTestParser.hxx"
+#include "MTest/MTestEnsemble.hxx"
+
+namespace mtest {
+
+  /*!
+   * \brief results of a single variant, stored by columns
+   */
+  struct MTestEnsembleVariantResults {
+    //! \brief names of the columns
+    std::vector<std::string> names;
+    //! \brief values of the columns
+    std::vector<std::vector<real>> columns;
+    //! \brief error message, if any
+    std::string failure;
+  };  // end of struct MTestEnsembleVariantResults
+
+  /*!
+   * \brief mutex used to serialize the interpretation of the input
+   * file, since the loading of the behaviour relies on the
+   * `ExternalLibraryManager` singleton.
+   */
+  static std::mutex& getMTestEnsembleMutex() {
+    static std::mutex m;
+    return m;
+  }  // end of getMTestEnsembleMutex
+
+  /*!
+   * \return the names of the columns describing the state of the
+   * material point
+   * \param[in] b: behaviour
+   */
+  static std::vector<std::string> getStateColumnsNames(const Behaviour& b) {
+    auto n = std::vector<std::string>{"time"};
+    const auto gc = b.getGradientsComponents();
+    const auto thc = b.getThermodynamicForcesComponents();
+    const auto ivc = b.expandInternalStateVariablesNames();
+    n.insert(n.end(), gc.begin(), gc.end());
+    n.insert(n.end(), thc.begin(), thc.end());
+    n.insert(n.end(), ivc.begin(), ivc.end());
+    n.push_back("StoredEnergy");
+    n.push_back("DissipatedEnergy");
+    return n;
+  }  // end of getStateColumnsNames
+
+  /*!
+   * \brief add the state of the material point to the columns
+   * \param[out] c: columns
+   * \param[in] t: time
+   * \param[in] s: current state
+   * \param[in] b: behaviour
+   */
+  static void appendState(std::vector<std::vector<real>>& c,
+                          const real t,
+                          const StudyCurrentState& s,
+                          const Behaviour& b) {
+    const auto& cs = s.getStructureCurrentState("").istates[0];
+    const auto ndv = b.getGradientsSize();
+    const auto nth = b.getThermodynamicForcesSize();
+    auto p = c.begin();
+    (p++)->push_back(t);
+    for (unsigned short i = 0; i != ndv; ++i) {
+      (p++)->push_back(s.u0[i]);
+    }
+    for (unsigned short i = 0; i != nth; ++i) {
+      (p++)->push_back(cs.s0[i]);
+    }
+    for (const auto& v : cs.iv0) {
+      (p++)->push_back(v);
+    }
+    (p++)->push_back(cs.se0);
+    p->push_back(cs.de0);
+  }  // end of appendState
+
+  /*!
+   * \brief run a single variant
+   * \param[in] p: parser holding the tokens of the input file
+   * \param[in] names: names of the parameters
+   * \param[in] values: values of the parameters
+   */
+  static MTestEnsembleVariantResults runVariant(
+      const MTestParser& p,
+      const std::vector<std::string>& names,
+      const std::vector<real>& values) {
+    auto r = MTestEnsembleVariantResults{};
+    try {
+      auto s = std::map<std::string, std::string>{};
+      for (decltype(names.size()) i = 0; i != names.size(); ++i) {
+        std::ostringstream v;
+        v.precision(std::numeric_limits<real>::max_digits10);
+        v << values[i];
+        s["@" + names[i] + "@"] = v.str();
+      }
+      MTest m;
+      {
+        std::lock_guard<std::mutex> lock(getMTestEnsembleMutex());
+        MTestParser().execute(m, p, s);
+        tfel::raise_if(
+            m.isOutputFileNameDefined() || m.isResidualFileNameDefined(),
+            "output files can't be defined by the variants "
+            "of an ensemble of tests");
+        m.completeInitialisation();
+      }
+      const auto& times = m.getTimes();
+      tfel::raise_if(times.size() < 2, "invalid number of times defined");
+      const auto& b = *(m.getBehaviour());
+      r.names = getStateColumnsNames(b);
+      r.columns.resize(r.names.size());
+      StudyCurrentState state;
+      SolverWorkSpace wk;
+      m.initializeCurrentState(state);
+      m.initializeWorkSpace(wk);
+      auto pt = times.begin();
+      appendState(r.columns, *pt, state, b);
+      for (auto pt2 = std::next(pt); pt2 != times.end(); ++pt, ++pt2) {
+        m.execute(state, wk, *pt, *pt2);
+        appendState(r.columns, *pt2, state, b);
+      }
+    } catch (std::exception& e) {
+      r.failure = e.what();
+    } catch (...) {
+      r.failure = "unknown exception";
+    }
+    return r;
+  }  // end of runVariant
+
+  bool MTestEnsemble::Results::succeeded() const {
+    return std::all_of(this->failures.begin(), this->failures.end(),
+                       [](const std::string& f) { return f.empty(); });
+  }  // end of succeeded
+
+  const std::vector<real>& MTestEnsemble::Results::getColumn(
+      const std::string& n) const {
+    const auto p = std::find(this->names.begin(), this->names.end(), n);
+    tfel::raise_if(p == this->names.end(),
+                   "MTestEnsemble::Results::getColumn: "
+                   "no column named '" +
+                       n + "'");
+    return this->columns[static_cast<std::size_t>(p - this->names.begin())];
+  }  // end of getColumn
+
+  MTestEnsemble::MTestEnsemble(const std::string& f,
+                               const std::vector<std::string>& ecmds,
+                               const std::map<std::string, std::string>& s)
+      : parser(std::make_unique<MTestParser>()) {
+    this->parser->readInputFile(f, ecmds, s);
+  }  // end of MTestEnsemble
+
+  void MTestEnsemble::setNumberOfThreads(const int n) {
+    tfel::raise_if(n <= 0,
+                   "MTestEnsemble::setNumberOfThreads: "
+                   "invalid number of threads (" +
+                       std::to_string(n) + ")");
+    if (n == 1) {
+      this->pool.reset();
+    } else {
+      this->pool = std::make_shared<tfel::system::ThreadPool>(
+          static_cast<tfel::system::ThreadPool::size_type>(n));
+    }
+  }  // end of setNumberOfThreads
+
+  void MTestEnsemble::addVariant(const std::map<std::string, real>& v) {
+    auto n = std::vector<std::string>{};
+    auto values = std::vector<real>{};
+    for (const auto& kv : v) {
+      n.push_back(kv.first);
+      values.push_back(kv.second);
+    }
+    if (this->variants.empty()) {
+      this->names = n;
+    } else {
+      tfel::raise_if(n != this->names,
+                     "MTestEnsemble::addVariant: "
+                     "all the variants must define the same parameters");
+    }
+    this->variants.push_back(std::move(values));
+  }  // end of addVariant
+
+  void MTestEnsemble::readVariants(const std::string& f) {
+    const auto data = tfel::utilities::TextData(f);
+    const auto& legends = data.getLegends();
+    tfel::raise_if(legends.empty(),
+                   "MTestEnsemble::readVariants: "
+                   "no parameter declared in file '" +
+                       f + "'");
+    auto columns = std::vector<std::vector<double>>{};
+    for (decltype(legends.size()) i = 0; i != legends.size(); ++i) {
+      columns.push_back(data.getColumn(i + 1));
+    }
+    for (decltype(columns[0].size()) i = 0; i != columns[0].size(); ++i) {
+      auto v = std::map<std::string, real>{};
+      for (decltype(legends.size()) j = 0; j != legends.size(); ++j) {
+        tfel::raise_if(!v.insert({legends[j], columns[j][i]}).second,
+                       "MTestEnsemble::readVariants: "
+                       "parameter '" +
+                           legends[j] + "' multiply defined in file '" +
+                           f + "'");
+      }
+      this->addVariant(v);
+    }
+  }  // end of readVariants
+
+  std::size_t MTestEnsemble::getNumberOfVariants() const {
+    return this->variants.size();
+  }  // end of getNumberOfVariants
+
+  MTestEnsemble::Results MTestEnsemble::execute() const {
+    const auto nv = this->variants.size();
+    auto vresults = std::vector<MTestEnsembleVariantResults>{};
+    vresults.reserve(nv);
+    if (this->pool == nullptr) {
+      for (const auto& v : this->variants) {
+        vresults.push_back(runVariant(*(this->parser), this->names, v));
+      }
+    } else {
+      using TaskResult =
+          tfel::system::ThreadedTaskResult<MTestEnsembleVariantResults>;
+      auto tasks = std::vector<std::future<TaskResult>>{};
+      tasks.reserve(nv);
+      for (const auto& v : this->variants) {
+        tasks.push_back(this->pool->addTask([this, &v] {
+          return runVariant(*(this->parser), this->names, v);
+        }));
+      }
+      for (auto& task : tasks) {
+        auto r = task.get();
+        if (!r) {
+          r.rethrow();
+        }
+        vresults.push_back(std::move(*r));
+      }
+    }
+    // gathering the results of all variants, in order
+    auto r = Results{};
+    r.names.push_back("variant");
+    r.names.insert(r.names.end(), this->names.begin(), this->names.end());
+    const auto pr =
+        std::find_if(vresults.begin(), vresults.end(),
+                     [](const MTestEnsembleVariantResults& vr) {
+                       return !vr.names.empty();
+                     });
+    if (pr != vresults.end()) {
+      r.names.insert(r.names.end(), pr->names.begin(), pr->names.end());
+    }
+    r.columns.resize(r.names.size());
+    const auto np = this->names.size();
+    for (decltype(vresults.size()) i = 0; i != nv; ++i) {
+      const auto& vr = vresults[i];
+      r.failures.push_back(vr.failure);
+      if (vr.columns.empty()) {
+        continue;
+      }
+      const auto nr = vr.columns[0].size();
+      r.columns[0].insert(r.columns[0].end(), nr, static_cast<real>(i));
+      for (decltype(this->names.size()) j = 0; j != np; ++j) {
+        r.columns[j + 1].insert(r.columns[j + 1].end(), nr,
+                                this->variants[i][j]);
+      }
+      for (decltype(vr.columns.size()) j = 0; j != vr.columns.size(); ++j) {
+        auto& c = r.columns[j + np + 1];
+        c.insert(c.end(), vr.columns[j].begin(), vr.columns[j].end());
+      }
+    }
+    return r;
+  }  // end of execute
+
+  MTestEnsemble::~MTestEnsemble() = default;
+
+  void write(std::ostream& os, const MTestEnsemble::Results& r) {
+    os << '#';
+    for (const auto& n : r.names) {
+      os << ' ' << n;
+    }
+    os << '\n';
+    if (r.columns.empty()) {
+      return;
+    }
+    const auto nr = r.columns[0].size();
+    for (decltype(r.columns[0].size()) i = 0; i != nr; ++i) {
+      for (decltype(r.columns.size()) j = 0; j != r.columns.size(); ++j) {
+        if (j != 0) {
+          os << ' ';
+        }
+        os << r.columns[j][i];
+      }
+      os << '\n';
+    }
+  }  // end of write
+
+}  // end of namespace mtest
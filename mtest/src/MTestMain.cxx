@@ -13,6 +13,8 @@
 
 #include <cfenv>
 #include <regex>
+#include <limits>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <cstdlib>
@@ -53,6 +55,7 @@
 #include "MTest/Constraint.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/MTest.hxx"
+#include "MTest/MTestEnsemble.hxx"
 #include "MTest/PipeTest.hxx"
 #include "MTest/MTestParser.hxx"
 #include "MTest/PipeTestParser.hxx"
@@ -78,6 +81,14 @@ namespace mtest {
     void treatXMLOutput();
     void treatResultFileOutput();
     void treatResidualFileOutput();
+    //! \brief treat the `--ensemble` option
+    void treatEnsemble();
+    //! \brief treat the `--ensemble-output` option
+    void treatEnsembleOutput();
+    //! \brief treat the `--ensemble-threads` option
+    void treatEnsembleThreads();
+    //! \brief treat the `--restart` option
+    void treatRestart();
     [[noreturn]] void treatHelpCommandsList();
     [[noreturn]] void treatHelpCommands();
     [[noreturn]] void treatHelpCommand();
@@ -102,6 +113,12 @@ namespace mtest {
     std::shared_ptr<SchemeBase> createPTestTest(const std::string&);
     void treatMadnexInputFile(const std::string&);
     void treatStandardInputFile(const std::string&);
+    /*!
+     * \brief run all the variants of an ensemble of tests
+     * \param[in] i: input file
+     * \return true on success
+     */
+    bool executeEnsemble(const std::string&);
 
 #ifdef MADNEX_MTEST_TEST_SUPPORT
     /*!
@@ -136,6 +153,14 @@ namespace mtest {
     bool result_file_output = true;
     // generate residual file
     bool residual_file_output = false;
+    //! \brief file describing the variants of an ensemble of tests
+    std::string ensemble;
+    //! \brief output file of an ensemble of tests
+    std::string ensemble_output;
+    //! \brief number of threads used to run an ensemble of tests
+    int ensemble_threads = 1;
+    //! \brief checkpoint file from which the tests are restarted
+    std::string restart;
   };
 
   MTestMain::MTestMain(const int argc, const char* const* const argv)
@@ -160,6 +185,26 @@ namespace mtest {
     this->registerNewCallBack("--residual-file-output",
                               &MTestMain::treatResidualFileOutput,
                               "control residual output (default no)", true);
+    this->registerNewCallBack(
+        "--ensemble", &MTestMain::treatEnsemble,
+        "run the variants described in the given file. The first line of "
+        "this file gives the names of the parameters of the variants, each "
+        "parameter 'n' replacing the pattern '@n@' in the input file. Each "
+        "following line describes a variant.",
+        true);
+    this->registerNewCallBack("--ensemble-output",
+                              &MTestMain::treatEnsembleOutput,
+                              "set the output file of the ensemble of tests "
+                              "(default: <input>-ensemble.res)",
+                              true);
+    this->registerNewCallBack(
+        "--ensemble-threads", &MTestMain::treatEnsembleThreads,
+        "set the number of threads used to run the ensemble of tests", true);
+    this->registerNewCallBack(
+        "--restart", &MTestMain::treatRestart,
+        "restart the test from the given checkpoint file (see the "
+        "`@Checkpoint` keyword)",
+        true);
     this->registerNewCallBack(
         "--help-keywords", &MTestMain::treatHelpCommands,
         "display the help of all available commands and exit.");
@@ -388,6 +433,55 @@ namespace mtest {
     }
   }  // end of MTestMain::treatResidualFileOutput
 
+  void MTestMain::treatEnsemble() {
+    tfel::raise_if(!this->ensemble.empty(),
+                   "MTestMain::treatEnsemble: "
+                   "ensemble already defined");
+    this->ensemble = this->currentArgument->getOption();
+    tfel::raise_if(this->ensemble.empty(),
+                   "MTestMain::treatEnsemble: "
+                   "no file specified");
+  }  // end of MTestMain::treatEnsemble
+
+  void MTestMain::treatEnsembleOutput() {
+    tfel::raise_if(!this->ensemble_output.empty(),
+                   "MTestMain::treatEnsembleOutput: "
+                   "output file already defined");
+    this->ensemble_output = this->currentArgument->getOption();
+    tfel::raise_if(this->ensemble_output.empty(),
+                   "MTestMain::treatEnsembleOutput: "
+                   "no file specified");
+  }  // end of MTestMain::treatEnsembleOutput
+
+  void MTestMain::treatEnsembleThreads() {
+    const auto& o = this->currentArgument->getOption();
+    tfel::raise_if(o.empty(),
+                   "MTestMain::treatEnsembleThreads: "
+                   "no number of threads specified");
+    try {
+      this->ensemble_threads = std::stoi(o);
+    } catch (std::exception&) {
+      tfel::raise(
+          "MTestMain::treatEnsembleThreads: "
+          "invalid number of threads '" +
+          o + "'");
+    }
+    tfel::raise_if(this->ensemble_threads <= 0,
+                   "MTestMain::treatEnsembleThreads: "
+                   "invalid number of threads '" +
+                       o + "'");
+  }  // end of MTestMain::treatEnsembleThreads
+
+  void MTestMain::treatRestart() {
+    tfel::raise_if(!this->restart.empty(),
+                   "MTestMain::treatRestart: "
+                   "restart file already defined");
+    this->restart = this->currentArgument->getOption();
+    tfel::raise_if(this->restart.empty(),
+                   "MTestMain::treatRestart: "
+                   "no file specified");
+  }  // end of MTestMain::treatRestart
+
   void MTestMain::treatHelpCommandsList() {
     if ((this->scheme == MTEST) || (this->scheme == DEFAULT)) {
       MTestParser().displayKeyWordsList();
@@ -488,6 +582,16 @@ namespace mtest {
   }
 
   int MTestMain::execute() {
+    if (!this->ensemble.empty()) {
+      tfel::raise_if(!this->restart.empty(),
+                     "MTestMain::execute: "
+                     "restarting an ensemble of tests is not supported");
+      auto success = true;
+      for (const auto& i : this->inputs) {
+        success = this->executeEnsemble(i) && success;
+      }
+      return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
     for (const auto& i : this->inputs) {
       const auto ext = [&i]() -> std::string {
         const auto pos = i.rfind('.');
@@ -519,6 +623,42 @@ namespace mtest {
     return t;
   }  // end of createMTestTest
 
+  bool MTestMain::executeEnsemble(const std::string& i) {
+    tfel::raise_if((this->scheme == PTEST) ||
+                       ((this->scheme == DEFAULT) &&
+                        (tfel::utilities::ends_with(i, ".ptest"))),
+                   "MTestMain::executeEnsemble: "
+                   "ensembles of tests are only supported by mtest files");
+    auto e = MTestEnsemble(i, this->ecmds, this->substitutions);
+    e.readVariants(this->ensemble);
+    e.setNumberOfThreads(this->ensemble_threads);
+    const auto r = e.execute();
+    const auto o = [this, &i]() -> std::string {
+      if (!this->ensemble_output.empty()) {
+        return this->ensemble_output;
+      }
+      auto n = i.substr(0, i.rfind('.'));
+      const auto pos = n.rfind('/');
+      if (pos != std::string::npos) {
+        n = n.substr(pos + 1);
+      }
+      return n + "-ensemble.res";
+    }();
+    std::ofstream out(o);
+    tfel::raise_if(!out,
+                   "MTestMain::executeEnsemble: "
+                   "can't open file '" +
+                       o + "'");
+    out.precision(std::numeric_limits<real>::max_digits10);
+    write(out, r);
+    for (decltype(r.failures.size()) v = 0; v != r.failures.size(); ++v) {
+      if (!r.failures[v].empty()) {
+        std::cerr << "variant " << v << " failed: " << r.failures[v] << '\n';
+      }
+    }
+    return r.succeeded();
+  }  // end of executeEnsemble
+
   std::shared_ptr<SchemeBase> MTestMain::createPTestTest(
       const std::string& path) {
     auto t = std::make_shared<PipeTest>();
@@ -698,6 +838,12 @@ namespace mtest {
         t->setResidualFileName(n + "-residual.res");
       }
     }
+    if (!t->isCheckpointFileNameDefined()) {
+      t->setCheckpointFileName(n + ".chk");
+    }
+    if (!this->restart.empty()) {
+      t->setRestartFileName(this->restart);
+    }
     tm.addTest("MTest/" + n, t);
     if (this->xml_output) {
       std::shared_ptr<tfel::tests::TestOutput> o;
@@ -72,20 +72,63 @@ namespace mtest {
                             const std::string& f,
                             const std::vector<std::string>& ecmds,
                             const std::map<std::string, std::string>& s) {
-    this->openFile(f);
-    this->stripComments();
-    // substitutions
+    this->readInputFile(f, ecmds, s);
+    this->execute(t);
+  }  // end of execute
+
+  void MTestParser::execute(MTest& t,
+                            const MTestParser& p,
+                            const std::map<std::string, std::string>& s) {
+    this->file = p.file;
+    this->tokens.assign(p.tokens.begin(), p.tokens.end());
+    this->applySubstitutions(s);
+    this->execute(t);
+  }  // end of execute
+
+  void MTestParser::applySubstitutions(
+      const std::map<std::string, std::string>& s) {
+    if (s.empty()) {
+      return;
+    }
+    // flag associated with each substitution
+    auto flags = std::map<std::string, tfel::utilities::Token::TokenFlag>{};
+    for (const auto& [pattern, value] : s) {
+      if (((value.front() == '\'') && (value.back() == '\'')) ||
+          ((value.front() == '"') && (value.back() == '"'))) {
+        flags[pattern] = tfel::utilities::Token::String;
+        continue;
+      }
+      // numbers must be flagged as such to be read by `readDouble`
+      try {
+        CxxTokenizer tokenizer;
+        tokenizer.parseString(value);
+        if (std::distance(tokenizer.begin(), tokenizer.end()) == 1) {
+          flags[pattern] = tokenizer.begin()->flag;
+        }
+      } catch (std::exception&) {
+        // the value is kept as is
+      }
+    }
     const auto pe = s.end();
     for (auto& token : this->tokens) {
       auto p = s.find(token.value);
       if (p != pe) {
         token.value = p->second;
-        if (((p->second.front() == '\'') && (p->second.back() == '\'')) ||
-            ((p->second.front() == '"') && (p->second.back() == '"'))) {
-          token.flag = tfel::utilities::Token::String;
+        const auto pf = flags.find(p->first);
+        if (pf != flags.end()) {
+          token.flag = pf->second;
         }
       }
     }
+  }  // end of applySubstitutions
+
+  void MTestParser::readInputFile(
+      const std::string& f,
+      const std::vector<std::string>& ecmds,
+      const std::map<std::string, std::string>& s) {
+    this->openFile(f);
+    this->stripComments();
+    this->applySubstitutions(s);
     // treating external commands
     for (const auto& c : ecmds) {
       CxxTokenizer tokenizer;
@@ -102,8 +145,7 @@ namespace mtest {
       this->tokens.insert(this->tokens.begin(), tokenizer.begin(),
                           tokenizer.end());
     }
-    this->execute(t);
-  }  // end of execute
+  }  // end of readInputFile
 
   void MTestParser::execute(MTest& t) {
     auto p = this->tokens.cbegin();
@@ -104,15 +104,15 @@ namespace mtest {
   }  // end of PipeCubicElement::interpolate
 
   constexpr real PipeCubicElement::jacobian(const real r0,
-                                            const real r1,
-                                            const real r2,
-                                            const real r3,
-                                            const real x) {
+           const real r1,
+           const real r2,
+           const real r3,
+           const real x) {
     return r0 * dsf0(x) + r1 * dsf1(x) + r2 * dsf2(x) + r3 * dsf3(x);
   }  // end of PipeCubicElement::jacobian
 
   void PipeCubicElement::setGaussPointsPositions(StructureCurrentState& scs,
-                                                 const PipeMesh& m) {
+                const PipeMesh& m) {
     // number of elements
     const auto ne = size_t(m.number_of_elements);
     // inner radius
@@ -143,10 +143,10 @@ namespace mtest {
   }
 
   void PipeCubicElement::computeStrain(StructureCurrentState& scs,
-                                       const PipeMesh& m,
-                                       const tfel::math::vector<real>& u,
-                                       const size_t i,
-                                       const bool b) {
+      const PipeMesh& m,
+      const tfel::math::vector<real>& u,
+      const size_t i,
+      const bool b) {
     // number of elements
     const auto ne = size_t(m.number_of_elements);
     // number of nodes
@@ -196,9 +196,9 @@ namespace mtest {
   }  // end of PipeCubicElement::computeStrain
 
   std::pair<bool, real> PipeCubicElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+      PipeElementContribution& c,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -226,7 +226,9 @@ namespace mtest {
     // radial position of the fourth node
     const auto r3 = r0 + dr;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
+    c.setElement(3 * i, 4, n);
+    auto& k = c.k;
+    auto& r = c.r;
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     // loop over Gauss point
@@ -289,6 +291,6 @@ namespace mtest {
       }
     }  // loop over gauss point
     return {true, r_dt};
-  }
+  }  // end of updateStiffnessMatrixAndInnerForces
 
 }  // end of namespace mtest
@@ -0,0 +1,66 @@
+/*!
+ * \file   PipeElementContribution.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <algorithm>
+#include "MTest/BorderedBandedMatrix.hxx"
+#include "MTest/PipeElementContribution.hxx"
+
+namespace mtest {
+
+  void PipeElementContribution::setElement(const size_type f,
+                                           const size_type nn,
+                                           const size_type a) {
+    const auto n = nn + 1;
+    this->k.numbering = Numbering{f, nn, a};
+    this->r.numbering = Numbering{f, nn, a};
+    this->k.values.resize(n * n);
+    this->r.values.resize(n);
+    std::fill(this->k.values.begin(), this->k.values.end(), real(0));
+    std::fill(this->r.values.begin(), this->r.values.end(), real(0));
+  }  // end of setElement
+
+  template <typename MatrixType>
+  void PipeElementContribution::assemble2(MatrixType& gk,
+                                          tfel::math::vector<real>& gr,
+                                          const bool bk) const {
+    const auto& nb = this->r.numbering;
+    const auto n = nb.nnodes + 1;
+    auto global_index = [&nb](const size_type i) {
+      return (i == nb.nnodes) ? nb.axial : nb.first + i;
+    };
+    for (size_type i = 0; i != n; ++i) {
+      gr[global_index(i)] += this->r.values[i];
+    }
+    if (!bk) {
+      return;
+    }
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        gk(global_index(i), global_index(j)) += this->k.values[i * n + j];
+      }
+    }
+  }  // end of assemble2
+
+  void PipeElementContribution::assemble(tfel::math::matrix<real>& gk,
+                                         tfel::math::vector<real>& gr,
+                                         const bool bk) const {
+    this->assemble2(gk, gr, bk);
+  }  // end of assemble
+
+  void PipeElementContribution::assemble(BorderedBandedMatrix& gk,
+                                         tfel::math::vector<real>& gr,
+                                         const bool bk) const {
+    this->assemble2(gk, gr, bk);
+  }  // end of assemble
+
+}  // end of namespace mtest
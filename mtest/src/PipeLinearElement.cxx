@@ -30,7 +30,7 @@ namespace mtest {
   }  // end of PipeLinearElement::interpolate
 
   void PipeLinearElement::setGaussPointsPositions(StructureCurrentState& scs,
-                                                  const PipeMesh& m) {
+                 const PipeMesh& m) {
     // number of elements
     const auto ne = size_t(m.number_of_elements);
     // inner radius
@@ -100,10 +100,10 @@ namespace mtest {
   }  // end of computeIntegralValue
 
   void PipeLinearElement::computeStrain(StructureCurrentState& scs,
-                                        const PipeMesh& m,
-                                        const tfel::math::vector<real>& u,
-                                        const size_t i,
-                                        const bool b) {
+       const PipeMesh& m,
+       const tfel::math::vector<real>& u,
+       const size_t i,
+       const bool b) {
     // number of elements
     const auto ne = size_t(m.number_of_elements);
     // inner radius
@@ -139,9 +139,9 @@ namespace mtest {
   }  // end of PipeLinearElement::computeStrain
 
   std::pair<bool, real> PipeLinearElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+      PipeElementContribution& c,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -167,7 +167,9 @@ namespace mtest {
     // jacobian of the transformation
     const auto J = dr / 2;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
+    c.setElement(i, 2, n);
+    auto& k = c.k;
+    auto& r = c.r;
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     auto r_dt = real{};
@@ -233,6 +235,6 @@ namespace mtest {
       }
     }
     return {true, r_dt};
-  }
+  }  // end of updateStiffnessMatrixAndInnerForces
 
 }  // end of namespace mtest
@@ -12,6 +12,7 @@
  */
 
 #include <ostream>
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/PipeProfile.hxx"
 
@@ -33,6 +34,17 @@ namespace mtest {
     }
   }
 
+  void PipeStressProfile::report(tfel::utilities::BinaryColumnarFileWriter& w,
+                                 const CurrentState& s) const {
+    if (all) {
+      w.write(s.s1[0]);
+      w.write(s.s1[1]);
+      w.write(s.s1[2]);
+    } else {
+      w.write(s.s1[this->c]);
+    }
+  }
+
   PipeStressProfile::~PipeStressProfile() = default;
 
   PipeStrainProfile::PipeStrainProfile() : all(true), c(0u) {}
@@ -49,6 +61,17 @@ namespace mtest {
     }
   }
 
+  void PipeStrainProfile::report(tfel::utilities::BinaryColumnarFileWriter& w,
+                                 const CurrentState& s) const {
+    if (all) {
+      w.write(s.e1[0]);
+      w.write(s.e1[1]);
+      w.write(s.e1[2]);
+    } else {
+      w.write(s.e1[this->c]);
+    }
+  }
+
   PipeStrainProfile::~PipeStrainProfile() = default;
 
   PipeInternalStateVariableProfile::PipeInternalStateVariableProfile()
@@ -72,6 +95,18 @@ namespace mtest {
     }
   }
 
+  void PipeInternalStateVariableProfile::report(
+      tfel::utilities::BinaryColumnarFileWriter& w,
+      const CurrentState& s) const {
+    if (all) {
+      for (const auto v : s.iv1) {
+        w.write(v);
+      }
+    } else {
+      w.write(s.iv1[this->c]);
+    }
+  }
+
   PipeInternalStateVariableProfile::~PipeInternalStateVariableProfile() =
       default;
 
@@ -62,15 +62,15 @@ namespace mtest {
   }  // end of computeIntegralValue
 
   real PipeQuadraticElement::interpolate(const real v0,
-                                         const real v1,
-                                         const real v2,
-                                         const real x) {
+        const real v1,
+        const real v2,
+        const real x) {
     return (-(1. - x) * x * v0 + (1 + x) * x * v2) / 2 +
            (1. + x) * (1. - x) * v1;
   }  // end of PipeQuadraticElement::interpolate
 
   void PipeQuadraticElement::setGaussPointsPositions(StructureCurrentState& scs,
-                                                     const PipeMesh& m) {
+                    const PipeMesh& m) {
     // number of elements
     const auto ne = size_t(m.number_of_elements);
     // inner radius
@@ -99,10 +99,10 @@ namespace mtest {
   }
 
   void PipeQuadraticElement::computeStrain(StructureCurrentState& scs,
-                                           const PipeMesh& m,
-                                           const tfel::math::vector<real>& u,
-                                           const size_t i,
-                                           const bool b) {
+          const PipeMesh& m,
+          const tfel::math::vector<real>& u,
+          const size_t i,
+          const bool b) {
     // number of elements
     const auto ne = size_t(m.number_of_elements);
     // number of nodes
@@ -147,9 +147,9 @@ namespace mtest {
 
   std::pair<bool, real>
   PipeQuadraticElement::updateStiffnessMatrixAndInnerForces(
-      tfel::math::matrix<real>& k,
-      tfel::math::vector<real>& r,
+      PipeElementContribution& c,
       StructureCurrentState& scs,
+      BehaviourWorkSpace& bwk,
       const Behaviour& b,
       const tfel::math::vector<real>& u1,
       const PipeMesh& m,
@@ -175,7 +175,9 @@ namespace mtest {
     // radial position of the thrid node
     const auto r2 = r0 + dr;
     /* inner forces */
-    auto& bwk = scs.getBehaviourWorkSpace();
+    c.setElement(2 * i, 3, n);
+    auto& k = c.k;
+    auto& r = c.r;
     // compute the strain
     computeStrain(scs, m, u1, i, true);
     auto r_dt = real{};
@@ -241,6 +243,6 @@ namespace mtest {
       }
     }  // loop over gauss point
     return {true, r_dt};
-  }
+  }  // end of updateStiffnessMatrixAndInnerForces
 
 }  // end of namespace mtest
@@ -12,24 +12,28 @@
  */
 
 #include <memory>
+#include <future>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
 
 #include "TFEL/Raise.hxx"
 #include "TFEL/Math/General/IEEE754.hxx"
-#include "TFEL/Math/LUSolve.hxx"
+#include "TFEL/System/ThreadPool.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/RoundingMode.hxx"
 #include "MTest/Evolution.hxx"
 #include "MTest/SolverWorkSpace.hxx"
 #include "MTest/Behaviour.hxx"
+#include "MTest/BehaviourWorkSpace.hxx"
 #include "MTest/CurrentState.hxx"
 #include "MTest/StudyCurrentState.hxx"
 #include "MTest/StructureCurrentState.hxx"
 #include "MTest/GenericSolver.hxx"
 #include "MTest/GasEquationOfState.hxx"
+#include "MTest/PipeElementContribution.hxx"
 #include "MTest/PipeLinearElement.hxx"
 #include "MTest/PipeQuadraticElement.hxx"
 #include "MTest/PipeCubicElement.hxx"
@@ -373,6 +377,19 @@ namespace mtest {
                  "number of elements", r, false);
   }  // end of setNumberOfElements
 
+  void PipeTest::setNumberOfThreads(const int n) {
+    tfel::raise_if(n <= 0,
+                   "PipeTest::setNumberOfThreads: "
+                   "invalid number of threads (" +
+                       std::to_string(n) + ")");
+    if (n == 1) {
+      this->pool.reset();
+    } else {
+      this->pool = std::make_shared<tfel::system::ThreadPool>(
+          static_cast<tfel::system::ThreadPool::size_type>(n));
+    }
+  }  // end of setNumberOfThreads
+
   const PipeMesh& PipeTest::getMesh() const { return this->mesh; }
 
   template <typename T>
@@ -507,7 +524,22 @@ namespace mtest {
           std::make_shared<OxidationStatusEvolution>(this->mesh, *(this->evm));
       this->addEvolution("OxidationStatus", this->oxidation_status_evolution,
                          true, true);
+      // the evolutions have been modified
+      this->bindEvolutions();
     }
+    auto bind_oxidation_model_evolutions = [this](OxidationModel& m) {
+      if (m.model == nullptr) {
+        return;
+      }
+      m.material_properties = EvolutionBindingTable(
+          m.model->getMaterialPropertiesNames(), *(this->evm),
+          *(m.default_material_properties), "material property");
+      m.external_state_variables = EvolutionBindingTable(
+          m.model->expandExternalStateVariablesNames(), *(this->evm),
+          "external state variable");
+    };
+    bind_oxidation_model_evolutions(this->inner_boundary_oxidation_model);
+    bind_oxidation_model_evolutions(this->outer_boundary_oxidation_model);
     //
     if (this->options.eeps < 0) {
       this->options.eeps = 1.e-11;
@@ -584,7 +616,42 @@ namespace mtest {
                      "PipeTest::completeInitialisation: "
                      "filling temperature not set");
     }
-    if (this->out) {
+    for (auto& pr : this->profiles) {
+      if ((pr.out == nullptr) && (pr.bout == nullptr)) {
+        this->openProfile(pr);
+      }
+    }
+    if (this->useBinaryOutputFiles()) {
+      auto n = std::vector<std::string>{
+          "time",                    "InnerRadius",
+          "OuterRadius",             "InnerRadiusDisplacement",
+          "OuterRadiusDisplacement", "AxialDisplacement"};
+      if ((this->rl == IMPOSEDOUTERRADIUS) ||
+          (this->rl == IMPOSEDINNERRADIUS) || (this->rl == TIGHTPIPE) ||
+          (this->mandrel_radius_evolution != nullptr)) {
+        n.push_back("InnerPressure");
+      }
+      if ((this->al == IMPOSEDAXIALGROWTH) ||
+          (this->mandrel_axial_growth_evolution != nullptr)) {
+        n.push_back("AxialForce");
+      }
+      if (this->mandrel_radius_evolution != nullptr) {
+        n.push_back("MandrelContactIndicator");
+      }
+      for (const auto& ao : this->aoutputs) {
+        n.push_back(ao.d);
+      }
+      if (this->inner_boundary_oxidation_model.model != nullptr) {
+        n.push_back("InnerBoundaryOxidationLength");
+      }
+      if (this->outer_boundary_oxidation_model.model != nullptr) {
+        n.push_back("OuterBoundaryOxidationLength");
+      }
+      for (const auto& fc : this->failure_criteria) {
+        n.push_back(fc->getName() + "Status");
+      }
+      this->openBinaryOutputFile(n);
+    } else if (this->out) {
       auto c = 7u;
       this->out << "# first  column : time\n"
                    "# second column : inner radius\n"
@@ -865,6 +932,10 @@ namespace mtest {
                            std::shared_ptr<Evolution>(new LPIEvolution(
                                {*pt, *pt2}, {real(0), real(0)})));
       }
+      // restart, if requested
+      const auto r = this->readCheckpoint(state);
+      pt += static_cast<std::ptrdiff_t>(r);
+      pt2 += static_cast<std::ptrdiff_t>(r);
       this->printOutput(*pt, state, true);
       // real work begins here
       while (pt2 != this->times.end()) {
@@ -873,16 +944,19 @@ namespace mtest {
         this->printOutput(*pt2, state, true);
         ++pt;
         ++pt2;
+        this->writeCheckpoint(
+            static_cast<std::size_t>(pt - this->times.begin()), state);
       }
     } catch (std::exception& e) {
-      this->out.flush();
+      this->flushOutputFiles();
       report(e.what(), state, false);
       throw;
     } catch (...) {
-      this->out.flush();
+      this->flushOutputFiles();
       report(nullptr, state, false);
       throw;
     }
+    this->flushOutputFiles();
     report(nullptr, state, true);
     tfel::tests::TestResult tr;
     for (const auto& t : this->tests) {
@@ -932,14 +1006,26 @@ namespace mtest {
     const auto psz = this->getNumberOfUnknowns();
     // clear
     wk.K.clear();
+    wk.Kb.clear();
     wk.p_lu.clear();
     wk.x.clear();
     wk.r.clear();
     wk.du.clear();
-    // resizing
-    wk.K.resize(psz, psz);
-    wk.p_lu.resize(psz);
-    wk.x.resize(psz);
+    // resizing. The radial displacements of a node are only coupled to
+    // the ones of the nodes of the same elements and the axial strain
+    // is the last unknown, so the stiffness matrix is stored as a
+    // bordered banded matrix whose half bandwidth is the number of
+    // nodes per element minus one.
+    const auto hw = [this]() -> size_type {
+      if (this->mesh.etype == PipeMesh::QUADRATIC) {
+        return 2;
+      } else if (this->mesh.etype == PipeMesh::CUBIC) {
+        return 3;
+      }
+      return 1;
+    }();
+    wk.storage = SolverWorkSpace::BORDEREDBANDED;
+    wk.Kb.resize(psz, hw);
     wk.r.resize(psz, 0.);
     wk.du.resize(psz, 0.);
   }  // end of initializeWorkSpace
@@ -974,12 +1060,8 @@ namespace mtest {
       }
       auto& cs = scs.getModelCurrentState(*(m.model));
       setCurrentPosition(*(this->evm), position);
-      computeMaterialProperties(cs, *(this->evm),
-                                *(m.default_material_properties),
-                                m.model->getMaterialPropertiesNames(), t, dt);
-      computeExternalStateVariables(
-          cs, *(this->evm), m.model->expandExternalStateVariablesNames(), t,
-          dt);
+      computeMaterialProperties(cs, m.material_properties, t, dt);
+      computeExternalStateVariables(cs, m.external_state_variables, t, dt);
       return m.model->integrate(cs, scs.getModelWorkSpace(*(m.model)), dt,
                                 StiffnessMatrixType::NOSTIFFNESS);
     };
@@ -1055,6 +1137,23 @@ namespace mtest {
     return {false, 1};
   }  // end of PipeTest
 
+  /*!
+   * \brief set all the values of a dense stiffness matrix to zero
+   * \param[out] k: stiffness matrix
+   */
+  static void resetStiffnessMatrix(tfel::math::matrix<real>& k) {
+    std::fill(k.begin(), k.end(), real(0));
+  }  // end of resetStiffnessMatrix
+
+  /*!
+   * \brief set all the values of a bordered banded stiffness matrix
+   * to zero
+   * \param[out] k: stiffness matrix
+   */
+  static void resetStiffnessMatrix(BorderedBandedMatrix& k) {
+    k.zero();
+  }  // end of resetStiffnessMatrix
+
   std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidual(
       StudyCurrentState& state,
       tfel::math::matrix<real>& k,
@@ -1062,6 +1161,31 @@ namespace mtest {
       const real t,
       const real dt,
       const StiffnessMatrixType mt) const {
+    return this->assembleStiffnessMatrixAndResidual(state, k, r, t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  std::pair<bool, real> PipeTest::computeStiffnessMatrixAndResidual(
+      StudyCurrentState& state,
+      SolverWorkSpace& wk,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    if (wk.storage == SolverWorkSpace::BORDEREDBANDED) {
+      return this->assembleStiffnessMatrixAndResidual(state, wk.Kb, wk.r, t,
+                                                      dt, mt);
+    }
+    return this->assembleStiffnessMatrixAndResidual(state, wk.K, wk.r, t, dt,
+                                                    mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
+  template <typename MatrixType>
+  std::pair<bool, real> PipeTest::assembleStiffnessMatrixAndResidual(
+      StudyCurrentState& state,
+      MatrixType& k,
+      tfel::math::vector<real>& r,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
     using LE = PipeLinearElement;
     using QE = PipeQuadraticElement;
     using CE = PipeCubicElement;
@@ -1069,7 +1193,7 @@ namespace mtest {
     // reset r and k
     std::fill(r.begin(), r.end(), real(0));
     if (mt != StiffnessMatrixType::NOSTIFFNESS) {
-      std::fill(k.begin(), k.end(), real(0));
+      resetStiffnessMatrix(k);
     }
     // current pipe state
     auto& scs = state.getStructureCurrentState("");
@@ -1234,34 +1358,84 @@ namespace mtest {
         r(n) -= state.getEvolution("AxialForce")(t + dt);
       }
     }
-    // loop over the elements
-    auto r_dt = real{};
-    for (size_type i = 0; i != ne; ++i) {
-      auto ri = std::pair<bool, real>{};
+    // integration of the behaviour over the ith element
+    auto integrate = [this, &state, &scs, dt, mt](PipeElementContribution& c,
+                                                  BehaviourWorkSpace& bwk,
+                                                  const size_type i) {
       if (this->mesh.etype == PipeMesh::LINEAR) {
-        ri = LE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
+        return LE::updateStiffnessMatrixAndInnerForces(
+            c, scs, bwk, *(this->b), state.u1, this->mesh, dt, mt, i);
       } else if (this->mesh.etype == PipeMesh::QUADRATIC) {
-        ri = QE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
-      } else if (this->mesh.etype == PipeMesh::CUBIC) {
-        ri = CE::updateStiffnessMatrixAndInnerForces(
-            k, r, scs, *(this->b), state.u1, this->mesh, dt, mt, i);
-      } else {
+        return QE::updateStiffnessMatrixAndInnerForces(
+            c, scs, bwk, *(this->b), state.u1, this->mesh, dt, mt, i);
+      } else if (this->mesh.etype != PipeMesh::CUBIC) {
         tfel::raise(
             "PipeTest::computeStiffnessMatrixAndResidual: "
             "unknown element type");
       }
-      if (i == 0) {
-        r_dt = ri.second;
+      return CE::updateStiffnessMatrixAndInnerForces(
+          c, scs, bwk, *(this->b), state.u1, this->mesh, dt, mt, i);
+    };
+    // the contributions of the elements are assembled in a fixed order,
+    // so that the results do not depend on the number of threads.
+    auto r_dt = real{};
+    auto assemble = [&k, &r, &r_dt, mt](const PipeElementContribution& c,
+                                        const std::pair<bool, real>& ri,
+                                        const size_type i) {
+      r_dt = (i == 0) ? ri.second : std::min(r_dt, ri.second);
+      if (ri.first) {
+        c.assemble(k, r, mt != StiffnessMatrixType::NOSTIFFNESS);
+      }
+      return ri.first;
+    };
+    if ((this->pool == nullptr) || (ne < 2)) {
+      auto c = PipeElementContribution{};
+      auto& bwk = scs.getBehaviourWorkSpace();
+      for (size_type i = 0; i != ne; ++i) {
+        if (!assemble(c, integrate(c, bwk, i), i)) {
+          return {false, r_dt};
+        }
+      }
+      return {true, r_dt};
+    }
+    // parallel integration. Each thread treats a contiguous range of
+    // elements with its own behaviour workspace.
+    const auto nth = std::min(ne, this->pool->getNumberOfThreads());
+    auto contributions = std::vector<PipeElementContribution>(ne);
+    auto results = std::vector<std::pair<bool, real>>(ne, {true, real(1)});
+    auto tasks =
+        std::vector<std::future<tfel::system::ThreadedTaskResult<void>>>{};
+    tasks.reserve(nth);
+    for (size_type w = 0; w != nth; ++w) {
+      auto& bwk = scs.getBehaviourWorkSpace(w);
+      const auto eb = (ne * w) / nth;
+      const auto ee = (ne * (w + 1)) / nth;
+      tasks.push_back(this->pool->addTask(
+          [&integrate, &contributions, &results, &bwk, eb, ee] {
+            for (auto i = eb; i != ee; ++i) {
+              results[i] = integrate(contributions[i], bwk, i);
+              if (!results[i].first) {
+                return;
+              }
+            }
+          }));
+    }
+    auto exceptions = std::vector<tfel::system::ThreadedTaskResult<void>>{};
+    for (auto& task : tasks) {
+      exceptions.push_back(task.get());
+    }
+    for (auto& e : exceptions) {
+      if (!e) {
+        e.rethrow();
       }
-      r_dt = std::min(r_dt, ri.second);
-      if (!ri.first) {
+    }
+    for (size_type i = 0; i != ne; ++i) {
+      if (!assemble(contributions[i], results[i], i)) {
         return {false, r_dt};
       }
     }
     return {true, r_dt};
-  }  // end of computeStiffnessMatrixAndResidual
+  }  // end of assembleStiffnessMatrixAndResidual
 
   void PipeTest::checkBehaviourConsistency(
       const std::shared_ptr<Behaviour>& bp) {
@@ -1531,7 +1705,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      backSubstitute(wk, du);
       setRoundingMode();
       const real due_dp = *(du.rbegin() + 1);
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1554,7 +1728,7 @@ namespace mtest {
         du(n) += pi * Ri_ * Ri_;
       }
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      backSubstitute(wk, du);
       setRoundingMode();
       const real du_dp = du[0];
       auto& Pi = state.getEvolution("InnerPressure");
@@ -1580,7 +1754,7 @@ namespace mtest {
       std::fill(du.begin(), du.end(), real(0));
       du(n) = 1;
       setRoundingMode();
-      tfel::math::LUSolve::back_substitute(wk.K, du, wk.x, wk.p_lu);
+      backSubstitute(wk, du);
       setRoundingMode();
       const real dezz_dF = du(n);
       auto& F = state.getEvolution("AxialForce");
@@ -1646,6 +1820,18 @@ namespace mtest {
     // current pipe state
     auto& scs = state.getStructureCurrentState("");
     for (const auto& pr : this->profiles) {
+      if (pr.bout != nullptr) {
+        for (size_type i = 0; i != getNumberOfGaussPoints(this->mesh); ++i) {
+          const auto& s = scs.istates[i];
+          pr.bout->write(t + dt);
+          pr.bout->write(s.position);
+          for (const auto& pp : pr.profiles) {
+            pp->report(*(pr.bout), s);
+          }
+          pr.bout->endRow();
+        }
+        continue;
+      }
       *(pr.out) << "#Time " << t + dt << '\n';
       // loop over the elements
       for (size_type i = 0; i != getNumberOfGaussPoints(this->mesh); ++i) {
@@ -1689,40 +1875,40 @@ namespace mtest {
     if (t == "minimum_value") {
       this->aoutputs.push_back(
           {"minimum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMinimumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMinimumValue(s, n);
            }});
     } else if (t == "maximum_value") {
       this->aoutputs.push_back(
           {"maximum value of '" + n + "'",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMaximumValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMaximumValue(s, n);
            }});
     } else if (t == "integral_value_initial_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(s, n);
            }});
     } else if (t == "integral_value_current_configuration") {
       this->aoutputs.push_back(
           {"integral value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeIntegralValue(
+           [this, n](const StudyCurrentState& s) {
+             return this->computeIntegralValue(
                  s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else if (t == "mean_value_initial_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the initial configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(s, n);
            }});
     } else if (t == "mean_value_current_configuration") {
       this->aoutputs.push_back(
           {"mean value of '" + n + "' in the current configuration",
-           [this, n](std::ostream& os, const StudyCurrentState& s) {
-             os << this->computeMeanValue(s, n,
-                                          Configuration::CURRENT_CONFIGURATION);
+           [this, n](const StudyCurrentState& s) {
+             return this->computeMeanValue(
+                 s, n, Configuration::CURRENT_CONFIGURATION);
            }});
     } else {
       tfel::raise(
@@ -1918,37 +2104,20 @@ namespace mtest {
   void PipeTest::addProfile(const std::string& f,
                             const std::vector<std::string>& cn) {
     auto ph = PipeProfileHandler{};
-    ph.out = std::make_shared<std::ofstream>(f);
-    tfel::raise_if(!(*(ph.out)),
-                   "PipeTest::addProfile: "
-                   "can't open file '" +
-                       f + "'");
-    ph.out->exceptions(std::ofstream::failbit | std::ofstream::badbit);
-    if (this->oprec != -1) {
-      ph.out->precision(static_cast<std::streamsize>(this->oprec));
-    }
-    *(ph.out) << "#First column: radial position\n";
-    auto i = 1;
+    ph.file = f;
+    ph.names = cn;
     for (const auto& c : cn) {
-      ++i;
-      *(ph.out) << "#Column " << i << ": ";
       if (c == "SRR") {
-        *(ph.out) << "radial stress \n";
         ph.profiles.emplace_back(std::make_shared<PipeStressProfile>(0u));
       } else if (c == "STT") {
-        *(ph.out) << "hoop stress \n";
         ph.profiles.emplace_back(std::make_shared<PipeStressProfile>(2u));
       } else if (c == "SZZ") {
-        *(ph.out) << "axial stress \n";
         ph.profiles.emplace_back(std::make_shared<PipeStressProfile>(1u));
       } else if (c == "ERR") {
-        *(ph.out) << "radial strain \n";
         ph.profiles.emplace_back(std::make_shared<PipeStrainProfile>(0u));
       } else if (c == "ETT") {
-        *(ph.out) << "hoop strain \n";
         ph.profiles.emplace_back(std::make_shared<PipeStrainProfile>(2u));
       } else if (c == "EZZ") {
-        *(ph.out) << "axial strain \n";
         ph.profiles.emplace_back(std::make_shared<PipeStrainProfile>(1u));
       } else {
         const auto piv =
@@ -1957,15 +2126,71 @@ namespace mtest {
                        "PipeTest::addProfile: "
                        "no internal state variable named '" +
                            c + "'");
-        *(ph.out) << c << " internal state variable\n";
         auto pos = size_type(piv - this->ivfullnames.begin());
         ph.profiles.emplace_back(
             std::make_shared<PipeInternalStateVariableProfile>(pos));
       }
     }
+    // the output file format is only known at the end of the
+    // initialisation
+    if (this->initialisationFinished) {
+      this->openProfile(ph);
+    }
     this->profiles.push_back(ph);
   }  // end of addProfile
 
+  void PipeTest::openProfile(PipeProfileHandler& ph) const {
+    if (this->useBinaryOutputFiles()) {
+      auto n = std::vector<std::string>{"time", "r"};
+      n.insert(n.end(), ph.names.begin(), ph.names.end());
+      ph.bout = this->makeBinaryColumnarFileWriter(ph.file, n);
+      return;
+    }
+    auto os = std::make_shared<std::ofstream>(ph.file);
+    tfel::raise_if(!(*os),
+                   "PipeTest::openProfile: "
+                   "can't open file '" +
+                       ph.file + "'");
+    os->exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    if (this->oprec != -1) {
+      os->precision(static_cast<std::streamsize>(this->oprec));
+    }
+    *os << "#First column: radial position\n";
+    auto i = 1;
+    for (const auto& c : ph.names) {
+      ++i;
+      *os << "#Column " << i << ": ";
+      if (c == "SRR") {
+        *os << "radial stress \n";
+      } else if (c == "STT") {
+        *os << "hoop stress \n";
+      } else if (c == "SZZ") {
+        *os << "axial stress \n";
+      } else if (c == "ERR") {
+        *os << "radial strain \n";
+      } else if (c == "ETT") {
+        *os << "hoop strain \n";
+      } else if (c == "EZZ") {
+        *os << "axial strain \n";
+      } else {
+        *os << c << " internal state variable\n";
+      }
+    }
+    ph.out = os;
+  }  // end of openProfile
+
+  void PipeTest::flushOutputFiles() const {
+    SchemeBase::flushOutputFiles();
+    for (const auto& pr : this->profiles) {
+      if (pr.out != nullptr) {
+        pr.out->flush();
+      }
+      if (pr.bout != nullptr) {
+        pr.bout->flush();
+      }
+    }
+  }  // end of flushOutputFiles
+
   void PipeTest::setModellingHypothesis(const std::string& h) {
     tfel::raise_if(h != "AxisymmetricalGeneralisedPlaneStrain",
                    "PipeTest::setModellingHypothesis: "
@@ -2141,6 +2366,10 @@ namespace mtest {
     if ((!o) && (this->output_frequency == USERDEFINEDTIMES)) {
       return;
     }
+    if (this->boutput != nullptr) {
+      this->printBinaryOutput(t, state);
+      return;
+    }
     if (!this->out) {
       return;
     }
@@ -2173,8 +2402,7 @@ namespace mtest {
       }
     }
     for (const auto& ao : this->aoutputs) {
-      this->out << " ";
-      ao.f(out, state);
+      this->out << " " << ao.f(state);
     }
     if (this->inner_boundary_oxidation_model.model != nullptr) {
       this->out << getOxidationLength(state,
@@ -2190,6 +2418,49 @@ namespace mtest {
     this->out << '\n';
   }  // end of printOutput
 
+  void PipeTest::printBinaryOutput(const real t,
+                                   const StudyCurrentState& state) const {
+    auto& w = *(this->boutput);
+    const auto& u1 = state.u1;
+    const auto n = this->getNumberOfNodes();
+    w.write(t);
+    w.write(this->mesh.inner_radius + u1[0]);
+    w.write(this->mesh.outer_radius + u1[n - 1]);
+    w.write(u1[0]);
+    w.write(u1[n - 1]);
+    w.write(u1[n]);
+    if ((this->rl == IMPOSEDOUTERRADIUS) || (this->rl == IMPOSEDINNERRADIUS) ||
+        (this->rl == TIGHTPIPE) ||
+        (this->mandrel_radius_evolution != nullptr)) {
+      w.write(state.getEvolution("InnerPressure")(t));
+    }
+    if ((this->al == IMPOSEDAXIALGROWTH) ||
+        (this->mandrel_axial_growth_evolution != nullptr)) {
+      w.write(state.getEvolution("AxialForce")(t));
+    }
+    if (this->mandrel_radius_evolution != nullptr) {
+      const auto c =
+          state.containsParameter("MandrelContactStateAtEndOfTimeStep") &&
+          state.getParameter<bool>("MandrelContactStateAtEndOfTimeStep");
+      w.write(c ? 1 : 0);
+    }
+    for (const auto& ao : this->aoutputs) {
+      w.write(ao.f(state));
+    }
+    if (this->inner_boundary_oxidation_model.model != nullptr) {
+      w.write(
+          getOxidationLength(state, this->inner_boundary_oxidation_model));
+    }
+    if (this->outer_boundary_oxidation_model.model != nullptr) {
+      w.write(
+          getOxidationLength(state, this->outer_boundary_oxidation_model));
+    }
+    for (std::size_t i = 0; i != this->failure_criteria.size(); ++i) {
+      w.write(state.getFailureCriterionStatus(i) ? 1 : 0);
+    }
+    w.endRow();
+  }  // end of printBinaryOutput
+
   PipeTest::~PipeTest() = default;
 
 }  // end of namespace mtest
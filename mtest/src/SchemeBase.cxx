@@ -11,18 +11,31 @@
  * project under specific licensing conditions.
  */
 
+#include <cmath>
+#include <cstdio>
+#include <limits>
 #include <sstream>
 #include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
 #include "MFront/MFrontLogStream.hxx"
 #include "MTest/AccelerationAlgorithmFactory.hxx"
 #include "MTest/CastemAccelerationAlgorithm.hxx"
 #include "MTest/Evolution.hxx"
+#include "MTest/StudyCurrentState.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/SchemeBase.hxx"
 
 namespace mtest {
 
+  //! \brief magic number identifying checkpoint files
+  static constexpr long unsigned int checkpoint_file_magic = 0x54504b434d54;
+  //! \brief version of the format of checkpoint files
+  static constexpr unsigned int checkpoint_file_version = 1;
+
   SchemeBase::SchemeBase() : evm(new EvolutionManager()) {
     // declare time variable
     this->declareVariable("t", true);
@@ -71,6 +84,10 @@ namespace mtest {
     this->times = t;
   }  // end of SchemeBase::setTimes
 
+  const std::vector<real>& SchemeBase::getTimes() const {
+    return this->times;
+  }  // end of SchemeBase::getTimes
+
   void SchemeBase::setMaximumNumberOfIterations(const unsigned int i) {
     tfel::raise_if(this->options.iterMax != -1,
                    "SchemeBase::setMaximumNumberOfIterations: "
@@ -312,7 +329,16 @@ namespace mtest {
 
   void SchemeBase::resetOutputFile() {
     // output file
-    if (!this->output.empty()) {
+    if ((!this->output.empty()) && (this->useBinaryOutputFiles())) {
+      this->out.close();
+      // the text output file is not used
+      this->out.setstate(std::ios::badbit);
+      this->boutput.reset();
+      if (!this->boutput_columns.empty()) {
+        this->boutput = this->makeBinaryColumnarFileWriter(
+            this->output, this->boutput_columns);
+      }
+    } else if (!this->output.empty()) {
       this->out.close();
       this->out.open(this->output.c_str());
       tfel::raise_if(!this->out,
@@ -401,6 +427,10 @@ namespace mtest {
           log << "** no prediction\n";
         }
       }
+      tfel::raise_if((this->checkpoint_frequency != 0) &&
+                         (this->checkpoint_file.empty()),
+                     "SchemeBase::completeInitialisation: "
+                     "no checkpoint file defined");
       this->resetOutputFile();
     } catch (...) {
       this->initialisationFinished = false;
@@ -445,6 +475,42 @@ namespace mtest {
     this->oprec = static_cast<int>(p);
   }
 
+  void SchemeBase::setOutputFileFormat(const OutputFileFormat f) {
+    this->output_file_format = f;
+  }  // end of setOutputFileFormat
+
+  bool SchemeBase::useBinaryOutputFiles() const {
+    return this->output_file_format != TEXTFILEFORMAT;
+  }  // end of useBinaryOutputFiles
+
+  std::shared_ptr<tfel::utilities::BinaryColumnarFileWriter>
+  SchemeBase::makeBinaryColumnarFileWriter(
+      const std::string& f, const std::vector<std::string>& n) const {
+    auto o = tfel::utilities::BinaryColumnarFileWriter::Options{};
+    o.use_single_precision =
+        this->output_file_format == SINGLEPRECISIONBINARYFILEFORMAT;
+    return std::make_shared<tfel::utilities::BinaryColumnarFileWriter>(f, n,
+                                                                       o);
+  }  // end of makeBinaryColumnarFileWriter
+
+  void SchemeBase::openBinaryOutputFile(const std::vector<std::string>& n) {
+    tfel::raise_if(!this->useBinaryOutputFiles(),
+                   "SchemeBase::openBinaryOutputFile: "
+                   "the output file format is not binary");
+    if (this->output.empty()) {
+      return;
+    }
+    this->boutput_columns = n;
+    this->boutput = this->makeBinaryColumnarFileWriter(this->output, n);
+  }  // end of openBinaryOutputFile
+
+  void SchemeBase::flushOutputFiles() const {
+    this->out.flush();
+    if (this->boutput != nullptr) {
+      this->boutput->flush();
+    }
+  }  // end of flushOutputFiles
+
   void SchemeBase::setResidualFileName(const std::string& o) {
     tfel::raise_if(!this->residualFileName.empty(),
                    "SchemeBase::setResidualFileName : "
@@ -481,6 +547,138 @@ namespace mtest {
     return this->xmlFileName;
   }
 
+  void SchemeBase::setCheckpointFrequency(const unsigned int n) {
+    tfel::raise_if(n == 0,
+                   "SchemeBase::setCheckpointFrequency: "
+                   "invalid checkpoint frequency");
+    this->checkpoint_frequency = n;
+  }  // end of setCheckpointFrequency
+
+  void SchemeBase::setCheckpointFileName(const std::string& f) {
+    tfel::raise_if(!this->checkpoint_file.empty(),
+                   "SchemeBase::setCheckpointFileName: "
+                   "checkpoint file name already defined");
+    this->checkpoint_file = f;
+  }  // end of setCheckpointFileName
+
+  bool SchemeBase::isCheckpointFileNameDefined() const {
+    return !this->checkpoint_file.empty();
+  }  // end of isCheckpointFileNameDefined
+
+  void SchemeBase::setRestartFileName(const std::string& f) {
+    tfel::raise_if(!this->restart_file.empty(),
+                   "SchemeBase::setRestartFileName: "
+                   "restart file name already defined");
+    this->restart_file = f;
+  }  // end of setRestartFileName
+
+  void SchemeBase::writeCheckpoint(const std::size_t i,
+                                   const StudyCurrentState& s) const {
+    using tfel::system::binary_write;
+    if ((this->checkpoint_frequency == 0) ||
+        (i % this->checkpoint_frequency != 0)) {
+      return;
+    }
+    // the state is first written in a temporary file which is then
+    // renamed, so that a crash during the writing does not destroy the
+    // previous checkpoint
+    const auto tmp = this->checkpoint_file + ".tmp";
+    auto flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_BINARY
+    flags |= O_BINARY;
+#endif /* O_BINARY */
+    const auto f = ::open(tmp.c_str(), flags, 0644);
+    tfel::raise_if(f == -1,
+                   "SchemeBase::writeCheckpoint: "
+                   "can't open file '" +
+                       tmp + "'");
+    try {
+      binary_write(f, checkpoint_file_magic);
+      binary_write(f, checkpoint_file_version);
+      binary_write(f, std::vector<real>(
+                          this->times.begin(),
+                          this->times.begin() + static_cast<long>(i) + 1));
+      binary_write(f, s);
+      binary_write(f, this->options.aa != nullptr);
+      if (this->options.aa != nullptr) {
+        binary_write(f, this->options.aa->getName());
+        this->options.aa->writeHistory(f);
+      }
+      binary_write(f, checkpoint_file_magic);
+    } catch (...) {
+      ::close(f);
+      throw;
+    }
+    tfel::raise_if(::close(f) != 0,
+                   "SchemeBase::writeCheckpoint: "
+                   "can't close file '" +
+                       tmp + "'");
+    tfel::raise_if(std::rename(tmp.c_str(), this->checkpoint_file.c_str()) != 0,
+                   "SchemeBase::writeCheckpoint: "
+                   "can't rename file '" +
+                       tmp + "' to '" + this->checkpoint_file + "'");
+    if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
+      mfront::getLogStream() << "** checkpoint written in '"
+                             << this->checkpoint_file << "' at time "
+                             << this->times[i] << '\n';
+    }
+  }  // end of writeCheckpoint
+
+  std::size_t SchemeBase::readCheckpoint(StudyCurrentState& s) {
+    using tfel::system::binary_read;
+    if (this->restart_file.empty()) {
+      return 0;
+    }
+    auto throw_if = [this](const bool c, const std::string& m) {
+      tfel::raise_if(c, "SchemeBase::readCheckpoint: " + m + " (file '" +
+                            this->restart_file + "')");
+    };
+    auto flags = O_RDONLY;
+#ifdef O_BINARY
+    flags |= O_BINARY;
+#endif /* O_BINARY */
+    const auto f = ::open(this->restart_file.c_str(), flags);
+    throw_if(f == -1, "can't open file");
+    auto ptimes = std::vector<real>{};
+    try {
+      throw_if(binary_read<long unsigned int>(f) != checkpoint_file_magic,
+               "invalid checkpoint file");
+      throw_if(binary_read<unsigned int>(f) != checkpoint_file_version,
+               "unsupported version of the checkpoint file");
+      binary_read(f, ptimes);
+      // the times before the restart must not have been changed
+      throw_if(ptimes.empty() || (ptimes.size() > this->times.size()),
+               "unmatched list of times");
+      for (std::size_t i = 0; i != ptimes.size(); ++i) {
+        const auto eps =
+            10 * std::numeric_limits<real>::epsilon() *
+            std::max(std::abs(ptimes[i]), std::abs(this->times[i]));
+        throw_if(std::abs(ptimes[i] - this->times[i]) > eps,
+                 "unmatched list of times");
+      }
+      binary_read(f, s);
+      const auto baa = binary_read<bool>(f);
+      throw_if(baa != (this->options.aa != nullptr),
+               "unmatched acceleration algorithm");
+      if (baa) {
+        throw_if(binary_read<std::string>(f) != this->options.aa->getName(),
+                 "unmatched acceleration algorithm");
+        this->options.aa->readHistory(f);
+      }
+      throw_if(binary_read<long unsigned int>(f) != checkpoint_file_magic,
+               "invalid checkpoint file");
+    } catch (...) {
+      ::close(f);
+      throw;
+    }
+    ::close(f);
+    if (mfront::getVerboseMode() >= mfront::VERBOSE_LEVEL1) {
+      mfront::getLogStream() << "** restarting from '" << this->restart_file
+                             << "' at time " << ptimes.back() << '\n';
+    }
+    return ptimes.size() - 1;
+  }  // end of readCheckpoint
+
   SchemeBase::~SchemeBase() = default;
 
 }  // end of namespace mtest
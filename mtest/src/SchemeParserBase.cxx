@@ -389,6 +389,38 @@ namespace mtest {
                              this->tokens.end());
   }  // end of SchemeParserBase::handleOutputFrequency
 
+  void SchemeParserBase::handleOutputFileFormat(SchemeBase& t,
+                                                tokens_iterator& p) {
+    const auto v = this->readString(p, this->tokens.end());
+    if (v == "Text") {
+      t.setOutputFileFormat(SchemeBase::TEXTFILEFORMAT);
+    } else if (v == "Binary") {
+      t.setOutputFileFormat(SchemeBase::BINARYFILEFORMAT);
+    } else if (v == "BinaryFloat32") {
+      t.setOutputFileFormat(SchemeBase::SINGLEPRECISIONBINARYFILEFORMAT);
+    } else {
+      tfel::raise(
+          "SchemeParserBase::handleOutputFileFormat: "
+          "invalid format '" +
+          v + "'. Expected 'Text', 'Binary' or 'BinaryFloat32'");
+    }
+    this->readSpecifiedToken("SchemeParserBase::handleOutputFileFormat", ";",
+                             p, this->tokens.end());
+  }  // end of SchemeParserBase::handleOutputFileFormat
+
+  void SchemeParserBase::handleCheckpoint(SchemeBase& t, tokens_iterator& p) {
+    t.setCheckpointFrequency(this->readUnsignedInt(p, this->tokens.end()));
+    this->readSpecifiedToken("SchemeParserBase::handleCheckpoint", ";", p,
+                             this->tokens.end());
+  }  // end of SchemeParserBase::handleCheckpoint
+
+  void SchemeParserBase::handleCheckpointFile(SchemeBase& t,
+                                              tokens_iterator& p) {
+    t.setCheckpointFileName(this->readString(p, this->tokens.end()));
+    this->readSpecifiedToken("SchemeParserBase::handleCheckpointFile", ";", p,
+                             this->tokens.end());
+  }  // end of SchemeParserBase::handleCheckpointFile
+
   void SchemeParserBase::handleDynamicTimeStepScaling(SchemeBase& t,
                                                       tokens_iterator& p) {
     this->checkNotEndOfLine("SchemeParserBase::handleDynamicTimeStepScaling", p,
@@ -747,6 +779,9 @@ namespace mtest {
     add("@XMLOutputFile", &SchemeParserBase::handleXMLOutputFile);
     add("@OutputFrequency", &SchemeParserBase::handleOutputFrequency);
     add("@OutputFilePrecision", &SchemeParserBase::handleOutputFilePrecision);
+    add("@OutputFileFormat", &SchemeParserBase::handleOutputFileFormat);
+    add("@Checkpoint", &SchemeParserBase::handleCheckpoint);
+    add("@CheckpointFile", &SchemeParserBase::handleCheckpointFile);
     add("@ResidualFile", &SchemeParserBase::handleResidualFile);
     add("@ResidualFilePrecision",
         &SchemeParserBase::handleResidualFilePrecision);
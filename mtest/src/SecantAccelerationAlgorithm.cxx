@@ -17,6 +17,7 @@
 #include <algorithm>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/SecantAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -88,4 +89,26 @@ namespace mtest {
 
   SecantAccelerationAlgorithm::~SecantAccelerationAlgorithm() = default;
 
+  void SecantAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->sa_u0);
+    binary_write(f, this->sa_u1);
+    binary_write(f, this->sa_r0);
+    binary_write(f, this->sa_r1);
+    binary_write(f, this->sa_r);
+    binary_write(f, this->sa_dr);
+    binary_write(f, this->sa_w);
+  }  // end of writeHistory
+
+  void SecantAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->sa_u0);
+    binary_read(f, this->sa_u1);
+    binary_read(f, this->sa_r0);
+    binary_read(f, this->sa_r1);
+    binary_read(f, this->sa_r);
+    binary_read(f, this->sa_dr);
+    binary_read(f, this->sa_w);
+  }  // end of readHistory
+
 }  // end of namespace mtest
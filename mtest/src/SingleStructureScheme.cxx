@@ -226,8 +226,18 @@ namespace mtest {
                                                         *(this->evm));
     checkIfDeclared(mpnames, *(this->evm), *(this->dmpv), "material property");
     checkIfDeclared(esvnames, *(this->evm), "external state variable");
+    this->bindEvolutions();
   }  // end of completeInitialisation
 
+  void SingleStructureScheme::bindEvolutions() {
+    this->mpevolutions =
+        EvolutionBindingTable(this->b->getMaterialPropertiesNames(),
+                              *(this->evm), *(this->dmpv), "material property");
+    this->esvevolutions =
+        EvolutionBindingTable(this->b->expandExternalStateVariablesNames(),
+                              *(this->evm), "external state variable");
+  }  // end of bindEvolutions
+
   bool SingleStructureScheme::doPackagingStep(StudyCurrentState& state) const {
     auto& scs = state.getStructureCurrentState("");
     auto& bwk = scs.getBehaviourWorkSpace();
@@ -323,10 +333,8 @@ namespace mtest {
     // end of the time step. Computation of thermal expansion if needed.
     for (auto& s : scs.istates) {
       this->setGaussPointPositionForEvolutionsEvaluation(s);
-      computeMaterialProperties(s, *(this->evm), *(this->dmpv),
-                                this->b->getMaterialPropertiesNames(), t, dt);
-      computeExternalStateVariables(
-          s, *(this->evm), this->b->expandExternalStateVariablesNames(), t, dt);
+      computeMaterialProperties(s, this->mpevolutions, t, dt);
+      computeExternalStateVariables(s, this->esvevolutions, t, dt);
       // thermal expansion
       if ((this->handleThermalExpansion) &&
           ((this->b->getBehaviourType() ==
@@ -0,0 +1,36 @@
+/*!
+ * \file   SolverWorkSpace.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/SolverWorkSpace.hxx"
+
+namespace mtest {
+
+  void solveLinearSystem(SolverWorkSpace& wk) {
+    if (wk.storage == SolverWorkSpace::BORDEREDBANDED) {
+      wk.Kb.factorize();
+      wk.Kb.solve(wk.du);
+      return;
+    }
+    tfel::math::LUSolve::exe(wk.K, wk.du, wk.x, wk.p_lu);
+  }  // end of solveLinearSystem
+
+  void backSubstitute(SolverWorkSpace& wk, tfel::math::vector<real>& x) {
+    if (wk.storage == SolverWorkSpace::BORDEREDBANDED) {
+      wk.Kb.solve(x);
+      return;
+    }
+    tfel::math::LUSolve::back_substitute(wk.K, x, wk.x, wk.p_lu);
+  }  // end of backSubstitute
+
+}  // end of namespace mtest
@@ -16,6 +16,7 @@
 #include <stdexcept>
 #include "TFEL/Raise.hxx"
 #include "MFront/MFrontLogStream.hxx"
+#include "MTest/BinaryReadWrite.hxx"
 #include "MTest/SteffensenAccelerationAlgorithm.hxx"
 
 namespace mtest {
@@ -92,4 +93,22 @@ namespace mtest {
 
   SteffensenAccelerationAlgorithm::~SteffensenAccelerationAlgorithm() = default;
 
+  void SteffensenAccelerationAlgorithm::writeHistory(const int f) const {
+    using tfel::system::binary_write;
+    binary_write(f, this->sta_u0);
+    binary_write(f, this->sta_u1);
+    binary_write(f, this->sta_u2);
+    binary_write(f, this->sta_du2);
+    binary_write(f, this->sta_du1);
+  }  // end of writeHistory
+
+  void SteffensenAccelerationAlgorithm::readHistory(const int f) {
+    using tfel::system::binary_read;
+    binary_read(f, this->sta_u0);
+    binary_read(f, this->sta_u1);
+    binary_read(f, this->sta_u2);
+    binary_read(f, this->sta_du2);
+    binary_read(f, this->sta_du1);
+  }  // end of readHistory
+
 }  // end of namespace mtest
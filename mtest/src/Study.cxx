@@ -12,9 +12,19 @@
  */
 
 #include "MTest/Study.hxx"
+#include "MTest/SolverWorkSpace.hxx"
 
 namespace mtest {
 
+  std::pair<bool, real> Study::computeStiffnessMatrixAndResidual(
+      StudyCurrentState& s,
+      SolverWorkSpace& wk,
+      const real t,
+      const real dt,
+      const StiffnessMatrixType mt) const {
+    return this->computeStiffnessMatrixAndResidual(s, wk.K, wk.r, t, dt, mt);
+  }  // end of computeStiffnessMatrixAndResidual
+
   Study::~Study() = default;
 
 }  // end of namespace mtest
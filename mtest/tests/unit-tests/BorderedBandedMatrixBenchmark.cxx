@@ -0,0 +1,163 @@
+/*!
+ * \file   mtest/tests/unit-tests/BorderedBandedMatrixBenchmark.cxx
+ * \brief  This benchmark compares the cost of the resolution of the
+ * linear system associated with the stiffness matrix of a `PipeTest`
+ * discretised with linear elements using a dense LU decomposition, as
+ * done before the introduction of the `BorderedBandedMatrix` class, and
+ * using the bordered banded factorisation, for meshes from 10 to 10000
+ * elements.
+ *
+ * Usage: `BorderedBandedMatrixBenchmark [<maximum number of elements for
+ * the dense solver>] [<repetitions>]`
+ *
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence
+ * or the CECILL-A licence. A copy of thoses licences are delivered
+ * with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "TFEL/Math/vector.hxx"
+#include "TFEL/Math/matrix.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/BorderedBandedMatrix.hxx"
+
+//! \brief a simple alias
+using real = mtest::real;
+//! \brief a simple alias
+using size_type = mtest::BorderedBandedMatrix::size_type;
+
+/*!
+ * \brief assemble the elastic stiffness matrix of a pipe discretised
+ * with linear elements, in small strain, following the
+ * `PipeLinearElement` class. The last unknown is the axial strain.
+ * \param[out] k: stiffness matrix
+ * \param[in] ne: number of elements
+ */
+template <typename MatrixType>
+static void assemble(MatrixType& k, const size_type ne) {
+  constexpr real pi = 3.14159265358979323846;
+  constexpr real E = 150e9;
+  constexpr real nu = 0.3;
+  constexpr real lambda = nu * E / ((1 + nu) * (1 - 2 * nu));
+  constexpr real mu = E / (2 * (1 + nu));
+  constexpr real Ri = 4.2e-3;
+  constexpr real Re = 4.7e-3;
+  // elastic stiffness, the components being ordered as rr, zz, tt
+  const real bk[3][3] = {{lambda + 2 * mu, lambda, lambda},
+                         {lambda, lambda + 2 * mu, lambda},
+                         {lambda, lambda, lambda + 2 * mu}};
+  const auto n = ne + 1;
+  const auto dr = (Re - Ri) / static_cast<real>(ne);
+  const auto J = dr / 2;
+  const real pgs[2] = {-1 / std::sqrt(real(3)), 1 / std::sqrt(real(3))};
+  for (size_type i = 0; i != ne; ++i) {
+    const auto r0 = Ri + dr * static_cast<real>(i);
+    for (const auto pg : pgs) {
+      const auto rg = r0 + dr * (1 + pg) / 2;
+      const auto w = 2 * pi * J;
+      // derivatives of the strain components with respect to the
+      // displacements of the nodes
+      const real de_du[2][3] = {{-1 / dr, 0, (1 - pg) / (2 * rg)},
+                                {1 / dr, 0, (1 + pg) / (2 * rg)}};
+      // derivatives of the inner forces with respect to the stress
+      const real df_ds[2][3] = {{-rg / dr, 0, (1 - pg) / 2},
+                                {rg / dr, 0, (1 + pg) / 2}};
+      for (size_type a = 0; a != 2; ++a) {
+        for (size_type b = 0; b != 2; ++b) {
+          auto v = real(0);
+          for (size_type c = 0; c != 3; ++c) {
+            for (size_type d = 0; d != 3; ++d) {
+              v += df_ds[a][c] * bk[c][d] * de_du[b][d];
+            }
+          }
+          k(i + a, i + b) += w * v;
+        }
+        k(i + a, n) += w * (df_ds[a][0] * bk[0][1] + df_ds[a][2] * bk[2][1]);
+        k(n, i + a) +=
+            w * rg * (bk[1][0] * de_du[a][0] + bk[1][2] * de_du[a][2]);
+      }
+      k(n, n) += w * rg * bk[1][1];
+    }
+  }
+}  // end of assemble
+
+/*!
+ * \return the time, in seconds, spent to call `f` `r` times.
+ * \param[in] f: function to be benchmarked
+ * \param[in] r: number of repetitions
+ */
+template <typename Function>
+static double benchmark(const Function& f, const int r) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i != r; ++i) {
+    f();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}  // end of benchmark
+
+int main(const int argc, const char* const* const argv) {
+  const auto nmax = static_cast<size_type>(
+      (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000);
+  const auto r = (argc > 2) ? std::atoi(argv[2]) : 10;
+  std::cout << "# number of elements, dense (s), bordered banded (s), "
+            << "speed-up, maximum relative difference\n";
+  for (const size_type ne : {10, 30, 100, 300, 1000, 3000, 10000}) {
+    const auto n = ne + 2;
+    auto y = tfel::math::vector<real>(n);
+    for (size_type i = 0; i != n; ++i) {
+      y[i] = std::cos(static_cast<real>(i));
+    }
+    // bordered banded solver
+    auto x = y;
+    auto bk = mtest::BorderedBandedMatrix{};
+    bk.resize(n, 1);
+    const auto tb = benchmark(
+        [&bk, &x, &y, ne] {
+          bk.zero();
+          assemble(bk, ne);
+          x = y;
+          bk.factorize();
+          bk.solve(x);
+        },
+        r);
+    std::cout << ne << " ";
+    if (ne > nmax) {
+      std::cout << "- " << tb / r << " - -\n";
+      continue;
+    }
+    // dense solver
+    auto x2 = y;
+    auto k = tfel::math::matrix<real>(n, n);
+    auto wk = tfel::math::vector<real>(n);
+    auto p = tfel::math::Permutation<size_type>(n);
+    const auto td = benchmark(
+        [&k, &x2, &y, &wk, &p, ne] {
+          std::fill(k.begin(), k.end(), real(0));
+          assemble(k, ne);
+          x2 = y;
+          tfel::math::LUSolve::exe(k, x2, wk, p);
+        },
+        r);
+    auto e = real(0);
+    auto xmax = real(0);
+    for (size_type i = 0; i != n; ++i) {
+      e = std::max(e, std::abs(x[i] - x2[i]));
+      xmax = std::max(xmax, std::abs(x2[i]));
+    }
+    e /= xmax;
+    std::cout << td / r << " " << tb / r << " " << td / tb << " " << e
+              << '\n';
+  }
+  return EXIT_SUCCESS;
+}  // end of main
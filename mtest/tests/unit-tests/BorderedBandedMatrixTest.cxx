@@ -0,0 +1,146 @@
+/*!
+ * \file   BorderedBandedMatrixTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/LUSolve.hxx"
+#include "MTest/BorderedBandedMatrix.hxx"
+
+struct BorderedBandedMatrixTest final : public tfel::tests::TestCase {
+  BorderedBandedMatrixTest()
+      : tfel::tests::TestCase("MTest", "BorderedBandedMatrixTest") {
+  }  // end of BorderedBandedMatrixTest
+
+  tfel::tests::TestResult execute() override {
+    for (const auto w : {1, 2, 3}) {
+      for (const auto n : {1, 2, 3, 5, 17, 40}) {
+        this->test1(static_cast<size_type>(n), static_cast<size_type>(w),
+                    false);
+        this->test1(static_cast<size_type>(n), static_cast<size_type>(w),
+                    true);
+      }
+    }
+    this->test2();
+    return this->result;
+  }  // end of execute()
+
+ private:
+  //! \brief a simple alias
+  using real = mtest::real;
+  //! \brief a simple alias
+  using size_type = mtest::BorderedBandedMatrix::size_type;
+  //! \return a pseudo-random number in [-1:1]
+  real random() {
+    this->seed = (1103515245u * this->seed + 12345u) % 2147483648u;
+    return 2 * static_cast<real>(this->seed) / 2147483648. - 1;
+  }  // end of random
+  /*!
+   * \brief compare the solution of a linear system obtained by the
+   * bordered banded factorisation to the one obtained with a dense LU
+   * decomposition.
+   * \param[in] n: size of the matrix
+   * \param[in] w: half bandwidth
+   * \param[in] p: if true, the diagonal of the banded block is small,
+   * so that row permutations are mandatory.
+   */
+  void test1(const size_type n, const size_type w, const bool p) {
+    using namespace tfel::math;
+    auto bk = mtest::BorderedBandedMatrix{};
+    bk.resize(n, w);
+    auto k = matrix<real>(n, n, real(0));
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        const auto d = (i > j) ? i - j : j - i;
+        if ((d > w) && (i != n - 1) && (j != n - 1)) {
+          continue;
+        }
+        auto v = this->random();
+        if (i == j) {
+          v = p ? v * 1.e-2 : v + 4 * (w + 1);
+        }
+        k(i, j) = v;
+        bk(i, j) += v;
+      }
+    }
+    for (size_type i = 0; i != n; ++i) {
+      for (size_type j = 0; j != n; ++j) {
+        TFEL_TESTS_ASSERT(std::abs(k(i, j) - std::as_const(bk)(i, j)) < eps);
+      }
+    }
+    auto y = vector<real>(n);
+    for (auto& v : y) {
+      v = this->random();
+    }
+    auto x = y;
+    auto x2 = y;
+    auto x3 = y;
+    auto wk = vector<real>(n);
+    auto pm = Permutation<size_type>(n);
+    LUSolve::exe(k, x, wk, pm);
+    bk.factorize();
+    bk.solve(x2);
+    // the factorisation can be reused
+    bk.solve(x3);
+    auto xmax = real(1);
+    for (size_type i = 0; i != n; ++i) {
+      xmax = std::max(xmax, std::abs(x(i)));
+    }
+    for (size_type i = 0; i != n; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(x(i) - x2(i)) < 1.e-10 * xmax);
+      TFEL_TESTS_ASSERT(std::abs(x2(i) - x3(i)) < eps);
+    }
+  }  // end of test1
+  //! \brief check the error handling
+  void test2() {
+    auto bk = mtest::BorderedBandedMatrix{};
+    bk.resize(6, 1);
+    TFEL_TESTS_CHECK_THROW(bk(0, 2) = 1, std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(bk(3, 1) = 1, std::runtime_error);
+    bk(0, 5) = 1;
+    bk(5, 0) = 1;
+    bk(2, 3) = 1;
+    TFEL_TESTS_ASSERT(std::abs(std::as_const(bk)(0, 2)) < eps);
+    auto x = tfel::math::vector<mtest::real>(6, mtest::real(1));
+    TFEL_TESTS_CHECK_THROW(bk.solve(x), std::runtime_error);
+    TFEL_TESTS_CHECK_THROW(bk.factorize(), std::runtime_error);
+  }  // end of test2
+  //! \brief seed of the pseudo-random number generator
+  unsigned long seed = 1;
+  //! \brief comparison criterion
+  static constexpr real eps = 1.e-14;
+};
+
+TFEL_TESTS_GENERATE_PROXY(BorderedBandedMatrixTest,
+                          "BorderedBandedMatrixTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  using namespace tfel::tests;
+  auto& m = TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BorderedBandedMatrixTest.xml");
+  const auto r = m.execute();
+  return r.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -67,6 +67,8 @@ namespace tfel::system {
         elm.isUMATBehaviourAbleToComputeInternalEnergy(l, f, h);
     this->computesDissipatedEnergy =
         elm.isUMATBehaviourAbleToComputeDissipatedEnergy(l, f, h);
+    this->hasBatchIntegrationFunction =
+        elm.hasGenericBehaviourBatchIntegrationFunction(l, f, h);
     this->mpnames = elm.getUMATMaterialPropertiesNames(l, f, h);
     this->ivnames = elm.getUMATInternalStateVariablesNames(l, f, h);
     this->ivtypes = elm.getUMATInternalStateVariablesTypes(l, f, h);
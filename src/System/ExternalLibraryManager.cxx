@@ -1081,6 +1081,128 @@ namespace tfel::system {
     return fct;
   }
 
+  bool ExternalLibraryManager::hasGenericBehaviourBatchIntegrationFunction(
+      const std::string& l, const std::string& f, const std::string& h) {
+    ExternalLibraryManagerCheckModellingHypothesisName(h);
+    const auto lib = this->loadLibrary(l);
+    auto b = ::tfel_getBool(lib, (f + "_" + h + "_BatchIntegration").c_str());
+    if (b == -1) {
+      b = ::tfel_getBool(lib, (f + "_BatchIntegration").c_str());
+    }
+    if (b == -1) {
+      return false;
+    }
+    return (b == 1);
+  }  // end of hasGenericBehaviourBatchIntegrationFunction
+
+  GenericBehaviourBatchIntegrationFctPtr
+  ExternalLibraryManager::getGenericBehaviourBatchIntegrationFunction(
+      const std::string& l, const std::string& f) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourBatchIntegrationFunction(
+        lib, (f + "_integrateBatch").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourBatchIntegrationFunction: "
+             "could not load generic behaviour function '" +
+                 f + "_integrateBatch' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourBatchIntegrationFunction
+
+  GenericBehaviourCreateParametersSetFctPtr
+  ExternalLibraryManager::getGenericBehaviourCreateParametersSetFunction(
+      const std::string& l, const std::string& b) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourCreateParametersSetFunction(
+        lib, (b + "_createParametersSet").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourCreateParametersSetFunction: "
+             "could not load function '" +
+                 b + "_createParametersSet' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourCreateParametersSetFunction
+
+  GenericBehaviourCopyParametersSetFctPtr
+  ExternalLibraryManager::getGenericBehaviourCopyParametersSetFunction(
+      const std::string& l, const std::string& b) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourCopyParametersSetFunction(
+        lib, (b + "_copyParametersSet").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourCopyParametersSetFunction: "
+             "could not load function '" +
+                 b + "_copyParametersSet' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourCopyParametersSetFunction
+
+  GenericBehaviourSetParameterInParametersSetFctPtr ExternalLibraryManager::
+      getGenericBehaviourSetParameterInParametersSetFunction(
+          const std::string& l, const std::string& b) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct =
+        ::tfel_getGenericBehaviourSetParameterInParametersSetFunction(
+            lib, (b + "_setParameterInParametersSet").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourSetParameterInParametersSetFunction: "
+             "could not load function '" +
+                 b + "_setParameterInParametersSet' (" + getErrorMessage() +
+                 ")");
+    return fct;
+  }  // end of getGenericBehaviourSetParameterInParametersSetFunction
+
+  GenericBehaviourSetIntegerParameterInParametersSetFctPtr
+  ExternalLibraryManager::
+      getGenericBehaviourSetIntegerParameterInParametersSetFunction(
+          const std::string& l, const std::string& b) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct =
+        ::tfel_getGenericBehaviourSetIntegerParameterInParametersSetFunction(
+            lib, (b + "_setIntegerParameterInParametersSet").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourSetIntegerParameterInParametersSet"
+             "Function: "
+             "could not load function '" +
+                 b + "_setIntegerParameterInParametersSet' (" +
+                 getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourSetIntegerParameterInParametersSetFunction
+
+  GenericBehaviourSetUnsignedShortParameterInParametersSetFctPtr
+  ExternalLibraryManager::
+      getGenericBehaviourSetUnsignedShortParameterInParametersSetFunction(
+          const std::string& l, const std::string& b) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::
+        tfel_getGenericBehaviourSetUnsignedShortParameterInParametersSetFunction(
+            lib, (b + "_setUnsignedShortParameterInParametersSet").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourSetUnsignedShortParameterInParametersSet"
+             "Function: could not load function '" +
+                 b + "_setUnsignedShortParameterInParametersSet' (" +
+                 getErrorMessage() + ")");
+    return fct;
+  }  // end of
+     // getGenericBehaviourSetUnsignedShortParameterInParametersSetFunction
+
+  GenericBehaviourDestroyParametersSetFctPtr
+  ExternalLibraryManager::getGenericBehaviourDestroyParametersSetFunction(
+      const std::string& l, const std::string& b) {
+    const auto lib = this->loadLibrary(l);
+    const auto fct = ::tfel_getGenericBehaviourDestroyParametersSetFunction(
+        lib, (b + "_destroyParametersSet").c_str());
+    raise_if(fct == nullptr,
+             "ExternalLibraryManager::"
+             "getGenericBehaviourDestroyParametersSetFunction: "
+             "could not load function '" +
+                 b + "_destroyParametersSet' (" + getErrorMessage() + ")");
+    return fct;
+  }  // end of getGenericBehaviourDestroyParametersSetFunction
+
   std::vector<std::string>
   ExternalLibraryManager::getGenericBehaviourInitializeFunctions(
       const std::string& l, const std::string& f, const std::string& h) {
@@ -0,0 +1,196 @@
+/*!
+ * \file   src/System/WorkStealingExecutor.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+#if defined __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif /* defined __linux__ */
+#include "TFEL/Raise.hxx"
+#include "TFEL/System/WorkStealingExecutor.hxx"
+
+namespace tfel::system {
+
+  /*!
+   * \brief bind the calling thread to the given core
+   * \param[in] i: core index (modulo the number of cores)
+   */
+  static void pinCurrentThread(const std::size_t i) {
+#if defined __linux__
+    const auto n = std::max(std::thread::hardware_concurrency(), 1u);
+    cpu_set_t s;
+    CPU_ZERO(&s);
+    CPU_SET(static_cast<int>(i % n), &s);
+    ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set_t), &s);
+#else
+    static_cast<void>(i);
+#endif /* defined __linux__ */
+  }  // end of pinCurrentThread
+
+  WorkStealingExecutor::Options WorkStealingExecutor::getOptionsFromEnvironment(
+      const std::string& prefix, const size_type n) {
+    auto get_integer = [&prefix](const std::string& v, const size_type d) {
+      const auto* const e = std::getenv((prefix + v).c_str());
+      if (e == nullptr) {
+        return d;
+      }
+      try {
+        std::size_t pos;
+        const auto r = std::stoul(e, &pos);
+        if (pos == std::string{e}.size()) {
+          return static_cast<size_type>(r);
+        }
+      } catch (std::exception&) {
+      }
+      tfel::raise(
+          "WorkStealingExecutor::getOptionsFromEnvironment: "
+          "invalid value '" +
+          std::string{e} + "' for environment variable '" + prefix + v +
+          "'");
+    };
+    auto o = Options{};
+    o.number_of_threads = std::max(get_integer("_NTHREADS", n), size_type{1});
+    o.grain_size = get_integer("_GRAIN_SIZE", 0);
+    const auto* const p = std::getenv((prefix + "_PIN_THREADS").c_str());
+    o.pin_threads = (p != nullptr) && (std::string{p} == "true");
+    return o;
+  }  // end of getOptionsFromEnvironment
+
+  WorkStealingExecutor::WorkStealingExecutor(const size_type n)
+      : WorkStealingExecutor(Options{n, 0, false}) {
+  }  // end of WorkStealingExecutor
+
+  WorkStealingExecutor::WorkStealingExecutor(const Options& o)
+      : options(o),
+        ranges(std::make_unique<Range[]>(std::max(o.number_of_threads,
+                                                  size_type{1}))) {
+    // the calling thread is the thread 0
+    for (size_type i = 1; i < o.number_of_threads; ++i) {
+      this->workers.emplace_back([this, i] { this->loop(i); });
+    }
+  }  // end of WorkStealingExecutor
+
+  WorkStealingExecutor::size_type WorkStealingExecutor::getNumberOfThreads()
+      const noexcept {
+    return this->workers.size() + 1;
+  }  // end of getNumberOfThreads
+
+  void WorkStealingExecutor::loop(const size_type i) noexcept {
+    if (this->options.pin_threads) {
+      pinCurrentThread(i);
+    }
+    auto g = std::uint64_t{0};
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(this->m);
+        this->start.wait(lock,
+                         [this, g] { return this->stop || this->generation != g; });
+        if (this->stop) {
+          return;
+        }
+        g = this->generation;
+      }
+      this->work(i);
+      {
+        std::lock_guard<std::mutex> lock(this->m);
+        if (--(this->active) == 0) {
+          this->end.notify_one();
+        }
+      }
+    }
+  }  // end of loop
+
+  void WorkStealingExecutor::work(const size_type i) noexcept {
+    const auto n = this->getNumberOfThreads();
+    try {
+      for (size_type j = 0; j != n; ++j) {
+        auto& r = this->ranges[(i + j) % n];
+        for (;;) {
+          const auto cb = r.next.fetch_add(this->grain);
+          if (cb >= r.end) {
+            break;
+          }
+          this->kernel(this->data, cb, std::min(cb + this->grain, r.end));
+        }
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(this->m);
+      if (!this->exception) {
+        this->exception = std::current_exception();
+      }
+      // stop the treatment of the remaining chunks
+      for (size_type j = 0; j != n; ++j) {
+        this->ranges[j].next = this->ranges[j].end;
+      }
+    }
+  }  // end of work
+
+  void WorkStealingExecutor::execute(const size_type b,
+                                     const size_type e,
+                                     Kernel k,
+                                     void* const d) {
+    if (e <= b) {
+      return;
+    }
+    auto expected = false;
+    if ((this->workers.empty()) ||
+        (!this->busy.compare_exchange_strong(expected, true))) {
+      k(d, b, e);
+      return;
+    }
+    const auto n = this->getNumberOfThreads();
+    const auto size = e - b;
+    this->kernel = k;
+    this->data = d;
+    this->grain = this->options.grain_size != 0
+                      ? this->options.grain_size
+                      : std::max(size / (8 * n), size_type{1});
+    for (size_type i = 0; i != n; ++i) {
+      this->ranges[i].next = b + (i * size) / n;
+      this->ranges[i].end = b + ((i + 1) * size) / n;
+    }
+    {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->active = this->workers.size();
+      ++(this->generation);
+    }
+    this->start.notify_all();
+    this->work(0);
+    auto ex = std::exception_ptr{};
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      this->end.wait(lock, [this] { return this->active == 0; });
+      std::swap(ex, this->exception);
+    }
+    this->kernel = nullptr;
+    this->data = nullptr;
+    this->busy = false;
+    if (ex) {
+      std::rethrow_exception(ex);
+    }
+  }  // end of execute
+
+  WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+      std::lock_guard<std::mutex> lock(this->m);
+      this->stop = true;
+    }
+    this->start.notify_all();
+    for (auto& w : this->workers) {
+      w.join();
+    }
+  }  // end of ~WorkStealingExecutor
+
+}  // end of namespace tfel::system
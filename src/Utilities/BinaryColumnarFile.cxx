@@ -0,0 +1,240 @@
+/*!
+ * \file   src/Utilities/BinaryColumnarFile.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include "TFEL/Raise.hxx"
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
+
+namespace tfel::utilities {
+
+  //! \brief magic number identifying binary columnar files
+  static constexpr char binary_columnar_file_magic[8] = {'T', 'F', 'E', 'L',
+                                                         'B', 'C', 'F', '\0'};
+  //! \brief value used to detect the byte order of the writer
+  static constexpr std::uint32_t binary_columnar_file_byte_order = 0x01020304;
+  //! \brief version of the format
+  static constexpr std::uint32_t binary_columnar_file_version = 1;
+
+  template <typename T>
+  static void writeBinaryValue(std::ostream& out, const T& v) {
+    out.write(reinterpret_cast<const char*>(&v), sizeof(T));
+  }  // end of writeBinaryValue
+
+  template <typename T>
+  static bool readBinaryValue(std::istream& in, T& v) {
+    in.read(reinterpret_cast<char*>(&v), sizeof(T));
+    return static_cast<std::size_t>(in.gcount()) == sizeof(T);
+  }  // end of readBinaryValue
+
+  BinaryColumnarFileWriter::BinaryColumnarFileWriter(
+      const std::string& f, const std::vector<std::string>& n)
+      : BinaryColumnarFileWriter(f, n, Options{}) {
+  }  // end of BinaryColumnarFileWriter
+
+  BinaryColumnarFileWriter::BinaryColumnarFileWriter(
+      const std::string& f,
+      const std::vector<std::string>& n,
+      const Options& o)
+      : out(f, std::ios::binary | std::ios::trunc),
+        options(o),
+        ncolumns(n.size()) {
+    raise_if(!this->out,
+             "BinaryColumnarFileWriter::BinaryColumnarFileWriter: "
+             "can't open file '" +
+                 f + "'");
+    raise_if(n.empty(),
+             "BinaryColumnarFileWriter::BinaryColumnarFileWriter: "
+             "no column declared");
+    raise_if(this->options.chunk_size == 0,
+             "BinaryColumnarFileWriter::BinaryColumnarFileWriter: "
+             "invalid chunk size");
+    this->out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    const auto s = static_cast<std::uint32_t>(
+        this->options.use_single_precision ? sizeof(float) : sizeof(double));
+    this->out.write(binary_columnar_file_magic,
+                    sizeof(binary_columnar_file_magic));
+    writeBinaryValue(this->out, binary_columnar_file_byte_order);
+    writeBinaryValue(this->out, binary_columnar_file_version);
+    writeBinaryValue(this->out, s);
+    writeBinaryValue(this->out, static_cast<std::uint64_t>(n.size()));
+    for (const auto& c : n) {
+      writeBinaryValue(this->out, static_cast<std::uint64_t>(c.size()));
+      this->out.write(c.data(), static_cast<std::streamsize>(c.size()));
+    }
+    this->out.flush();
+    this->buffer.resize(this->ncolumns * this->options.chunk_size);
+  }  // end of BinaryColumnarFileWriter
+
+  std::size_t BinaryColumnarFileWriter::getNumberOfColumns() const {
+    return this->ncolumns;
+  }  // end of getNumberOfColumns
+
+  void BinaryColumnarFileWriter::write(const double v) {
+    raise_if(this->position == this->ncolumns,
+             "BinaryColumnarFileWriter::write: "
+             "too many values given for the current row");
+    const auto cs = this->options.chunk_size;
+    this->buffer[this->position * cs + this->nrows] = v;
+    ++(this->position);
+  }  // end of write
+
+  void BinaryColumnarFileWriter::endRow() {
+    raise_if(this->position != this->ncolumns,
+             "BinaryColumnarFileWriter::endRow: "
+             "invalid number of values given (" +
+                 std::to_string(this->position) + " values given, " +
+                 std::to_string(this->ncolumns) + " expected)");
+    this->position = 0;
+    ++(this->nrows);
+    if (this->nrows == this->options.chunk_size) {
+      this->flush();
+    }
+  }  // end of endRow
+
+  void BinaryColumnarFileWriter::flush() {
+    if (this->nrows == 0) {
+      this->out.flush();
+      return;
+    }
+    const auto cs = this->options.chunk_size;
+    const auto nr = this->nrows;
+    writeBinaryValue(this->out, static_cast<std::uint64_t>(nr));
+    if (this->options.use_single_precision) {
+      auto values = std::vector<float>(nr);
+      for (std::size_t c = 0; c != this->ncolumns; ++c) {
+        const auto b = this->buffer.begin() +
+                       static_cast<std::ptrdiff_t>(c * cs);
+        std::transform(b, b + static_cast<std::ptrdiff_t>(nr), values.begin(),
+                       [](const double v) { return static_cast<float>(v); });
+        this->out.write(reinterpret_cast<const char*>(values.data()),
+                        static_cast<std::streamsize>(nr * sizeof(float)));
+      }
+    } else {
+      for (std::size_t c = 0; c != this->ncolumns; ++c) {
+        this->out.write(
+            reinterpret_cast<const char*>(this->buffer.data() + c * cs),
+            static_cast<std::streamsize>(nr * sizeof(double)));
+      }
+    }
+    this->out.flush();
+    this->nrows = 0;
+  }  // end of flush
+
+  BinaryColumnarFileWriter::~BinaryColumnarFileWriter() {
+    try {
+      this->position = 0;
+      this->flush();
+    } catch (...) {
+    }
+  }  // end of ~BinaryColumnarFileWriter
+
+  const std::vector<double>& BinaryColumnarData::getColumn(
+      const std::string& n) const {
+    const auto p = std::find(this->names.begin(), this->names.end(), n);
+    raise_if(p == this->names.end(),
+             "BinaryColumnarData::getColumn: "
+             "no column named '" +
+                 n + "'");
+    return this->columns[static_cast<std::size_t>(p - this->names.begin())];
+  }  // end of getColumn
+
+  bool isBinaryColumnarFile(const std::string& f) {
+    std::ifstream in(f, std::ios::binary);
+    if (!in) {
+      return false;
+    }
+    char magic[sizeof(binary_columnar_file_magic)];
+    in.read(magic, sizeof(magic));
+    if (static_cast<std::size_t>(in.gcount()) != sizeof(magic)) {
+      return false;
+    }
+    return std::memcmp(magic, binary_columnar_file_magic, sizeof(magic)) == 0;
+  }  // end of isBinaryColumnarFile
+
+  BinaryColumnarData readBinaryColumnarFile(const std::string& f) {
+    auto throw_if = [&f](const bool c, const std::string& m) {
+      raise_if(c, "readBinaryColumnarFile: " + m + " (file '" + f + "')");
+    };
+    std::ifstream in(f, std::ios::binary);
+    throw_if(!in, "can't open file");
+    auto d = BinaryColumnarData{};
+    char magic[sizeof(binary_columnar_file_magic)];
+    in.read(magic, sizeof(magic));
+    throw_if((static_cast<std::size_t>(in.gcount()) != sizeof(magic)) ||
+                 (std::memcmp(magic, binary_columnar_file_magic,
+                              sizeof(magic)) != 0),
+             "invalid file header");
+    auto bom = std::uint32_t{};
+    auto version = std::uint32_t{};
+    auto s = std::uint32_t{};
+    auto nc = std::uint64_t{};
+    throw_if(!readBinaryValue(in, bom), "invalid file header");
+    throw_if(bom != binary_columnar_file_byte_order,
+             "unsupported byte order");
+    throw_if(!readBinaryValue(in, version), "invalid file header");
+    throw_if(version != binary_columnar_file_version,
+             "unsupported version of the file format");
+    throw_if(!readBinaryValue(in, s), "invalid file header");
+    throw_if((s != sizeof(float)) && (s != sizeof(double)),
+             "unsupported size of floating point values");
+    d.value_size = s;
+    throw_if(!readBinaryValue(in, nc), "invalid file header");
+    for (std::uint64_t i = 0; i != nc; ++i) {
+      auto l = std::uint64_t{};
+      throw_if(!readBinaryValue(in, l), "invalid file header");
+      auto n = std::string(static_cast<std::size_t>(l), '\0');
+      in.read(n.data(), static_cast<std::streamsize>(l));
+      throw_if(static_cast<std::uint64_t>(in.gcount()) != l,
+               "invalid file header");
+      d.names.push_back(std::move(n));
+    }
+    d.columns.resize(static_cast<std::size_t>(nc));
+    // reading chunks. An incomplete chunk may be found at the end of the
+    // file if the file is being written: this chunk is ignored.
+    auto values = std::vector<float>{};
+    while (true) {
+      auto nr = std::uint64_t{};
+      if (!readBinaryValue(in, nr)) {
+        break;
+      }
+      const auto bytes = static_cast<std::streamsize>(nr * s);
+      auto complete = true;
+      auto c = std::size_t{};
+      for (; (c != d.columns.size()) && (complete); ++c) {
+        auto& column = d.columns[c];
+        const auto pos = column.size();
+        column.resize(pos + static_cast<std::size_t>(nr));
+        if (s == sizeof(double)) {
+          in.read(reinterpret_cast<char*>(column.data() + pos), bytes);
+        } else {
+          values.resize(static_cast<std::size_t>(nr));
+          in.read(reinterpret_cast<char*>(values.data()), bytes);
+          std::copy(values.begin(), values.end(),
+                    column.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+        complete = in.gcount() == bytes;
+      }
+      if (!complete) {
+        for (std::size_t c2 = 0; c2 != c; ++c2) {
+          auto& column = d.columns[c2];
+          column.resize(column.size() - static_cast<std::size_t>(nr));
+        }
+        break;
+      }
+    }
+    return d;
+  }  // end of readBinaryColumnarFile
+
+}  // end of namespace tfel::utilities
@@ -20,11 +20,18 @@
 #include "TFEL/Raise.hxx"
 #include "TFEL/Utilities/CxxTokenizer.hxx"
 #include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
 #include "TFEL/Utilities/StringAlgorithms.hxx"
 
 namespace tfel::utilities {
 
   TextData::TextData(const std::string& file, const std::string& format) {
+    if (isBinaryColumnarFile(file)) {
+      auto d = readBinaryColumnarFile(file);
+      this->legends = std::move(d.names);
+      this->columns = std::move(d.columns);
+      return;
+    }
     auto get_legends = [](const std::string& l) {
       std::vector<std::string> r;
       CxxTokenizer t;
@@ -139,11 +146,17 @@ namespace tfel::utilities {
       raise_if(b, "TextData::getColumn: " + msg);
     };
     tab.clear();
-    tab.reserve(this->lines.size());
     // sanity check
     throw_if(i == 0u,
              "column '0' requested "
              "(column numbers begins at '1').");
+    if (!this->columns.empty()) {
+      throw_if(i > this->columns.size(),
+               "the file does not have '" + std::to_string(i) + "' columns.");
+      tab = this->columns[i - 1];
+      return;
+    }
+    tab.reserve(this->lines.size());
     // treatment
     for (const auto& l : this->lines) {
       auto n = l.tokens.empty() ? 0 : l.tokens[0].line;
@@ -167,6 +180,13 @@ namespace tfel::utilities {
     auto get_line = [](const Line& l) -> Token::size_type {
       return l.tokens.empty() ? 0 : l.tokens[0].line;
     };
+    if (!this->columns.empty()) {
+      for (auto& c : this->columns) {
+        c.erase(c.begin(), c.begin() + static_cast<std::ptrdiff_t>(
+                                           std::min(n, c.size())));
+      }
+      return;
+    }
     if (this->lines.empty()) {
       return;
     }
@@ -0,0 +1,154 @@
+/*!
+ * \file   DualNumberTest.cxx
+ * \brief  Tests of the `DualNumber` class
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif /* NDEBUG */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Math/General/DualNumber.hxx"
+#include "TFEL/Math/tvector.hxx"
+#include "TFEL/Math/tmatrix.hxx"
+#include "TFEL/Math/stensor.hxx"
+#include "TFEL/Math/TinyMatrixSolve.hxx"
+
+struct DualNumberTest final : public tfel::tests::TestCase {
+  DualNumberTest() : tfel::tests::TestCase("TFEL/Math", "DualNumberTest") {}
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }  // end of execute
+ private:
+  //! \brief derivatives of scalar functions
+  void test1() {
+    using namespace tfel::math;
+    using Dual = DualNumber<2>;
+    static_assert(isDualNumber<Dual>());
+    static_assert(!isDualNumber<double>());
+    static_assert(std::is_same_v<result_type<Dual, double, OpMult>, Dual>);
+    static_assert(std::is_same_v<result_type<int, Dual, OpPlus>, Dual>);
+    static_assert(std::is_same_v<derivative_type<Dual, Dual>, Dual>);
+    constexpr auto eps = 1.e-14;
+    const auto x = Dual::variable(0.3, 0);
+    const auto y = Dual::variable(1.7, 1);
+    auto check = [this, eps](const Dual& f, const double v, const double dx,
+                             const double dy) {
+      TFEL_TESTS_ASSERT(std::abs(f.getValue() - v) < eps);
+      TFEL_TESTS_ASSERT(std::abs(f.getDerivative(0) - dx) < eps);
+      TFEL_TESTS_ASSERT(std::abs(f.getDerivative(1) - dy) < eps);
+    };
+    check(x * y, 0.3 * 1.7, 1.7, 0.3);
+    check(x / y, 0.3 / 1.7, 1 / 1.7, -0.3 / (1.7 * 1.7));
+    check(2 - x + 3 * y, 2 - 0.3 + 3 * 1.7, -1, 3);
+    check(1 / y, 1 / 1.7, 0, -1 / (1.7 * 1.7));
+    check(exp(x) * log(y), std::exp(0.3) * std::log(1.7),
+          std::exp(0.3) * std::log(1.7), std::exp(0.3) / 1.7);
+    check(sqrt(y), std::sqrt(1.7), 0, 0.5 / std::sqrt(1.7));
+    check(pow(y, x), std::pow(1.7, 0.3), std::pow(1.7, 0.3) * std::log(1.7),
+          0.3 * std::pow(1.7, -0.7));
+    check(power<3>(x), 0.027, 0.27, 0);
+    check(power<1, 2>(y), std::sqrt(1.7), 0, 0.5 / std::sqrt(1.7));
+    check(tanh(x), std::tanh(0.3), 1 - std::tanh(0.3) * std::tanh(0.3), 0);
+    check(abs(-x), 0.3, 1, 0);
+    check(pow(y, 2), 1.7 * 1.7, 0, 2 * 1.7);
+    check(max(0, x - y), 0, 0, 0);
+    check(max(x, y), 1.7, 0, 1);
+    check(min(x, 1), 0.3, 1, 0);
+    TFEL_TESTS_ASSERT(x < y);
+    TFEL_TESTS_ASSERT(x > 0.2);
+    TFEL_TESTS_ASSERT(x != y);
+    TFEL_TESTS_ASSERT(ieee754::isfinite(x));
+  }  // end of test1
+  //! \brief derivative of the von Mises stress
+  void test2() {
+    using namespace tfel::math;
+    using Dual = DualNumber<6>;
+    constexpr auto eps = 1.e-12;
+    const auto s = stensor<3, double>{1.2, -0.3, 0.7, 0.4, -0.1, 0.25};
+    auto sd = stensor<3, Dual>{};
+    for (unsigned short i = 0; i != 6; ++i) {
+      sd[i] = Dual::variable(s[i], i);
+    }
+    const auto seq = sigmaeq(sd);
+    TFEL_TESTS_ASSERT(std::abs(seq.getValue() - sigmaeq(s)) < eps);
+    const auto n = eval(3 * deviator(s) / (2 * sigmaeq(s)));
+    for (unsigned short i = 0; i != 6; ++i) {
+      TFEL_TESTS_ASSERT(std::abs(seq.getDerivative(i) - n[i]) < eps);
+    }
+  }  // end of test2
+  //! \brief dual numbers in tiny vectors and tiny matrices
+  void test3() {
+    using namespace tfel::math;
+    using Dual = DualNumber<2>;
+    constexpr auto eps = 1.e-14;
+    auto v = tvector<2u, Dual>{};
+    v(0) = Dual::variable(2, 0);
+    v(1) = Dual::variable(-1, 1);
+    // derivative of the squared norm: 2 v
+    const auto n2 = v | v;
+    TFEL_TESTS_ASSERT(std::abs(n2.getValue() - 5) < eps);
+    TFEL_TESTS_ASSERT(std::abs(n2.getDerivative(0) - 4) < eps);
+    TFEL_TESTS_ASSERT(std::abs(n2.getDerivative(1) + 2) < eps);
+    auto m = tmatrix<2u, 2u, Dual>{};
+    m(0, 0) = 2 * v(0);
+    m(0, 1) = v(1);
+    m(1, 0) = 0.5;
+    m(1, 1) = v(0) * v(1);
+    const auto w = eval(m * v);
+    TFEL_TESTS_ASSERT(std::abs(w(0).getValue() - 9) < eps);
+    // d(2 v0^2 + v1^2)/dv = (4 v0, 2 v1)
+    TFEL_TESTS_ASSERT(std::abs(w(0).getDerivative(0) - 8) < eps);
+    TFEL_TESTS_ASSERT(std::abs(w(0).getDerivative(1) + 2) < eps);
+  }  // end of test3
+  //! \brief derivative of the solution of a linear system
+  void test4() {
+    using namespace tfel::math;
+    using Dual = DualNumber<1>;
+    constexpr auto eps = 1.e-12;
+    // the matrix depends on a parameter a: A = [[a, 1], [1, 2]]
+    const auto a = Dual::variable(3, 0);
+    auto m = tmatrix<2u, 2u, Dual>{};
+    m(0, 0) = a;
+    m(0, 1) = 1;
+    m(1, 0) = 1;
+    m(1, 1) = 2;
+    auto x = tvector<2u, Dual>{};
+    x(0) = 1;
+    x(1) = 0;
+    TinyMatrixSolve<2u, Dual>::exe(m, x);
+    // x = (2, -1) / (2 a - 1)
+    const auto d = 2 * 3. - 1;
+    TFEL_TESTS_ASSERT(std::abs(x(0).getValue() - 2 / d) < eps);
+    TFEL_TESTS_ASSERT(std::abs(x(1).getValue() + 1 / d) < eps);
+    TFEL_TESTS_ASSERT(std::abs(x(0).getDerivative(0) + 4 / (d * d)) < eps);
+    TFEL_TESTS_ASSERT(std::abs(x(1).getDerivative(0) - 2 / (d * d)) < eps);
+  }  // end of test4
+};
+
+TFEL_TESTS_GENERATE_PROXY(DualNumberTest, "DualNumberTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("DualNumberTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
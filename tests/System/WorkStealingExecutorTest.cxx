@@ -0,0 +1,96 @@
+/*!
+ * \file   WorkStealingExecutorTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#include <atomic>
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/System/WorkStealingExecutor.hxx"
+
+struct WorkStealingExecutorTest final : public tfel::tests::TestCase {
+  WorkStealingExecutorTest()
+      : tfel::tests::TestCase("TFEL/System", "WorkStealingExecutorTest") {
+  }  // end of WorkStealingExecutorTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    return this->result;
+  }  // end of execute
+
+ private:
+  //! \brief check that each index is treated exactly once
+  void test1() {
+    using size_type = tfel::system::WorkStealingExecutor::size_type;
+    for (const auto g : {size_type{0}, size_type{1}, size_type{7}}) {
+      auto o = tfel::system::WorkStealingExecutor::Options{};
+      o.number_of_threads = 4;
+      o.grain_size = g;
+      tfel::system::WorkStealingExecutor e(o);
+      TFEL_TESTS_ASSERT(e.getNumberOfThreads() == 4);
+      for (const auto n : {size_type{0}, size_type{3}, size_type{1000}}) {
+        auto counts = std::vector<std::atomic<int>>(n + 5);
+        e.parallel_for(5, n + 5, [&counts](const size_type i) { ++counts[i]; });
+        for (size_type i = 0; i != n + 5; ++i) {
+          TFEL_TESTS_ASSERT(counts[i] == (i < 5 ? 0 : 1));
+        }
+      }
+      auto s = std::atomic<size_type>{0};
+      e.parallel_for_chunks(0, 100, [&s](const size_type cb,
+                                         const size_type ce) {
+        for (auto i = cb; i != ce; ++i) {
+          s += i;
+        }
+      });
+      TFEL_TESTS_ASSERT(s == 4950);
+    }
+  }  // end of test1
+  //! \brief nested calls are executed sequentially
+  void test2() {
+    using size_type = tfel::system::WorkStealingExecutor::size_type;
+    tfel::system::WorkStealingExecutor e(3);
+    auto s = std::atomic<size_type>{0};
+    e.parallel_for(0, 10, [&e, &s](const size_type) {
+      e.parallel_for(0, 10, [&s](const size_type i) { s += i; });
+    });
+    TFEL_TESTS_ASSERT(s == 450);
+  }  // end of test2
+  //! \brief exceptions are propagated to the calling thread
+  void test3() {
+    using size_type = tfel::system::WorkStealingExecutor::size_type;
+    tfel::system::WorkStealingExecutor e(2);
+    TFEL_TESTS_CHECK_THROW(e.parallel_for(0, 100,
+                                          [](const size_type i) {
+                                            if (i == 50) {
+                                              throw(std::runtime_error("test"));
+                                            }
+                                          }),
+                           std::runtime_error);
+    // the executor is still usable
+    auto s = std::atomic<size_type>{0};
+    e.parallel_for(0, 10, [&s](const size_type i) { s += i; });
+    TFEL_TESTS_ASSERT(s == 45);
+  }  // end of test3
+};
+
+TFEL_TESTS_GENERATE_PROXY(WorkStealingExecutorTest, "WorkStealingExecutorTest");
+
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("WorkStealingExecutorTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,145 @@
+/*!
+ * \file   tests/Utilities/BinaryColumnarFileTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   17/10/2026
+ * \copyright Copyright (C) 2006-2018 CEA/DEN, EDF R&D. All rights
+ * reserved.
+ * This project is publicly released under either the GNU GPL Licence with
+ * linking exception or the CECILL-A licence. A copy of thoses licences are
+ * delivered with the sources of TFEL. CEA or EDF may also distribute this
+ * project under specific licensing conditions.
+ */
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "TFEL/Tests/TestCase.hxx"
+#include "TFEL/Tests/TestProxy.hxx"
+#include "TFEL/Tests/TestManager.hxx"
+#include "TFEL/Utilities/TextData.hxx"
+#include "TFEL/Utilities/BinaryColumnarFile.hxx"
+
+struct BinaryColumnarFileTest final : public tfel::tests::TestCase {
+  BinaryColumnarFileTest()
+      : tfel::tests::TestCase("TFEL/Utilities", "BinaryColumnarFileTest") {
+  }  // end of BinaryColumnarFileTest
+  tfel::tests::TestResult execute() override {
+    this->test1();
+    this->test2();
+    this->test3();
+    this->test4();
+    return this->result;
+  }
+
+ private:
+  //! \brief number of rows written (not a multiple of the chunk size)
+  static constexpr std::size_t nrows = 25;
+  static void write(const std::string& f, const bool single_precision) {
+    using namespace tfel::utilities;
+    auto o = BinaryColumnarFileWriter::Options{};
+    o.use_single_precision = single_precision;
+    o.chunk_size = 10;
+    BinaryColumnarFileWriter w(f, {"time", "SXX"}, o);
+    for (std::size_t i = 0; i != nrows; ++i) {
+      const auto t = static_cast<double>(i) / 3;
+      w.write(t);
+      w.write(std::sin(t));
+      w.endRow();
+    }
+  }
+  // double precision
+  void test1() {
+    using namespace tfel::utilities;
+    write("BinaryColumnarFileTest.bin", false);
+    TFEL_TESTS_ASSERT(isBinaryColumnarFile("BinaryColumnarFileTest.bin"));
+    const auto d = readBinaryColumnarFile("BinaryColumnarFileTest.bin");
+    TFEL_TESTS_ASSERT(d.value_size == sizeof(double));
+    TFEL_TESTS_ASSERT(d.names.size() == 2u);
+    TFEL_TESTS_ASSERT(d.names[0] == "time");
+    TFEL_TESTS_ASSERT(d.names[1] == "SXX");
+    const auto& t = d.getColumn("time");
+    const auto& s = d.getColumn("SXX");
+    TFEL_TESTS_ASSERT(t.size() == nrows);
+    TFEL_TESTS_ASSERT(s.size() == nrows);
+    for (std::size_t i = 0; i != nrows; ++i) {
+      const auto ti = static_cast<double>(i) / 3;
+      TFEL_TESTS_ASSERT(std::abs(t[i] - ti) < 1e-15);
+      TFEL_TESTS_ASSERT(std::abs(s[i] - std::sin(ti)) < 1e-15);
+    }
+    TFEL_TESTS_CHECK_THROW(d.getColumn("EXX"), std::runtime_error);
+  }
+  // single precision
+  void test2() {
+    using namespace tfel::utilities;
+    write("BinaryColumnarFileTest-float32.bin", true);
+    const auto d =
+        readBinaryColumnarFile("BinaryColumnarFileTest-float32.bin");
+    TFEL_TESTS_ASSERT(d.value_size == sizeof(float));
+    const auto& s = d.getColumn("SXX");
+    TFEL_TESTS_ASSERT(s.size() == nrows);
+    for (std::size_t i = 0; i != nrows; ++i) {
+      const auto ti = static_cast<double>(i) / 3;
+      TFEL_TESTS_ASSERT(std::abs(s[i] - std::sin(ti)) < 1e-7);
+    }
+  }
+  // reading through the TextData class
+  void test3() {
+    using namespace tfel::utilities;
+    TextData d("BinaryColumnarFileTest.bin");
+    TFEL_TESTS_ASSERT(d.getLegends().size() == 2u);
+    TFEL_TESTS_ASSERT(d.findColumn("SXX") == 2u);
+    const auto s = d.getColumn(2);
+    TFEL_TESTS_ASSERT(s.size() == nrows);
+    TFEL_TESTS_ASSERT(std::abs(s[4] - std::sin(4. / 3)) < 1e-15);
+    TFEL_TESTS_CHECK_THROW(d.getColumn(3), std::runtime_error);
+    TFEL_TESTS_ASSERT(d.begin() == d.end());
+    d.skipLines(5);
+    TFEL_TESTS_ASSERT(d.getColumn(1).size() == nrows - 5);
+  }
+  // incomplete rows and truncated files
+  void test4() {
+    using namespace tfel::utilities;
+    {
+      BinaryColumnarFileWriter w("BinaryColumnarFileTest-2.bin", {"a", "b"});
+      w.write(1);
+      TFEL_TESTS_CHECK_THROW(w.endRow(), std::runtime_error);
+      w.write(2);
+      TFEL_TESTS_CHECK_THROW(w.write(3), std::runtime_error);
+      w.endRow();
+    }
+    TFEL_TESTS_ASSERT(
+        readBinaryColumnarFile("BinaryColumnarFileTest-2.bin").columns[1] ==
+        std::vector<double>{2});
+    // truncating the last chunk of the first file: only the two
+    // complete chunks must be read
+    {
+      std::ifstream in("BinaryColumnarFileTest.bin", std::ios::binary);
+      auto c = std::string(std::istreambuf_iterator<char>(in), {});
+      c.resize(c.size() - 3);
+      std::ofstream out("BinaryColumnarFileTest-3.bin", std::ios::binary);
+      out << c;
+    }
+    const auto d = readBinaryColumnarFile("BinaryColumnarFileTest-3.bin");
+    TFEL_TESTS_ASSERT(d.columns[0].size() == 20u);
+    TFEL_TESTS_ASSERT(d.columns[1].size() == 20u);
+    TFEL_TESTS_ASSERT(!isBinaryColumnarFile("BinaryColumnarFileTest.cxx"));
+  }
+};
+
+TFEL_TESTS_GENERATE_PROXY(BinaryColumnarFileTest, "BinaryColumnarFileTest");
+
+/* coverity [UNCAUGHT_EXCEPT]*/
+int main() {
+  auto& m = tfel::tests::TestManager::getTestManager();
+  m.addTestOutput(std::cout);
+  m.addXMLTestOutput("BinaryColumnarFileTest.xml");
+  return m.execute().success() ? EXIT_SUCCESS : EXIT_FAILURE;
+}